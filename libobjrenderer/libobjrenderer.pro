@@ -27,7 +27,8 @@ HEADERS +=  src/baseobjectview.h \
             src/styledtextboxview.h \
 	    src/beziercurveitem.h \
 	    src/textpolygonitem.h \
-    src/attributestoggleritem.h
+    src/attributestoggleritem.h \
+    src/relationshipbundleitem.h
 
 SOURCES +=  src/baseobjectview.cpp \
 	    src/textboxview.cpp \
@@ -43,7 +44,8 @@ SOURCES +=  src/baseobjectview.cpp \
             src/styledtextboxview.cpp \
 	    src/beziercurveitem.cpp \
 	    src/textpolygonitem.cpp \
-    src/attributestoggleritem.cpp
+    src/attributestoggleritem.cpp \
+    src/relationshipbundleitem.cpp
 
 unix|windows: LIBS += -L$$OUT_PWD/../libpgmodeler/ -lpgmodeler \
                     -L$$OUT_PWD/../libparsers/ -lparsers \
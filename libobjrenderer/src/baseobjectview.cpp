@@ -594,8 +594,14 @@ void BaseObjectView::setLayer(unsigned layer)
 {
 	BaseGraphicObject *graph_obj = dynamic_cast<BaseGraphicObject *>(this->getUnderlyingObject());
 
+	ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
+
 	if(graph_obj)
 		graph_obj->setLayer(layer);
+
+	//Keeping the scene's layers index in sync
+	if(scene)
+		scene->updateLayerIndex(this);
 }
 
 unsigned BaseObjectView::getLayer(void)
@@ -17,6 +17,7 @@
 */
 
 #include "basetableview.h"
+#include "schemaview.h"
 
 bool BaseTableView::hide_ext_attribs = false;
 bool BaseTableView::hide_tags = false;
@@ -139,7 +140,20 @@ QVariant BaseTableView::itemChange(GraphicsItemChange change, const QVariant &va
 	}
 
 	if(change==ItemPositionHasChanged)
+	{
+		Schema *schema=dynamic_cast<Schema *>(this->getUnderlyingObject()->getSchema());
+
+		//Keeping the schema box in sync with the object while it's being dragged
+		if(schema)
+		{
+			SchemaView *sch_view=dynamic_cast<SchemaView *>(schema->getOverlyingObject());
+
+			if(sch_view)
+				sch_view->updateChildGeometry(this);
+		}
+
 		emit s_objectMoved();
+	}
 
 	BaseObjectView::itemChange(change, value);
 	return(value);
@@ -509,8 +523,15 @@ void BaseTableView::finishGeometryUpdate(void)
 	// Using a single shot time to restore the selectable flag
 	QTimer::singleShot(300, [&]{ this->setFlag(QGraphicsItem::ItemIsSelectable, true); });
 
-	//Updating the schema box that holds the object (if visible)
-	dynamic_cast<Schema *>(this->getUnderlyingObject()->getSchema())->setModified(true);
+	//Updating the schema box that holds the object (if visible) without fetching its children again
+	Schema *schema=dynamic_cast<Schema *>(this->getUnderlyingObject()->getSchema());
+	SchemaView *sch_view=(schema ? dynamic_cast<SchemaView *>(schema->getOverlyingObject()) : nullptr);
+
+	if(sch_view)
+	{
+		sch_view->updateChildGeometry(this);
+		sch_view->refreshBox();
+	}
 }
 
 bool BaseTableView::configurePaginationParams(unsigned section_id, unsigned total_attrs, unsigned &start_attr, unsigned &end_attr)
@@ -181,7 +181,7 @@ void ObjectsScene::removeLayer(const QString &name)
 
 void ObjectsScene::removeLayers(void)
 {
-	BaseObjectView *obj_view = nullptr;
+	QList<BaseObjectView *> obj_views;
 	QString def_layer = layers[DefaultLayer];
 	bool is_active = active_layers.contains(def_layer);
 
@@ -192,15 +192,18 @@ void ObjectsScene::removeLayers(void)
 	if(is_active)
 		active_layers.push_back(def_layer);
 
-	for(auto &item : this->items())
+	validateLayerIndex(obj_views);
+
+	for(auto &itr : layer_views)
 	{
-		obj_view = dynamic_cast<BaseObjectView *>(item);
+		if(itr.first != DefaultLayer)
+			obj_views.append(itr.second.toList());
+	}
 
-		if(obj_view && !obj_view->parentItem() && obj_view->getLayer() != DefaultLayer)
-		{
-			obj_view->setLayer(DefaultLayer);
-			obj_view->setVisible(is_active);
-		}
+	for(auto &obj_view : obj_views)
+	{
+		obj_view->setLayer(DefaultLayer);
+		updateLayerIndex(obj_view);
 	}
 
 	emit s_layersChanged();
@@ -225,75 +228,134 @@ void ObjectsScene::setActiveLayers(QStringList act_layers)
 
 void ObjectsScene::setActiveLayers(QList<unsigned> layers_idxs)
 {
-	BaseObjectView *obj_view = nullptr;
+	QList<BaseObjectView *> obj_views;
+	QList<unsigned> curr_idxs = getActiveLayersIds();
+	unsigned layer_cnt = static_cast<unsigned>(layers.size());
+
 	active_layers.clear();
 
-	if(!layers_idxs.isEmpty())
+	for(auto &idx : layers_idxs)
 	{
-		bool is_in_layer = false;
-		unsigned layer_cnt = static_cast<unsigned>(layers.size());
-		SchemaView *sch_view = nullptr;
-
-		for(auto &item : this->items())
-		{
-			obj_view = dynamic_cast<BaseObjectView *>(item);
-
-			if(obj_view && !obj_view->parentItem() && obj_view->getLayer() < layer_cnt)
-			{
-				sch_view = dynamic_cast<SchemaView *>(obj_view);
-				is_in_layer = layers_idxs.contains(obj_view->getLayer());
+		if(idx < layer_cnt && !active_layers.contains(layers[idx]))
+			active_layers.push_back(layers[idx]);
+	}
 
-				if(!obj_view->isVisible() && is_in_layer)
-				{
-					if(!sch_view ||
-						 (sch_view && dynamic_cast<Schema *>(sch_view->getUnderlyingObject())->isRectVisible()))
-					 obj_view->setVisible(true);
-				}
-				else if(obj_view->isVisible() && !is_in_layer)
-					obj_view->setVisible(false);
-			}
-		}
+	validateLayerIndex(obj_views);
 
-		for(auto &idx : layers_idxs)
-		{
-			if(idx < layer_cnt)
-				active_layers.push_back(layers[idx]);
-		}
-	}
-	else
+	/* Only the objects in the layers which activation state has changed
+	 * (and the ones that were reindexed) need to have their visibility updated */
+	for(auto &itr : layer_views)
 	{
-		for(auto &item : this->items())
-		{
-			obj_view = dynamic_cast<BaseObjectView *>(item);
-
-			if(obj_view && !obj_view->parentItem())
-				obj_view->setVisible(false);
-		}
+		if(curr_idxs.contains(itr.first) != isLayerActive(itr.first))
+			obj_views.append(itr.second.toList());
 	}
 
+	updateViewsVisibility(obj_views);
 	emit s_activeLayersChanged();
 }
 
 void ObjectsScene::moveObjectsToLayer(unsigned old_layer, unsigned new_layer)
 {
-	BaseObjectView *obj_view = nullptr;
+	QList<BaseObjectView *> obj_views, reindexed_views;
 	unsigned total_layers = layers.size();
 
 	if(old_layer == new_layer || old_layer >= total_layers || new_layer >= total_layers)
 		return;
 
-	for(auto &item : this->items())
+	validateLayerIndex(reindexed_views);
+
+	if(layer_views.count(old_layer))
+		obj_views = layer_views[old_layer].toList();
+
+	for(auto &obj_view : obj_views)
 	{
-		obj_view = dynamic_cast<BaseObjectView *>(item);
+		obj_view->setLayer(new_layer);
+		updateLayerIndex(obj_view);
+	}
+
+	updateViewsVisibility(obj_views + reindexed_views);
+	emit s_objectsMovedLayer();
+}
+
+void ObjectsScene::updateLayerIndex(BaseObjectView *obj_view)
+{
+	if(!obj_view || obj_view->parentItem())
+		return;
+
+	unsigned layer = obj_view->getLayer();
+
+	if(views_layer.contains(obj_view))
+	{
+		if(views_layer[obj_view] == layer)
+			return;
+
+		layer_views[views_layer[obj_view]].remove(obj_view);
+	}
+
+	views_layer[obj_view] = layer;
+	layer_views[layer].insert(obj_view);
+}
+
+void ObjectsScene::removeFromLayerIndex(BaseObjectView *obj_view)
+{
+	if(!views_layer.contains(obj_view))
+		return;
+
+	layer_views[views_layer[obj_view]].remove(obj_view);
+	views_layer.remove(obj_view);
+}
+
+void ObjectsScene::validateLayerIndex(QList<BaseObjectView *> &reindexed_views)
+{
+	QList<BaseObjectView *> obj_views;
+
+	for(auto itr = views_layer.begin(); itr != views_layer.end(); itr++)
+	{
+		if(itr.key()->getLayer() != itr.value())
+			obj_views.append(itr.key());
+	}
+
+	for(auto &obj_view : obj_views)
+		updateLayerIndex(obj_view);
+
+	reindexed_views.append(obj_views);
+}
+
+void ObjectsScene::updateViewsVisibility(const QList<BaseObjectView *> &obj_views)
+{
+	SchemaView *sch_view = nullptr;
+	unsigned layer_cnt = static_cast<unsigned>(layers.size());
+	bool is_active = false;
+
+	if(obj_views.isEmpty())
+		return;
+
+	for(auto &view : this->views())
+		view->setUpdatesEnabled(false);
+
+	for(auto &obj_view : obj_views)
+	{
+		//Objects referencing an unknown layer are left untouched
+		if(obj_view->getLayer() >= layer_cnt)
+			continue;
 
-		if(obj_view && !obj_view->parentItem() && obj_view->getLayer() == old_layer)
+		is_active = isLayerActive(obj_view->getLayer());
+
+		if(!obj_view->isVisible() && is_active)
 		{
-			obj_view->setLayer(new_layer);
-			obj_view->setVisible(isLayerActive(layers[new_layer]));
+			sch_view = dynamic_cast<SchemaView *>(obj_view);
+
+			if(!sch_view || dynamic_cast<Schema *>(sch_view->getUnderlyingObject())->isRectVisible())
+				obj_view->setVisible(true);
 		}
+		else if(obj_view->isVisible() && !is_active)
+			obj_view->setVisible(false);
 	}
 
-	emit s_objectsMovedLayer();
+	for(auto &view : this->views())
+		view->setUpdatesEnabled(true);
+
+	this->update();
 }
 
 bool ObjectsScene::isLayerActive(const QString &name)
@@ -337,7 +399,60 @@ unsigned ObjectsScene::getLayerId(const QString &name)
 
 void ObjectsScene::updateActiveLayers(void)
 {
-	setActiveLayers(active_layers);
+	QList<BaseObjectView *> obj_views;
+
+	validateLayerIndex(obj_views);
+	updateViewsVisibility(views_layer.keys());
+	emit s_activeLayersChanged();
+}
+
+size_t ObjectsScene::getItemsMemoryUsage(map<ObjectType, unsigned> &item_count, map<ObjectType, size_t> &items_usage)
+{
+	BaseObjectView *obj_view=nullptr;
+	ObjectType obj_type;
+	size_t size=0, total=0;
+	unsigned count=0;
+
+	item_count.clear();
+	items_usage.clear();
+
+	for(auto &item : this->items())
+	{
+		//Only top level items are accounted since the children items are handled recursively
+		if(item->parentItem())
+			continue;
+
+		obj_view=dynamic_cast<BaseObjectView *>(item);
+		obj_type=(obj_view && obj_view->getUnderlyingObject() ?
+								obj_view->getUnderlyingObject()->getObjectType() : ObjectType::BaseObject);
+
+		count=0;
+		size=getItemMemoryUsage(item, count);
+		item_count[obj_type]+=count;
+		items_usage[obj_type]+=size;
+		total+=size;
+	}
+
+	return(total);
+}
+
+size_t ObjectsScene::getItemMemoryUsage(QGraphicsItem *item, unsigned &item_count)
+{
+	QGraphicsSimpleTextItem *text_item=dynamic_cast<QGraphicsSimpleTextItem *>(item);
+	QGraphicsPolygonItem *pol_item=dynamic_cast<QGraphicsPolygonItem *>(item);
+	size_t size=EstimatedItemSize;
+
+	item_count++;
+
+	if(text_item)
+		size+=MemoryUsage::getStringSize(text_item->text());
+	else if(pol_item)
+		size+=static_cast<size_t>(pol_item->polygon().capacity()) * sizeof(QPointF);
+
+	for(auto &child : item->childItems())
+		size+=getItemMemoryUsage(child, item_count);
+
+	return(size);
 }
 
 void ObjectsScene::setEnableCornerMove(bool enable)
@@ -678,6 +793,7 @@ void ObjectsScene::addItem(QGraphicsItem *item)
 		if(obj)
 		{
 			obj->setVisible(isLayerActive(obj->getLayer()));
+			updateLayerIndex(obj);
 			connect(obj, SIGNAL(s_objectSelected(BaseGraphicObject*,bool)), this, SLOT(handleObjectSelection(BaseGraphicObject*,bool)));
 		}
 
@@ -701,6 +817,7 @@ void ObjectsScene::removeItem(QGraphicsItem *item)
 
 		if(object)
 		{
+			removeFromLayerIndex(object);
 			disconnect(object, nullptr, this, nullptr);
 			disconnect(object, nullptr, dynamic_cast<BaseGraphicObject*>(object->getUnderlyingObject()), nullptr);
 			disconnect(dynamic_cast<BaseGraphicObject*>(object->getUnderlyingObject()), nullptr, object, nullptr);
@@ -709,6 +826,23 @@ void ObjectsScene::removeItem(QGraphicsItem *item)
 	}
 }
 
+void ObjectsScene::destroyItem(BaseObjectView *object)
+{
+	if(!object)
+		return;
+
+	BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(object->getUnderlyingObject());
+
+	removeItem(object);
+	removed_objs.erase(std::remove(removed_objs.begin(), removed_objs.end(), object), removed_objs.end());
+	tabs_sel_children.removeAll(dynamic_cast<BaseTableView *>(object));
+
+	if(graph_obj)
+		graph_obj->setReceiverObject(nullptr);
+
+	delete(object);
+}
+
 void ObjectsScene::blockItemsSignals(bool block)
 {
 	BaseObjectView *obj_view = nullptr;
@@ -1119,9 +1253,9 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 	vector<QPointF> points;
 	vector<QPointF>::iterator itr;
 	vector<BaseObject *> rels, base_rels;
-	QSet<Schema *> schemas;
+	QSet<SchemaView *> schemas;
 	BaseRelationship *base_rel=nullptr;
-	RelationshipView *rel=nullptr;
+	RelationshipView *rel=nullptr, *rel_view=nullptr;
 	BaseObjectView *obj_view=nullptr;
 	BaseTableView *tab_view=nullptr;
 	TableObjectView *tab_obj_view=nullptr;
@@ -1159,12 +1293,13 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 				for(auto &rel : rels)
 				{
 					base_rel=dynamic_cast<BaseRelationship *>(rel);
+					rel_view=dynamic_cast<RelationshipView *>(base_rel->getOverlyingObject());
 
 					/* If the relationship contains points and it is not selected then it will be included on the list
-						 in order to move their custom line points */
-					if(!dynamic_cast<RelationshipView *>(base_rel->getOverlyingObject())->isSelected() &&
-							!base_rel->getPoints().empty())
-						rel_list.push_back(dynamic_cast<QGraphicsItem *>(base_rel->getOverlyingObject()));
+						 in order to move their custom line points. Relationships attached to collapsed schemas have no
+						 graphical representation, their points are handled by the schema view itself */
+					if(rel_view && !rel_view->isSelected() && !base_rel->getPoints().empty())
+						rel_list.push_back(rel_view);
 				}
 
 				tables.unite(sch_view->getChildren().toSet());
@@ -1262,18 +1397,21 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 
 		//Realign tables if the parent schema had the position adjusted too
 		if(align_objs_grid)
-		{
 			tab_view->setPos(alignPointToGrid(tab_view->pos()));
-			schemas.insert(dynamic_cast<Schema *>(tab_view->getUnderlyingObject()->getSchema()));
-		}
+
+		/* The children geometry of the schema is already kept in sync while the tables are moved
+		 * so we only need to flush the box refresh instead of fetching the schema's children again */
+		sch_view=dynamic_cast<SchemaView *>(tab_view->getUnderlyingObject()->getSchema()->getOverlyingObject());
+		if(sch_view)
+			schemas.insert(sch_view);
 
 		if(BaseObjectView::isPlaceholderEnabled())
 			tab_view->requestRelationshipsUpdate();
 	}
 
 	//Updating schemas bounding rects after moving objects
-	for(auto &obj : schemas)
-		obj->setModified(true);
+	for(auto &sch : schemas)
+		sch->refreshBox();
 
 	emit s_objectsMoved(true);
 	moving_objs=false;
@@ -1288,7 +1426,7 @@ void ObjectsScene::alignObjectsToGrid(void)
 	BaseTableView *tab=nullptr;
 	TextboxView *lab=nullptr;
 	vector<QPointF> points;
-	vector<Schema *> schemas;
+	vector<SchemaView *> schemas;
 	unsigned i, count, i1, count1;
 
 	count=items.size();
@@ -1327,14 +1465,14 @@ void ObjectsScene::alignObjectsToGrid(void)
 			else if(!dynamic_cast<SchemaView *>(items[i]))
 				items[i]->setPos(this->alignPointToGrid(items[i]->pos()));
 			else
-				schemas.push_back(dynamic_cast<Schema *>(dynamic_cast<BaseObjectView *>(items[i])->getUnderlyingObject()));
+				schemas.push_back(dynamic_cast<SchemaView *>(items[i]));
 		}
 	}
 
 	//Updating schemas dimensions
 	while(!schemas.empty())
 	{
-		schemas.back()->setModified(true);
+		schemas.back()->refreshBox();
 		schemas.pop_back();
 	}
 }
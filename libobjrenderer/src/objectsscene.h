@@ -42,6 +42,13 @@ class ObjectsScene: public QGraphicsScene {
 
 		vector<BaseObjectView *> removed_objs;
 
+		/*! \brief Indexes the top-level object views by layer so the layer operations don't need to iterate
+		 * over all the scene items (including the children ones) to find the objects of a certain layer */
+		map<unsigned, QSet<BaseObjectView *>> layer_views;
+
+		//! \brief Holds the layer in which each top-level object view is currently indexed
+		QHash<BaseObjectView *, unsigned> views_layer;
+
 		//! \brief Holds the tables/views which have selected children objects
 		QList<BaseTableView *> tabs_sel_children;
 
@@ -130,6 +137,20 @@ class ObjectsScene: public QGraphicsScene {
 
 		void clearTablesChildrenSelection(void);
 
+		//! \brief Removes the object view from the layers index
+		void removeFromLayerIndex(BaseObjectView *obj_view);
+
+		/*! \brief Moves to the correct layer bucket the views which object had the layer changed without the scene's knowledge
+		 * (e.g. when restoring objects from the operation history). The views reindexed are appended to the provided list */
+		void validateLayerIndex(QList<BaseObjectView *> &reindexed_views);
+
+		/*! \brief Sets the visibility of the provided views according to the activation state of their layers.
+		 * The scene is updated only once after all the views have their visibility changed */
+		void updateViewsVisibility(const QList<BaseObjectView *> &obj_views);
+
+		//! \brief Returns an estimation of the memory (in bytes) held by the provided item and all its descendants. The item count is incremented
+		size_t getItemMemoryUsage(QGraphicsItem *item, unsigned &item_count);
+
 	protected:
 		//! \brief Brush used to draw the grid over the scene
 		static QBrush grid;
@@ -150,6 +171,10 @@ class ObjectsScene: public QGraphicsScene {
 		static constexpr unsigned DefaultLayer = 0,
 		InvalidLayer = UINT_MAX;
 
+		/*! \brief Estimated amount of bytes allocated by Qt for each graphics item (the item's class and its private data).
+		 * This value is used as the fixed portion of the scene items memory footprint estimation */
+		static constexpr size_t EstimatedItemSize = 320;
+
 		ObjectsScene(void);
 		~ObjectsScene(void);
 
@@ -198,6 +223,16 @@ class ObjectsScene: public QGraphicsScene {
 		//! \brief This method causes objects in the active layers to have their visibility state updated.
 		void updateActiveLayers(void);
 
+		/*! \brief Updates the layers index entry of the provided view. This method must be called when the layer of
+		 * an object in the scene is changed so it is listed in the right layer */
+		void updateLayerIndex(BaseObjectView *obj_view);
+
+		/*! \brief Estimates the memory footprint of the graphical items in the scene grouped by the type of the object they represent.
+		 * The map item_count receives the amount of graphics items (including the children items) used to draw the objects of each type
+		 * while items_usage receives the estimated amount of bytes. Items not related to database objects are accounted as ObjectType::BaseObject.
+		 * The returned value is the total of bytes of all items */
+		size_t getItemsMemoryUsage(map<ObjectType, unsigned> &item_count, map<ObjectType, size_t> &items_usage);
+
 		static void setEnableCornerMove(bool enable);
 		static void setInvertRangeSelectionTrigger(bool invert);
 		static bool isCornerMoveEnabled(void);
@@ -217,6 +252,12 @@ class ObjectsScene: public QGraphicsScene {
 
 		void addItem(QGraphicsItem *item);
 		void removeItem(QGraphicsItem *item);
+
+		/*! \brief Removes the object view from the scene and destroys it immediately, unlinking it from the
+		 * source object, instead of deferring its destruction to the scene's destructor like removeItem() does.
+		 * Used when the graphical representation of an object must be released while the object still exists in the model */
+		void destroyItem(BaseObjectView *object);
+
 		void setSceneRect(const QRectF &rect);
 
 		//! \brief Aligns the specified point in relation to the grid
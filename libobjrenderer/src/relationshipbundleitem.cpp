@@ -0,0 +1,194 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "relationshipbundleitem.h"
+
+RelationshipBundleItem::RelationshipBundleItem(BaseObjectView *object1, BaseObjectView *object2, const vector<BaseRelationship *> &rels) : QGraphicsItemGroup()
+{
+	QStringList rel_names;
+	QFont font;
+	QPen pen=BaseObjectView::getBorderStyle(Attributes::Relationship);
+
+	objects[0]=object1;
+	objects[1]=object2;
+	rels_count=rels.size();
+
+	for(auto &rel : rels)
+		rel_names.append(rel->getName());
+
+	line=new QGraphicsLineItem;
+	pen.setWidthF(BaseObjectView::getScreenDpiFactor() * (rels_count > 1 ? 2 : 1));
+	pen.setStyle(Qt::DashLine);
+	line->setPen(pen);
+	line->setZValue(0);
+
+	font=BaseObjectView::getFontStyle(Attributes::Global).font();
+	font.setBold(true);
+
+	count_lbl=new TextPolygonItem;
+	count_lbl->setFont(font);
+	count_lbl->setText(QString::number(rels_count));
+	count_lbl->setTextBrush(BaseObjectView::getFontStyle(Attributes::Global).foreground());
+	count_lbl->setBrush(BaseObjectView::getFillStyle(Attributes::Relationship));
+	count_lbl->setPen(BaseObjectView::getBorderStyle(Attributes::Relationship));
+	count_lbl->setZValue(1);
+
+	this->addToGroup(line);
+	this->addToGroup(count_lbl);
+	this->setZValue(-1);
+	this->setToolTip(rel_names.join(QChar('\n')));
+
+	for(auto obj : { object1, object2 })
+	{
+		connect(obj, SIGNAL(s_objectMoved(void)), this, SLOT(configureLine(void)));
+		connect(obj, SIGNAL(s_objectDimensionChanged(void)), this, SLOT(configureLine(void)));
+	}
+
+	configureLine();
+}
+
+RelationshipBundleItem::~RelationshipBundleItem(void)
+{
+	this->removeFromGroup(line);
+	this->removeFromGroup(count_lbl);
+	delete(line);
+	delete(count_lbl);
+}
+
+vector<RelationshipBundleItem *> RelationshipBundleItem::createBundles(DatabaseModel *model)
+{
+	map<pair<BaseObjectView *, BaseObjectView *>, vector<BaseRelationship *>> rels_map;
+	vector<RelationshipBundleItem *> bundles;
+	BaseRelationship *rel=nullptr;
+	BaseTable *table=nullptr;
+	BaseObjectView *ends[2];
+
+	if(!model)
+		return(bundles);
+
+	for(auto type : { ObjectType::Relationship, ObjectType::BaseRelationship })
+	{
+		for(auto &obj : *model->getObjectList(type))
+		{
+			rel=dynamic_cast<BaseRelationship *>(obj);
+
+			//Relationships with their own graphical representation are not bundled
+			if(rel->getOverlyingObject())
+				continue;
+
+			for(unsigned id=BaseRelationship::SrcTable; id <= BaseRelationship::DstTable; id++)
+			{
+				table=rel->getTable(id);
+				ends[id]=nullptr;
+
+				if(!table)
+					continue;
+
+				//Tables/views of collapsed schemas are represented by the schema box
+				ends[id]=dynamic_cast<BaseObjectView *>(table->getOverlyingObject());
+
+				if(!ends[id] && table->getSchema())
+					ends[id]=dynamic_cast<BaseObjectView *>(dynamic_cast<BaseGraphicObject *>(table->getSchema())->getOverlyingObject());
+			}
+
+			if(!ends[0] || !ends[1] || ends[0]==ends[1])
+				continue;
+
+			if(ends[0] > ends[1])
+				std::swap(ends[0], ends[1]);
+
+			rels_map[make_pair(ends[0], ends[1])].push_back(rel);
+		}
+	}
+
+	for(auto &itr : rels_map)
+		bundles.push_back(new RelationshipBundleItem(itr.first.first, itr.first.second, itr.second));
+
+	return(bundles);
+}
+
+unsigned RelationshipBundleItem::getRelationshipsCount(void)
+{
+	return(rels_count);
+}
+
+bool RelationshipBundleItem::isObjectConnected(BaseObjectView *object)
+{
+	return(object && (objects[0]==object || objects[1]==object));
+}
+
+QRectF RelationshipBundleItem::boundingRect(void) const
+{
+	return(bounding_rect);
+}
+
+QPointF RelationshipBundleItem::getBorderPoint(const QRectF &rect, const QLineF &line)
+{
+	QPointF pnt;
+	QLineF edges[4]={ QLineF(rect.topLeft(), rect.topRight()), QLineF(rect.topRight(), rect.bottomRight()),
+										QLineF(rect.bottomRight(), rect.bottomLeft()), QLineF(rect.bottomLeft(), rect.topLeft()) };
+
+	for(auto &edge : edges)
+	{
+		if(line.intersect(edge, &pnt)==QLineF::BoundedIntersection)
+			return(pnt);
+	}
+
+	return(rect.center());
+}
+
+void RelationshipBundleItem::configureLine(void)
+{
+	QRectF rects[2], lbl_rect;
+	QLineF center_line;
+	QPolygonF pol;
+	QPointF mid_pnt;
+
+	//One of the connected objects was destroyed, the bundle will be discarded in the next bundles update
+	if(!objects[0] || !objects[1])
+	{
+		this->setVisible(false);
+		return;
+	}
+
+	for(unsigned i=0; i < 2; i++)
+		rects[i]=objects[i]->mapRectToScene(objects[i]->boundingRect());
+
+	center_line.setPoints(rects[0].center(), rects[1].center());
+	line->setLine(QLineF(getBorderPoint(rects[0], center_line),
+											 getBorderPoint(rects[1], QLineF(rects[1].center(), rects[0].center()))));
+
+	//Placing the count label at the middle of the line
+	lbl_rect=count_lbl->getTextBoundingRect();
+	lbl_rect.setWidth(lbl_rect.width() + (4 * BaseObjectView::HorizSpacing));
+	lbl_rect.setHeight(lbl_rect.height() + (2 * BaseObjectView::VertSpacing));
+	pol.append(lbl_rect.topLeft());
+	pol.append(lbl_rect.topRight());
+	pol.append(lbl_rect.bottomRight());
+	pol.append(lbl_rect.bottomLeft());
+	count_lbl->setPolygon(pol);
+	count_lbl->setTextPos(2 * BaseObjectView::HorizSpacing, BaseObjectView::VertSpacing);
+
+	mid_pnt=line->line().pointAt(0.5);
+	count_lbl->setPos(mid_pnt.x() - (lbl_rect.width()/2), mid_pnt.y() - (lbl_rect.height()/2));
+
+	this->prepareGeometryChange();
+	bounding_rect=line->boundingRect().united(count_lbl->mapRectToParent(count_lbl->boundingRect()));
+
+	this->setVisible(objects[0]->isVisible() && objects[1]->isVisible());
+}
@@ -0,0 +1,81 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libobjrenderer
+\class RelationshipBundleItem
+\brief Implements a lightweight item that represents, as a single line, all the relationships connecting
+two objects in the scene when at least one of them is a collapsed schema
+*/
+
+#ifndef RELATIONSHIP_BUNDLE_ITEM_H
+#define RELATIONSHIP_BUNDLE_ITEM_H
+
+#include <QObject>
+#include <QPointer>
+#include "baseobjectview.h"
+#include "textpolygonitem.h"
+#include "databasemodel.h"
+
+class RelationshipBundleItem: public QObject, public QGraphicsItemGroup {
+	private:
+		Q_OBJECT
+
+		//! \brief Stores the objects (collapsed schemas or tables/views) connected by the bundle
+		QPointer<BaseObjectView> objects[2];
+
+		//! \brief Line drawn between the connected objects
+		QGraphicsLineItem *line;
+
+		//! \brief Label that displays the amount of relationships represented by the bundle
+		TextPolygonItem *count_lbl;
+
+		//! \brief Stores the amount of relationships represented by the bundle
+		unsigned rels_count;
+
+		//! \brief Stores the bounding rect of the line and label
+		QRectF bounding_rect;
+
+		//! \brief Returns the point where the provided line (starting at the rectangle's center) crosses the rectangle borders
+		static QPointF getBorderPoint(const QRectF &rect, const QLineF &line);
+
+	public:
+		RelationshipBundleItem(BaseObjectView *object1, BaseObjectView *object2, const vector<BaseRelationship *> &rels);
+		~RelationshipBundleItem(void);
+
+		//! \brief Returns the amount of relationships represented by the bundle
+		unsigned getRelationshipsCount(void);
+
+		//! \brief Returns if the provided object is one of the bundle's ends
+		bool isObjectConnected(BaseObjectView *object);
+
+		QRectF boundingRect(void) const;
+
+		/*! \brief Creates the bundles for all relationships of the model which have no graphical representation
+		 * because they are connected to tables/views of collapsed schemas. The relationships are grouped by the objects
+		 * they visually connect (the collapsed schemas boxes or the tables/views themselves) so each pair of objects
+		 * is linked by a single bundle. Relationships between children of the same collapsed schema are not represented.
+		 * The returned items must be added to the scene by the caller */
+		static vector<RelationshipBundleItem *> createBundles(DatabaseModel *model);
+
+	public slots:
+		//! \brief Configures the line and count label based upon the current position of the connected objects
+		void configureLine(void);
+};
+
+#endif
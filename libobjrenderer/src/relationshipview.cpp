@@ -17,6 +17,7 @@
 */
 
 #include "relationshipview.h"
+#include "stallwatchdog.h"
 
 bool RelationshipView::hide_name_label=false;
 bool RelationshipView::use_curved_lines=true;
@@ -573,6 +574,8 @@ void RelationshipView::configurePositionInfo(void)
 
 void RelationshipView::configureLine(void)
 {
+	StallMarker stall_marker(__PRETTY_FUNCTION__);
+
 	//Reconnect the tables is the placeholder usage changes
 	if(using_placeholders!=BaseObjectView::isPlaceholderEnabled())
 	{
@@ -26,6 +26,10 @@ SchemaView::SchemaView(Schema *schema) : BaseObjectView(schema)
 	sch_name=new QGraphicsSimpleTextItem;
 	sch_name->setZValue(1);
 
+	children_info=new QGraphicsSimpleTextItem;
+	children_info->setZValue(1);
+	children_info->setVisible(false);
+
 	box=new RoundedRectItem;
 	box->setZValue(0);
 
@@ -36,8 +40,15 @@ SchemaView::SchemaView(Schema *schema) : BaseObjectView(schema)
 
 	this->addToGroup(box);
 	this->addToGroup(sch_name);
+	this->addToGroup(children_info);
 	this->setZValue(-5);
 
+	bounds_invalidated=false;
+	refresh_timer.setSingleShot(true);
+	refresh_timer.setInterval(RefreshInterval);
+
+	connect(&refresh_timer, &QTimer::timeout, [&](){ refreshBox(); });
+
 	this->configureObject();
 	all_selected=false;
 
@@ -48,9 +59,11 @@ SchemaView::~SchemaView(void)
 {
 	this->removeFromGroup(box);
 	this->removeFromGroup(sch_name);
+	this->removeFromGroup(children_info);
 
 	delete(box);
 	delete(sch_name);
+	delete(children_info);
 }
 
 void SchemaView::mousePressEvent(QGraphicsSceneMouseEvent *event)
@@ -77,20 +90,165 @@ void SchemaView::fetchChildren(void)
 	DatabaseModel *model=dynamic_cast<DatabaseModel *>(schema->getDatabase());
 	vector<BaseObject *> objs, list;
 	vector<ObjectType> types = { ObjectType::Table, ObjectType::ForeignTable, ObjectType::View };
+	BaseGraphicObject *graph_obj=nullptr;
+	BaseObjectView *obj_view=nullptr;
+	BaseRelationship *rel=nullptr;
+	QPointF pos;
+
+	children_count.clear();
 
 	//Gets all tables and views that belongs to the schema
 	for(auto &type : types)
 	{
 		list = model->getObjects(type, schema);
+		children_count[type]=list.size();
 		objs.insert(objs.end(), list.begin(), list.end());
 	}
 
 	children.clear();
+	children_rects.clear();
+	children_objs.clear();
+	inner_rels.clear();
+	collapsed_pos=QPointF(DNaN, DNaN);
+
 	while(!objs.empty())
 	{
-		children.push_front(dynamic_cast<BaseObjectView *>(dynamic_cast<BaseGraphicObject *>(objs.back())->getOverlyingObject()));
+		graph_obj=dynamic_cast<BaseGraphicObject *>(objs.back());
+		obj_view=dynamic_cast<BaseObjectView *>(graph_obj->getOverlyingObject());
+		children_objs.insert(children_objs.begin(), graph_obj);
+
+		/* Children of collapsed schemas have no graphical representation so only their positions
+		 * are used to determine where the collapsed schema box is placed */
+		if(obj_view)
+		{
+			children.push_front(obj_view);
+			children_rects[obj_view]=getChildRect(obj_view);
+		}
+		else
+		{
+			pos=graph_obj->getPosition();
+
+			if(std::isnan(collapsed_pos.x()) || pos.x() < collapsed_pos.x())
+				collapsed_pos.setX(pos.x());
+
+			if(std::isnan(collapsed_pos.y()) || pos.y() < collapsed_pos.y())
+				collapsed_pos.setY(pos.y());
+		}
+
 		objs.pop_back();
 	}
+
+	if(schema->isCollapsed())
+	{
+		for(auto type : { ObjectType::Relationship, ObjectType::BaseRelationship })
+		{
+			for(auto &obj : model->getObjects(type, schema))
+			{
+				rel=dynamic_cast<BaseRelationship *>(obj);
+
+				if(!rel->getPoints().empty() &&
+					 rel->getTable(BaseRelationship::SrcTable)->getSchema()==schema &&
+					 rel->getTable(BaseRelationship::DstTable)->getSchema()==schema)
+					inner_rels.push_back(rel);
+			}
+		}
+	}
+
+	updateChildrenBounds();
+}
+
+QRectF SchemaView::getChildRect(BaseObjectView *child)
+{
+	return(QRectF(child->pos(), child->boundingRect().size()));
+}
+
+void SchemaView::updateChildrenBounds(void)
+{
+	children_bounds=QRectF();
+
+	for(auto &rect : children_rects)
+		children_bounds=(children_bounds.isNull() ? rect : children_bounds.united(rect));
+
+	bounds_invalidated=false;
+}
+
+void SchemaView::translateChildrenGeometry(double dx, double dy)
+{
+	for(auto &rect : children_rects)
+		rect.translate(dx, dy);
+
+	children_bounds.translate(dx, dy);
+}
+
+void SchemaView::translateCollapsedChildren(double dx, double dy)
+{
+	vector<QPointF> points;
+
+	for(auto &obj : children_objs)
+		obj->setPosition(obj->getPosition() + QPointF(dx, dy));
+
+	for(auto &rel : inner_rels)
+	{
+		points=rel->getPoints();
+
+		for(auto &pnt : points)
+			pnt+=QPointF(dx, dy);
+
+		rel->setPoints(points);
+	}
+
+	collapsed_pos+=QPointF(dx, dy);
+}
+
+void SchemaView::updateChildGeometry(BaseObjectView *child)
+{
+	QRectF old_rect, new_rect;
+
+	/* Objects that are not known as children yet (e.g. moved to this schema recently)
+	 * are ignored here since they'll be fetched in the next call to configureObject() */
+	if(!child || !children_rects.contains(child))
+		return;
+
+	old_rect=children_rects[child];
+	new_rect=getChildRect(child);
+
+	if(old_rect==new_rect)
+		return;
+
+	children_rects[child]=new_rect;
+
+	if(!bounds_invalidated)
+	{
+		/* If the child was placed on one of the bounds edges and now it doesn't reach that edge
+		 * anymore the bounds may shrink so they need to be recalculated from scratch. Otherwise,
+		 * the new child geometry can only expand the current bounds */
+		bounds_invalidated=(old_rect.left() <= children_bounds.left() && new_rect.left() > children_bounds.left()) ||
+											 (old_rect.top() <= children_bounds.top() && new_rect.top() > children_bounds.top()) ||
+											 (old_rect.right() >= children_bounds.right() && new_rect.right() < children_bounds.right()) ||
+											 (old_rect.bottom() >= children_bounds.bottom() && new_rect.bottom() < children_bounds.bottom());
+
+		if(!bounds_invalidated)
+			children_bounds=children_bounds.united(new_rect);
+	}
+
+	if(!refresh_timer.isActive())
+		refresh_timer.start();
+}
+
+bool SchemaView::isObjectCollapsed(BaseObject *object)
+{
+	BaseRelationship *rel=dynamic_cast<BaseRelationship *>(object);
+	Schema *schema=nullptr;
+
+	if(rel)
+		return(isObjectCollapsed(rel->getTable(BaseRelationship::SrcTable)) ||
+					 isObjectCollapsed(rel->getTable(BaseRelationship::DstTable)));
+
+	if(!object || !BaseTable::isBaseTable(object->getObjectType()))
+		return(false);
+
+	schema=dynamic_cast<Schema *>(object->getSchema());
+	return(schema && schema->isCollapsed());
 }
 
 void SchemaView::selectChildren(void)
@@ -133,8 +291,17 @@ QVariant SchemaView::itemChange(QGraphicsItem::GraphicsItemChange change, const
 		double dx=pos().x() - last_pos.x(),
 				dy=pos().y() - last_pos.y();
 
-		for(auto &child : children)
-			child->moveBy(dx, dy);
+		if(dynamic_cast<Schema *>(this->getUnderlyingObject())->isCollapsed())
+			translateCollapsedChildren(dx, dy);
+		else
+		{
+			translateChildrenGeometry(dx, dy);
+
+			for(auto &child : children)
+				child->moveBy(dx, dy);
+		}
+
+		emit s_objectMoved();
 	}
 
 	return(BaseObjectView::itemChange(change, value));
@@ -150,6 +317,16 @@ QList<BaseObjectView *> SchemaView::getChildren(void)
 	return(children);
 }
 
+vector<BaseGraphicObject *> SchemaView::getChildrenObjects(void)
+{
+	return(children_objs);
+}
+
+vector<BaseRelationship *> SchemaView::getInnerRelationships(void)
+{
+	return(inner_rels);
+}
+
 void SchemaView::togglePlaceholder(bool visible)
 {
 	for(auto &obj : getChildren())
@@ -163,45 +340,76 @@ void SchemaView::moveTo(QPointF new_pos)
 
 	this->setPos(new_pos);
 
-	for(auto &child : children)
-		child->moveBy(dx, dy);
+	if(dynamic_cast<Schema *>(this->getUnderlyingObject())->isCollapsed())
+		translateCollapsedChildren(dx, dy);
+	else
+	{
+		translateChildrenGeometry(dx, dy);
+
+		for(auto &child : children)
+			child->moveBy(dx, dy);
+	}
+
+	emit s_objectMoved();
+}
+
+void SchemaView::refreshBox(void)
+{
+	refresh_timer.stop();
+
+	if(bounds_invalidated)
+		updateChildrenBounds();
+
+	configureBox();
 }
 
 void SchemaView::configureObject(void)
 {
-	Schema *schema=dynamic_cast<Schema *>(this->getUnderlyingObject());
+	//A full configuration supersedes any pending box refresh
+	refresh_timer.stop();
 	this->fetchChildren();
+	this->configureBox();
+}
+
+void SchemaView::configureBox(void)
+{
+	Schema *schema=dynamic_cast<Schema *>(this->getUnderlyingObject());
+	bool collapsed=schema->isCollapsed();
 
 	/* Only configures the schema view if the rectangle is visible and there are
-		children objects. Otherwise the schema view is hidden */
-	if(schema->isRectVisible() && !children.isEmpty())
+		children objects. Otherwise the schema view is hidden. Collapsed schemas are always
+		displayed since the box is the only representation of their children */
+	if(collapsed || (schema->isRectVisible() && !children.isEmpty()))
 	{
 		QColor color;
 		QRectF rect;
 		QFont font;
 		double sp_h=0, sp_v=0, txt_h=0;
-		double x1=1000000, y1=1000000, x2=-1000000, y2=-1000000, width=0;
-		QList<BaseObjectView *>::Iterator itr=children.begin();
-
 		//Configures the bounding rect based upon the children dimension
-		while(itr!=children.end())
+		double x1=children_bounds.left(), y1=children_bounds.top(),
+				x2=children_bounds.right(), y2=children_bounds.bottom(), width=0;
+
+		//Collapsed schemas are rendered as a box containing only the name and the amount of children
+		if(collapsed)
 		{
-			rect.setTopLeft((*itr)->pos());
-			rect.setSize((*itr)->boundingRect().size());
+			QStringList counts;
 
-			if(rect.left() < x1)
-				x1 = rect.left();
-			if(rect.right() > x2)
-				x2 = rect.right();
+			for(auto type : { ObjectType::Table, ObjectType::ForeignTable, ObjectType::View })
+			{
+				if(children_count[type] > 0)
+					counts.append(QString("%1: %2").arg(BaseObject::getTypeName(type)).arg(children_count[type]));
+			}
 
-			if(rect.top() < y1)
-				y1 = rect.top();
-			if(rect.bottom() > y2)
-				y2 = rect.bottom();
+			if(counts.isEmpty())
+				counts.append(trUtf8("No tables or views"));
 
-			itr++;
+			children_info->setText(counts.join(QChar('\n')));
+			children_info->setFont(BaseObjectView::getFontStyle(Attributes::Global).font());
+			children_info->setBrush(BaseObjectView::getFontStyle(Attributes::Global).foreground());
 		}
 
+		children_info->setVisible(collapsed);
+
 		//Configures the schema name at the top
 		sch_name->setText(compact_view && !schema->getAlias().isEmpty() ? schema->getAlias() : schema->getName());
 		font=BaseObjectView::getFontStyle(Attributes::Global).font();
@@ -217,6 +425,19 @@ void SchemaView::configureObject(void)
 		sp_h=(3 * HorizSpacing);
 		sp_v=(3 * VertSpacing) + txt_h;
 
+		if(collapsed)
+		{
+			//Empty collapsed schemas are kept at their last known position
+			if(std::isnan(collapsed_pos.x()))
+				collapsed_pos=schema->getPosition() + QPointF(sp_h, txt_h);
+
+			children_info->setPos(HorizSpacing, txt_h);
+			x1=collapsed_pos.x();
+			y1=collapsed_pos.y();
+			x2=x1 + children_info->boundingRect().width();
+			y2=y1 + children_info->boundingRect().height();
+		}
+
 		width=(x2-x1) + 1;
 
 		if(width < sch_name->boundingRect().width())
@@ -259,6 +480,8 @@ void SchemaView::configureObject(void)
 		this->configureProtectedIcon();
 		this->configurePositionInfo(this->pos());
 		this->configureSQLDisabledInfo();
+
+		emit s_objectMoved();
 	}
 	else
 		this->setVisible(false);
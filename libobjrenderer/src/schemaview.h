@@ -30,13 +30,17 @@
 #include "baseobjectview.h"
 #include "textboxview.h"
 #include "roundedrectitem.h"
+#include <QTimer>
 
 class SchemaView: public BaseObjectView
 {
 	private:
 		Q_OBJECT
 
-		QGraphicsSimpleTextItem *sch_name;
+		QGraphicsSimpleTextItem *sch_name,
+
+		//! \brief Displays the amount of tables, foreign tables and views when the schema is collapsed
+		*children_info;
 
 		RoundedRectItem *box;
 
@@ -48,6 +52,36 @@ class SchemaView: public BaseObjectView
 		//! \brief Stores the views and tables that belongs to this schema
 		QList<BaseObjectView *> children;
 
+		//! \brief Stores the tables and views that belongs to this schema (including the ones without graphical representation)
+		vector<BaseGraphicObject *> children_objs;
+
+		//! \brief Stores the amount of children objects per type
+		map<ObjectType, unsigned> children_count;
+
+		/*! \brief Stores the relationships with custom points that connect only children of this schema.
+		 * Used to translate those points when a collapsed schema is moved */
+		vector<BaseRelationship *> inner_rels;
+
+		//! \brief Stores the top-left position of the children objects when the schema is collapsed
+		QPointF collapsed_pos;
+
+		//! \brief Stores the last known rectangle (in scene coordinates) of each child object
+		QHash<BaseObjectView *, QRectF> children_rects;
+
+		//! \brief Stores the rectangle that encloses all the children objects
+		QRectF children_bounds;
+
+		/*! \brief Indicates that a child placed on one of the edges of children_bounds shrank or moved inward
+		 * so the bounds must be fully recalculated in the next box refresh */
+		bool bounds_invalidated;
+
+		/*! \brief Timer used to coalesce the several box refreshes requested while children are being
+		 * dragged into a single one per frame */
+		QTimer refresh_timer;
+
+		//! \brief Interval (in ms) between two consecutive box refreshes during objects movement (~60 fps)
+		static constexpr int RefreshInterval=16;
+
 		void mousePressEvent(QGraphicsSceneMouseEvent *event);
 		void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
 
@@ -57,6 +91,22 @@ class SchemaView: public BaseObjectView
 		//! \brief Returns if all children are selected
 		bool isChildrenSelected(void);
 
+		//! \brief Returns the rectangle (in scene coordinates) occupied by the provided child object
+		QRectF getChildRect(BaseObjectView *child);
+
+		//! \brief Recalculates the children_bounds from the cached children rectangles
+		void updateChildrenBounds(void);
+
+		//! \brief Translates the cached children geometry when the schema and its children are moved together
+		void translateChildrenGeometry(double dx, double dy);
+
+		/*! \brief Translates the position of children objects (and the points of the relationships between them)
+		 * directly in the model. Used when moving a collapsed schema since its children have no graphical representation */
+		void translateCollapsedChildren(double dx, double dy);
+
+		//! \brief Configures the schema box and name based upon the current children bounds
+		void configureBox(void);
+
 		QVariant itemChange(GraphicsItemChange change, const QVariant &value);
 
 	public:
@@ -70,12 +120,37 @@ class SchemaView: public BaseObjectView
 
 		QList<BaseObjectView *> getChildren(void);
 
+		//! \brief Returns the tables and views that belongs to the schema even if they have no graphical representation
+		vector<BaseGraphicObject *> getChildrenObjects(void);
+
+		/*! \brief Returns the relationships with custom points that connect only children of the schema.
+		 * Those points are translated together with the children when the collapsed schema is moved */
+		vector<BaseRelationship *> getInnerRelationships(void);
+
 		virtual void togglePlaceholder(bool visible);
 
 		void moveTo(QPointF new_pos);
 
+		/*! \brief Updates the box geometry after the provided child object being moved or resized.
+		 * The children bounds are expanded in place when the child enlarges them and fully recalculated
+		 * only when a child placed on one of the edges shrinks or moves inward. The box itself is refreshed
+		 * at most once per RefreshInterval */
+		void updateChildGeometry(BaseObjectView *child);
+
+		/*! \brief Immediately applies any pending box refresh scheduled by updateChildGeometry().
+		 * Unlike configureObject() the children list is not fetched again from the model */
+		void refreshBox(void);
+
+		/*! \brief Returns if the provided table/view is placed in a collapsed schema or if the provided relationship
+		 * is connected to a table/view in that situation. Those objects have no graphical representation in the scene */
+		static bool isObjectCollapsed(BaseObject *object);
+
 	public slots:
 		void configureObject(void);
+
+	signals:
+		//! \brief Signal emitted when the schema box is moved over the scene
+		void s_objectMoved(void);
 };
 
 #endif
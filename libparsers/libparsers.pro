@@ -16,11 +16,13 @@ windows: DESTDIR = $$PWD
 HEADERS += src/schemaparser.h \
 	   src/xmlparser.h \
 	   src/attribsmap.h \
-	    src/attributes.h
+	    src/attributes.h \
+	    src/sqlscriptparser.h
 
 SOURCES += src/schemaparser.cpp \
 	   src/xmlparser.cpp \
-    src/attributes.cpp
+    src/attributes.cpp \
+    src/sqlscriptparser.cpp
 
 unix|windows: LIBS += -L$$OUT_PWD/../libutils/ -lutils $$XML_LIB
 
@@ -64,6 +64,7 @@ namespace Attributes {
 	Cascade=QString("cascade"),
 	CaseSensitive=QString("case-sensitive"),
 	CastType=QString("cast-type"),
+	CatalogCacheTtl=QString("catalog-cache-ttl"),
 	Category=QString("category"),
 	Change=QString("change"),
 	Changelog=QString("changelog"),
@@ -78,6 +79,7 @@ namespace Attributes {
 	ColIndexes=QString("col-indexes"),
 	ColIsIdentity=QString("col-is-identity"),
 	CollapseMode=QString("collapse-mode"),
+	Collapsed=QString("collapsed"),
 	Collatable=QString("collatable"),
 	Collation=QString("collation"),
 	Collations=QString("collations"),
@@ -134,6 +136,7 @@ namespace Attributes {
 	Cycle=QString("cycle"),
 	Database=QString("database"),
 	DataDirectory=QString("data-directory"),
+	DataFormat=QString("data-format"),
 	Date=QString("date"),
 	DbModel=QString("dbmodel"),
 	DdlEndToken=QString("-- ddl-end --"),
@@ -479,6 +482,7 @@ namespace Attributes {
 	Replication=QString("replication"),
 	RestartSeq=QString("restart-seq"),
 	RestrictionFunc=QString("restriction"),
+	ResultsMemLimit=QString("results-mem-limit"),
 	ReturnsSetOf=QString("returns-setof"),
 	ReturnTable=QString("return-table"),
 	ReturnType=QString("return-type"),
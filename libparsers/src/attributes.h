@@ -79,6 +79,7 @@ namespace Attributes {
 	Cascade,
 	CaseSensitive,
 	CastType,
+	CatalogCacheTtl,
 	Category,
 	Change,
 	Changelog,
@@ -93,6 +94,7 @@ namespace Attributes {
 	ColIndexes,
 	ColIsIdentity,
 	CollapseMode,
+	Collapsed,
 	Collatable,
 	Collation,
 	Collations,
@@ -150,6 +152,7 @@ namespace Attributes {
 	Cycle,
 	Database,
 	DataDirectory,
+	DataFormat,
 	Date,
 	DbModel,
 	DdlEndToken,
@@ -497,6 +500,7 @@ namespace Attributes {
 	Replication,
 	RestartSeq,
 	RestrictionFunc,
+	ResultsMemLimit,
 	ReturnsSetOf,
 	ReturnTable,
 	ReturnType,
@@ -59,7 +59,6 @@ const QString SchemaParser::TokenLtOper=QString("<");
 const QString SchemaParser::TokenGtEqOper=QString(">=");
 const QString SchemaParser::TokenLtEqOper=QString("<=");
 
-const QRegExp SchemaParser::AttribRegExp=QRegExp("^([a-z])([a-z]*|(\\d)*|(\\-)*|(_)*)+", Qt::CaseInsensitive);
 
 SchemaParser::SchemaParser(void)
 {
@@ -220,6 +219,25 @@ void SchemaParser::loadFile(const QString &filename)
 	}
 }
 
+bool SchemaParser::isValidAttribute(const QString &attrib)
+{
+	char chr;
+
+	if(attrib.isEmpty())
+		return(false);
+
+	for(int i=0; i < attrib.size(); i++)
+	{
+		chr=attrib.at(i).toLatin1();
+
+		if(!((chr >= 'a' && chr <= 'z') || (chr >= 'A' && chr <= 'Z')) &&
+			 (i==0 || !((chr >= '0' && chr <= '9') || chr=='-' || chr=='_')))
+			return(false);
+	}
+
+	return(true);
+}
+
 QString SchemaParser::getAttribute(void)
 {
 	QString atrib, current_line;
@@ -270,7 +288,7 @@ QString SchemaParser::getAttribute(void)
 						.arg(filename).arg((line + comment_count + 1)).arg((column+1)),
 						ErrorCode::InvalidSyntax,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
-	else if(!AttribRegExp.exactMatch(atrib))
+	else if(!isValidAttribute(atrib))
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvalidAttribute)
 						.arg(atrib).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
@@ -663,7 +681,7 @@ void SchemaParser::defineAttribute(void)
 		attrib=(use_val_as_name ? attributes[new_attrib] : new_attrib);
 
 		//Checking if the attribute has a valid name
-		if(!AttribRegExp.exactMatch(attrib))
+		if(!isValidAttribute(attrib))
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvalidAttribute)
 							.arg(attrib).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
@@ -709,7 +727,7 @@ void SchemaParser::unsetAttribute(void)
 										.arg(attrib).arg(filename).arg((line + comment_count +1)).arg((column+1)),
 										ErrorCode::UnkownAttribute,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 					}
-					else if(!AttribRegExp.exactMatch(attrib))
+					else if(!isValidAttribute(attrib))
 					{
 						throw Exception(Exception::getErrorMessage(ErrorCode::InvalidAttribute)
 										.arg(attrib).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
@@ -1459,3 +1477,11 @@ QString SchemaParser::getCodeDefinition(const QString &filename, attribs_map &at
 		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
 }
+
+size_t SchemaParser::getMemoryUsage(void)
+{
+	return(MemoryUsage::getStringSize(filename) +
+				 MemoryUsage::getStringListSize(buffer) +
+				 MemoryUsage::getStringMapSize(attributes) +
+				 MemoryUsage::getStringSize(pgsql_version));
+}
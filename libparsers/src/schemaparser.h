@@ -34,6 +34,7 @@
 #include "xmlparser.h"
 #include "attribsmap.h"
 #include "pgsqlversions.h"
+#include "memoryusage.h"
 
 class SchemaParser {
 	private:
@@ -45,8 +46,9 @@ class SchemaParser {
 		 attributes avoiding raising exceptions */
 		bool ignore_empty_atribs;
 
-		//! \brief RegExp used to validate attribute names
-		static const QRegExp AttribRegExp;
+		/*! \brief Validates an attribute name: it must start with a letter followed by letters, digits, dashes or underscores.
+		 * This is done without a shared regular expression since schema files can be parsed by several threads at once */
+		static bool isValidAttribute(const QString &attrib);
 
 		//! \brief Get an attribute name from the buffer on the current position
 		QString getAttribute(void);
@@ -233,6 +235,9 @@ class SchemaParser {
 		//! \brief Extracts the attributes names from the currently loaded buffer
 		QStringList extractAttributes(void);
 
+		//! \brief Returns an estimation of the heap memory (in bytes) held by the parser's buffer and attributes
+		size_t getMemoryUsage(void);
+
 		/*! \brief Converts any chars (operators) < > " to the respective XML entities. This method is only
 		 * 	called when generating XML code and only tag attributes are treated.*/
 		static QString convertCharsToXMLEntities(QString buf);
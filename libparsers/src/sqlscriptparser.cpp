@@ -0,0 +1,217 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "sqlscriptparser.h"
+
+bool SQLScriptParser::isIdentifierChar(const QChar &chr)
+{
+	return(chr.isLetterOrNumber() || chr == QChar('_') || chr == QChar('$'));
+}
+
+int SQLScriptParser::skipQuoted(const QString &script, int pos, QChar quote, bool escape_str, int &line)
+{
+	int len = script.length();
+
+	for(pos++; pos < len; pos++)
+	{
+		if(script[pos] == QChar('\n'))
+			line++;
+		else if(escape_str && script[pos] == QChar('\\'))
+		{
+			if(pos + 1 < len && script[pos + 1] == QChar('\n'))
+				line++;
+
+			pos++;
+		}
+		else if(script[pos] == quote)
+		{
+			//A doubled quote is an escaped quote char and not the end of the quoted text
+			if(pos + 1 < len && script[pos + 1] == quote)
+				pos++;
+			else
+				return(pos);
+		}
+	}
+
+	return(len - 1);
+}
+
+int SQLScriptParser::skipBlockComment(const QString &script, int pos, int &line)
+{
+	int len = script.length(), depth = 0;
+
+	while(pos < len)
+	{
+		if(script[pos] == QChar('/') && pos + 1 < len && script[pos + 1] == QChar('*'))
+		{
+			depth++;
+			pos += 2;
+		}
+		else if(script[pos] == QChar('*') && pos + 1 < len && script[pos + 1] == QChar('/'))
+		{
+			depth--;
+			pos += 2;
+
+			if(depth == 0)
+				return(pos - 1);
+		}
+		else
+		{
+			if(script[pos] == QChar('\n'))
+				line++;
+
+			pos++;
+		}
+	}
+
+	return(len - 1);
+}
+
+QString SQLScriptParser::getDollarTag(const QString &script, int pos)
+{
+	int len = script.length(), end = pos + 1;
+
+	//A dollar sign in the middle of an identifier (e.g. foo$bar) never starts a dollar quote
+	if(pos > 0 && isIdentifierChar(script[pos - 1]))
+		return(QString());
+
+	//Tags follow the unquoted identifier rules but can't start with a digit nor contain dollar signs
+	if(end < len && script[end].isDigit())
+		return(QString());
+
+	while(end < len && (script[end].isLetterOrNumber() || script[end] == QChar('_')))
+		end++;
+
+	if(end < len && script[end] == QChar('$'))
+		return(script.mid(pos, end - pos + 1));
+
+	return(QString());
+}
+
+QStringList SQLScriptParser::splitStatements(const QString &script, QList<int> *start_lines)
+{
+	QStringList stmts;
+	QString dollar_tag, word, prev_word;
+	QChar chr, next_chr;
+	int len = script.length(), pos = 0, end = 0,
+			stmt_start = -1, stmt_line = 0, line = 1, paren_lvl = 0, block_lvl = 0;
+
+	if(start_lines)
+		start_lines->clear();
+
+	while(pos < len)
+	{
+		chr = script[pos];
+		next_chr = (pos + 1 < len ? script[pos + 1] : QChar());
+
+		//Line comments are skipped until the line break, which is handled in the next iteration
+		if(chr == QChar('-') && next_chr == QChar('-'))
+		{
+			while(pos < len && script[pos] != QChar('\n'))
+				pos++;
+
+			continue;
+		}
+
+		if(chr == QChar('/') && next_chr == QChar('*'))
+		{
+			pos = skipBlockComment(script, pos, line) + 1;
+			continue;
+		}
+
+		if(chr == QChar('\n'))
+			line++;
+		else if(chr == QChar(';') && paren_lvl == 0 && block_lvl == 0)
+		{
+			if(stmt_start >= 0)
+			{
+				stmts.append(script.mid(stmt_start, pos - stmt_start + 1));
+
+				if(start_lines)
+					start_lines->append(stmt_line);
+			}
+
+			stmt_start = -1;
+			prev_word.clear();
+			pos++;
+			continue;
+		}
+
+		if(stmt_start < 0 && !chr.isSpace())
+		{
+			stmt_start = pos;
+			stmt_line = line;
+		}
+
+		if(chr == QChar('\''))
+		{
+			//Escape strings (E'...') accept backslash escaped quotes
+			bool escape_str = (pos > 0 && script[pos - 1].toLower() == QChar('e') &&
+												 (pos < 2 || !isIdentifierChar(script[pos - 2])));
+
+			pos = skipQuoted(script, pos, chr, escape_str, line);
+		}
+		else if(chr == QChar('"'))
+			pos = skipQuoted(script, pos, chr, false, line);
+		else if(chr == QChar('$') && !(dollar_tag = getDollarTag(script, pos)).isEmpty())
+		{
+			end = script.indexOf(dollar_tag, pos + dollar_tag.length());
+			end = (end < 0 ? len - 1 : end + dollar_tag.length() - 1);
+			line += script.midRef(pos, end - pos + 1).count(QChar('\n'));
+			pos = end;
+		}
+		else if((chr.isLetter() || chr == QChar('_')) && (pos == 0 || !isIdentifierChar(script[pos - 1])))
+		{
+			end = pos;
+
+			while(end + 1 < len && (script[end + 1].isLetterOrNumber() || script[end + 1] == QChar('_')))
+				end++;
+
+			word = script.mid(pos, end - pos + 1).toLower();
+
+			/* SQL-standard routine bodies (BEGIN ATOMIC ... END) contain semicolon terminated statements,
+			 * the body ends in the END keyword that closes it, which is also the keyword that closes CASE expressions */
+			if(word == QString("atomic") && prev_word == QString("begin"))
+				block_lvl++;
+			else if(block_lvl > 0 && word == QString("case"))
+				block_lvl++;
+			else if(block_lvl > 0 && word == QString("end"))
+				block_lvl--;
+
+			prev_word = word;
+			pos = end;
+		}
+		else if(chr == QChar('('))
+			paren_lvl++;
+		else if(chr == QChar(')') && paren_lvl > 0)
+			paren_lvl--;
+
+		pos++;
+	}
+
+	//The last statement doesn't need to be terminated by a semicolon
+	if(stmt_start >= 0)
+	{
+		stmts.append(script.mid(stmt_start).trimmed());
+
+		if(start_lines)
+			start_lines->append(stmt_line);
+	}
+
+	return(stmts);
+}
@@ -0,0 +1,59 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libparsers
+\class SQLScriptParser
+\brief Implements a lightweight lexer that splits SQL scripts into individual statements. The lexer
+is aware of quoted strings and identifiers, escape strings, dollar quoted bodies, line/block comments
+(including nested ones), parenthesis and BEGIN ATOMIC routine bodies so semicolons inside those constructions
+don't split the statement.
+*/
+
+#ifndef SQL_SCRIPT_PARSER_H
+#define SQL_SCRIPT_PARSER_H
+
+#include <QStringList>
+#include <QList>
+
+class SQLScriptParser {
+	private:
+		//! \brief Returns if the provided character can be part of an unquoted identifier
+		static bool isIdentifierChar(const QChar &chr);
+
+		/*! \brief Returns the position of the last character of the quoted string/identifier started at pos.
+		 * The quote char is escaped by doubling it and, for escape strings (E'...'), by a backslash too.
+		 * The line parameter is incremented for each line break found in the quoted text */
+		static int skipQuoted(const QString &script, int pos, QChar quote, bool escape_str, int &line);
+
+		//! \brief Returns the position of the last character of the (possibly nested) block comment started at pos
+		static int skipBlockComment(const QString &script, int pos, int &line);
+
+		/*! \brief Returns the dollar quote tag ($$ or $tag$) started at pos or an empty string
+		 * if the dollar sign at pos doesn't start a dollar quote (e.g. positional parameters $1) */
+		static QString getDollarTag(const QString &script, int pos);
+
+	public:
+		/*! \brief Splits the script into statements. Empty statements and comments placed between statements are discarded.
+		 * The returned statements keep their trailing semicolon. The optional start_lines list receives the line (starting at 1)
+		 * in the script where each statement starts. Unterminated strings or comments make the remaining of the script
+		 * to be returned as the last statement so the server can report the syntax error */
+		static QStringList splitStatements(const QString &script, QList<int> *start_lines = nullptr);
+};
+
+#endif
@@ -36,8 +36,9 @@ XmlParser::XmlParser(void)
 
 XmlParser::~XmlParser(void)
 {
+	/* Note: xmlCleanupParser() is not called here since it frees the libxml2 global state
+	 * that may still be in use by parsers running in other threads (e.g. models being loaded concurrently) */
 	restartParser();
-	xmlCleanupParser();
 }
 
 void XmlParser::removeDTD(void)
@@ -449,3 +450,16 @@ int XmlParser::getBufferLineCount(void)
 		return(0);
 }
 
+
+size_t XmlParser::getMemoryUsage(void)
+{
+	size_t size=MemoryUsage::getStringSize(xml_doc_filename) +
+							MemoryUsage::getStringSize(dtd_decl) +
+							MemoryUsage::getStringSize(xml_buffer) +
+							MemoryUsage::getStringSize(xml_decl);
+
+	if(xml_doc)
+		size+=static_cast<size_t>(xml_buffer.size());
+
+	return(size);
+}
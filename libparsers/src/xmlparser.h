@@ -151,6 +151,10 @@ class XmlParser {
 		//! \brief Returns the full parser buffer
 		QString getXMLBuffer(void);
 
+		/*! \brief Returns an estimation of the heap memory (in bytes) held by the parser's buffers. The element tree
+		 * is estimated as being, at least, the size of the loaded buffer in UTF-8 */
+		size_t getMemoryUsage(void);
+
 		//! \brief Reset all the elements resposible to the navigation through the element tree
 		void restartNavigation(void);
 
@@ -16,6 +16,8 @@
 # Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
 */
 #include "catalog.h"
+#include <QDateTime>
+#include <algorithm>
 
 const QString Catalog::QueryList=QString("list");
 const QString Catalog::QueryAttribs=QString("attribs");
@@ -23,12 +25,21 @@ const QString Catalog::CatalogSchemasDir=QString("catalog");
 const QString Catalog::PgSqlTrue=QString("t");
 const QString Catalog::PgSqlFalse=QString("f");
 const QString Catalog::BoolField=QString("_bool");
-const QString Catalog::ArrayPattern=QString("((\\[)[0-9]+(\\:)[0-9]+(\\])=)?(\\{)((.)+(,)*)*(\\})$");
 const QString Catalog::GetExtensionObjsSql=QString("SELECT objid AS oid FROM pg_depend WHERE objid > 0 AND refobjid > 0 AND deptype='e'");
 const QString Catalog::PgModelerTempDbObj=QString("__pgmodeler_tmp");
 
 attribs_map Catalog::catalog_queries;
 
+map<QString, map<QString, Catalog::CachedResult>> Catalog::results_cache;
+
+QMutex Catalog::results_cache_mutex;
+
+unsigned Catalog::results_cache_ttl=60;
+
+unsigned Catalog::cache_hits=0;
+
+unsigned Catalog::cache_misses=0;
+
 map<ObjectType, QString> Catalog::oid_fields=
 { {ObjectType::Database, "oid"}, {ObjectType::Role, "oid"}, {ObjectType::Schema,"oid"},
 	{ObjectType::Language, "oid"}, {ObjectType::Tablespace, "oid"}, {ObjectType::Extension, "ex.oid"},
@@ -66,6 +77,7 @@ map<ObjectType, QString> Catalog::name_fields=
 Catalog::Catalog(void)
 {
 	last_sys_oid=0;
+	bypass_results_cache=false;
 	setFilter(ExclExtensionObjs | ExclSystemObjs);
 }
 
@@ -261,18 +273,189 @@ void Catalog::executeCatalogQuery(const QString &qry_type, ObjectType obj_type,
 	}
 }
 
-unsigned Catalog::getObjectCount(ObjectType obj_type, const QString &sch_name, const QString &tab_name, attribs_map extra_attribs)
+vector<attribs_map> Catalog::executeCachedQuery(const QString &sql)
 {
 	try
 	{
 		ResultSet res;
+		vector<attribs_map> tuples;
+		QString srv_id, qry_key;
+		qint64 now=QDateTime::currentMSecsSinceEpoch();
+		bool use_cache=(results_cache_ttl > 0 && !bypass_results_cache);
+
+		if(use_cache)
+		{
+			QMutexLocker locker(&results_cache_mutex);
+			map<QString, CachedResult>::iterator itr;
+
+			srv_id=getResultsCacheServerId(connection);
+			qry_key=QString("%1@%2\n%3").arg(connection.getConnectionParam(Connection::ParamUser))
+																	.arg(connection.getConnectionParam(Connection::ParamDbName))
+																	.arg(sql);
+			map<QString, CachedResult> &srv_results=results_cache[srv_id];
+			itr=srv_results.find(qry_key);
+
+			if(itr!=srv_results.end())
+			{
+				if(now - itr->second.timestamp <= static_cast<qint64>(results_cache_ttl) * 1000)
+				{
+					cache_hits++;
+					return(itr->second.tuples);
+				}
+
+				//Discarding the expired result
+				srv_results.erase(itr);
+			}
+
+			cache_misses++;
+		}
+
+		connection.executeDMLCommand(sql, res);
 
+		if(res.accessTuple(ResultSet::FirstTuple))
+		{
+			do
+			{
+				tuples.push_back(res.getTupleValues());
+			}
+			while(res.accessTuple(ResultSet::NextTuple));
+		}
+
+		if(use_cache)
+		{
+			QMutexLocker locker(&results_cache_mutex);
+			map<QString, CachedResult> &srv_results=results_cache[srv_id];
+
+			if(purgeResultsCache(srv_results, now, tuples.size()))
+				srv_results[qry_key]=CachedResult{ now, tuples };
+		}
+
+		return(tuples);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+vector<attribs_map> Catalog::getCatalogQueryResults(const QString &qry_type, ObjectType obj_type, bool single_result, attribs_map attribs)
+{
+	try
+	{
+		return(executeCachedQuery(getCatalogQuery(qry_type, obj_type, single_result, attribs)));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+						QString("catalog: %1").arg(BaseObject::getSchemaName(obj_type)));
+	}
+}
+
+bool Catalog::purgeResultsCache(map<QString, CachedResult> &srv_results, qint64 now, size_t new_tuples)
+{
+	qint64 ttl_msecs=static_cast<qint64>(results_cache_ttl) * 1000;
+	vector<map<QString, CachedResult>::iterator> entries;
+	size_t cached_tuples=0;
+
+	if(new_tuples > MaxCachedTuples)
+		return(false);
+
+	//Discarding the expired results and counting the tuples of the remaining ones
+	for(auto itr=srv_results.begin(); itr!=srv_results.end();)
+	{
+		if(now - itr->second.timestamp > ttl_msecs)
+			itr=srv_results.erase(itr);
+		else
+		{
+			cached_tuples+=itr->second.tuples.size();
+			entries.push_back(itr);
+			itr++;
+		}
+	}
+
+	if(cached_tuples + new_tuples <= MaxCachedTuples)
+		return(true);
+
+	//Discarding the oldest results until the new tuples fit in the cache
+	std::sort(entries.begin(), entries.end(),
+						[](map<QString, CachedResult>::iterator itr1, map<QString, CachedResult>::iterator itr2){
+		return(itr1->second.timestamp < itr2->second.timestamp);
+	});
+
+	for(auto &itr : entries)
+	{
+		if(cached_tuples + new_tuples <= MaxCachedTuples)
+			break;
+
+		cached_tuples-=itr->second.tuples.size();
+		srv_results.erase(itr);
+	}
+
+	return(true);
+}
+
+QString Catalog::getResultsCacheServerId(Connection &conn)
+{
+	return(conn.getConnectionId(true, false));
+}
+
+void Catalog::setResultsCacheTTL(unsigned ttl)
+{
+	QMutexLocker locker(&results_cache_mutex);
+
+	if(results_cache_ttl != ttl)
+		results_cache.clear();
+
+	results_cache_ttl=ttl;
+}
+
+unsigned Catalog::getResultsCacheTTL(void)
+{
+	return(results_cache_ttl);
+}
+
+void Catalog::setBypassResultsCache(bool value)
+{
+	bypass_results_cache=value;
+}
+
+bool Catalog::isResultsCacheBypassed(void)
+{
+	return(bypass_results_cache);
+}
+
+void Catalog::invalidateResultsCache(Connection &conn)
+{
+	QMutexLocker locker(&results_cache_mutex);
+	results_cache.erase(getResultsCacheServerId(conn));
+}
+
+void Catalog::clearResultsCache(void)
+{
+	QMutexLocker locker(&results_cache_mutex);
+	results_cache.clear();
+}
+
+unsigned Catalog::getResultsCacheHits(void)
+{
+	QMutexLocker locker(&results_cache_mutex);
+	return(cache_hits);
+}
+
+unsigned Catalog::getResultsCacheMisses(void)
+{
+	QMutexLocker locker(&results_cache_mutex);
+	return(cache_misses);
+}
+
+unsigned Catalog::getObjectCount(ObjectType obj_type, const QString &sch_name, const QString &tab_name, attribs_map extra_attribs)
+{
+	try
+	{
 		extra_attribs[Attributes::Schema]=sch_name;
 		extra_attribs[Attributes::Table]=tab_name;
 
-		executeCatalogQuery(QueryList, obj_type, res, false, extra_attribs);
-		res.accessTuple(ResultSet::FirstTuple);
-		return(res.getTupleCount());
+		return(static_cast<unsigned>(getCatalogQueryResults(QueryList, obj_type, false, extra_attribs).size()));
 	}
 	catch(Exception &e)
 	{
@@ -332,21 +515,13 @@ attribs_map Catalog::getObjectsNames(ObjectType obj_type, const QString &sch_nam
 {
 	try
 	{
-		ResultSet res;
 		attribs_map objects;
 
 		extra_attribs[Attributes::Schema]=sch_name;
 		extra_attribs[Attributes::Table]=tab_name;
-		executeCatalogQuery(QueryList, obj_type, res, false, extra_attribs);
 
-		if(res.accessTuple(ResultSet::FirstTuple))
-		{
-			do
-			{
-				objects[res.getColumnValue(Attributes::Oid)]=res.getColumnValue(Attributes::Name);
-			}
-			while(res.accessTuple(ResultSet::NextTuple));
-		}
+		for(auto &tuple : getCatalogQueryResults(QueryList, obj_type, false, extra_attribs))
+			objects[tuple[Attributes::Oid]]=tuple[Attributes::Name];
 
 		return(objects);
 	}
@@ -360,7 +535,6 @@ vector<attribs_map> Catalog::getObjectsNames(vector<ObjectType> obj_types, const
 {
 	try
 	{
-		ResultSet res;
 		vector<attribs_map> objects;
 		QString sql, select_kw=QString("SELECT");
 		QStringList queries;
@@ -394,19 +568,13 @@ vector<attribs_map> Catalog::getObjectsNames(vector<ObjectType> obj_types, const
 		if(sort_results)
 			sql += QString(" ORDER BY oid, object_type");
 
-		connection.executeDMLCommand(sql, res);
-
-		if(res.accessTuple(ResultSet::FirstTuple))
+		for(auto &tuple : executeCachedQuery(sql))
 		{
-			do
-			{
-				attribs[Attributes::Oid]=res.getColumnValue(Attributes::Oid);
-				attribs[Attributes::Name]=res.getColumnValue(Attributes::Name);
-				attribs[Attributes::ObjectType]=res.getColumnValue(QString("object_type"));
-				objects.push_back(attribs);
-				attribs.clear();
-			}
-			while(res.accessTuple(ResultSet::NextTuple));
+			attribs[Attributes::Oid]=tuple[Attributes::Oid];
+			attribs[Attributes::Name]=tuple[Attributes::Name];
+			attribs[Attributes::ObjectType]=tuple[QString("object_type")];
+			objects.push_back(attribs);
+			attribs.clear();
 		}
 
 		return(objects);
@@ -421,15 +589,15 @@ attribs_map Catalog::getAttributes(const QString &obj_name, ObjectType obj_type,
 {
 	try
 	{
-		ResultSet res;
 		attribs_map obj_attribs;
+		vector<attribs_map> tuples;
 
 		//Add the name of the object as extra attrib in order to retrieve the data only for it
 		extra_attribs[Attributes::Name]=obj_name;
-		executeCatalogQuery(QueryAttribs, obj_type, res, true, extra_attribs);
+		tuples=getCatalogQueryResults(QueryAttribs, obj_type, true, extra_attribs);
 
-		if(res.accessTuple(ResultSet::FirstTuple))
-			obj_attribs=changeAttributeNames(res.getTupleValues());
+		if(!tuples.empty())
+			obj_attribs=changeAttributeNames(tuples[0]);
 
 		/* Insert the object type as an attribute of the query result to facilitate the
 		import process on the classes that uses the Catalog */
@@ -447,25 +615,19 @@ vector<attribs_map> Catalog::getMultipleAttributes(ObjectType obj_type, attribs_
 {
 	try
 	{
-		ResultSet res;
 		attribs_map tuple;
 		vector<attribs_map> obj_attribs;
 
-		executeCatalogQuery(QueryAttribs, obj_type, res, false, extra_attribs);
-		if(res.accessTuple(ResultSet::FirstTuple))
+		for(auto &res_tuple : getCatalogQueryResults(QueryAttribs, obj_type, false, extra_attribs))
 		{
-			do
-			{
-				tuple=changeAttributeNames(res.getTupleValues());
+			tuple=changeAttributeNames(res_tuple);
 
-				/* Insert the object type as an attribute of the query result to facilitate the
-				import process on the classes that uses the Catalog */
-				tuple[Attributes::ObjectType]=QString("%1").arg(enum_cast(obj_type));
+			/* Insert the object type as an attribute of the query result to facilitate the
+			import process on the classes that uses the Catalog */
+			tuple[Attributes::ObjectType]=QString("%1").arg(enum_cast(obj_type));
 
-				obj_attribs.push_back(tuple);
-				tuple.clear();
-			}
-			while(res.accessTuple(ResultSet::NextTuple));
+			obj_attribs.push_back(tuple);
+			tuple.clear();
 		}
 
 		return(obj_attribs);
@@ -633,24 +795,21 @@ QString Catalog::getObjectOID(const QString &name, ObjectType obj_type, const QS
 	try
 	{
 		attribs_map attribs;
-		ResultSet res;
+		vector<attribs_map> tuples;
 
 		attribs[Attributes::CustomFilter] = QString("%1 = E'%2'").arg(name_fields[obj_type]).arg(name);
 		attribs[Attributes::Schema] = schema;
 		attribs[Attributes::Table] = table;
-		executeCatalogQuery(QueryList, obj_type, res, false, attribs);
+		tuples=getCatalogQueryResults(QueryList, obj_type, false, attribs);
 
-		if(res.getTupleCount() > 1)
+		if(tuples.size() > 1)
 			throw Exception(QApplication::translate("Catalog","The catalog query returned more than one OID!","", -1),
 											ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		else if(res.isEmpty())
+		else if(tuples.empty())
 			return("0");
 		else
-		{
-			res.accessTuple(ResultSet::FirstTuple);
-			return(res.getColumnValue(Attributes::Oid));
-		}
+			return(tuples[0][Attributes::Oid]);
 	}
 	catch(Exception &e)
 	{
@@ -702,77 +861,176 @@ attribs_map Catalog::getServerAttributes(void)
 
 QStringList Catalog::parseArrayValues(const QString &array_val)
 {
-	QStringList list;
-
-	if(QRegExp(ArrayPattern).exactMatch(array_val))
-	{
-		//Detecting the position of { and }
-		int start=array_val.indexOf('{')+1,
-				end=array_val.lastIndexOf('}')-1;
-		QString value=array_val.mid(start, (end - start)+1);
-
-		if(value.contains('"'))
-			list=parseDefaultValues(value, QString("\""), QString(","));
-		else
-			list=value.split(',', QString::SkipEmptyParts);
-	}
+	return(splitArrayValues(array_val, false));
+}
 
-	return(list);
+QStringList Catalog::decodeArrayValues(const QString &array_val)
+{
+	return(splitArrayValues(array_val, true));
 }
 
-QStringList Catalog::parseDefaultValues(const QString &def_vals, const QString &str_delim, const QString &val_sep)
+QStringList Catalog::splitArrayValues(const QString &array_val, bool decode)
 {
-	int idx=0, delim_start, delim_end, sep_idx, pos=0;
 	QStringList values;
+	const QChar *chrs=array_val.constData();
+	int len=array_val.size(), pos=0, end=len - 1, start=0, level=0;
+	bool in_quotes=false, quoted=false, sub_array=false;
+	QString value;
+	QChar chr;
 
-	while(idx < def_vals.size())
+	//Validating the optional dimension decoration in the format [n:n][n:n]...=
+	while(pos < len && chrs[pos]=='[')
 	{
-		//Get the index of string delimiters (default: ')
-		delim_start=def_vals.indexOf(str_delim, idx);
-		delim_end=def_vals.indexOf(str_delim, delim_start + 1);
+		pos++;
+
+		//Each dimension is composed by a lower and upper bounds, e.g. [1:3] or [-2:0]
+		for(QChar delim : { QChar(':'), QChar(']') })
+		{
+			int digits=0;
+
+			if(pos < len && chrs[pos]=='-')
+				pos++;
+
+			while(pos < len && chrs[pos].isDigit())
+			{
+				pos++;
+				digits++;
+			}
+
+			if(digits==0 || pos >= len || chrs[pos]!=delim)
+				return(values);
+
+			pos++;
+		}
+
+		if(pos >= len || (chrs[pos]!='[' && chrs[pos]!='='))
+			return(values);
+
+		if(chrs[pos]=='=')
+			pos++;
+	}
+
+	//The array must be in the form {...} with at least one char between the braces
+	if(end - pos < 2 || chrs[pos]!='{' || chrs[end]!='}')
+		return(values);
 
-		/* Get the index of value separator on default value string
-			 (by default the pg_get_expr separates values by comma and space (, ) */
-		sep_idx=def_vals.indexOf(val_sep, idx);
+	start=++pos;
 
-		/* If there is no separator on string (only one value) or the is
-			 beyond the string delimiters or even there is no string delimiter on string */
-		if(sep_idx < 0 ||
-				(sep_idx >=0 && delim_start >= 0 && delim_end >= 0 &&
-				 (sep_idx < delim_start || sep_idx > delim_end)) ||
-				(sep_idx >=0 && (delim_start < 0 || delim_end < 0)))
+	for(; pos <= end; pos++)
+	{
+		chr=chrs[pos];
+
+		//Reached a top level separator or the closing brace: the current element is complete
+		if(pos==end || (chr==',' && level==0 && !in_quotes))
 		{
-			//Extract the value from the current position
-			values.push_back(def_vals.mid(pos, sep_idx-pos).trimmed());
+			if(!decode || sub_array)
+			{
+				QString elem=array_val.mid(start, pos - start).trimmed();
 
-			//If there is no separator on string indicates that it contains only one value
-			if(sep_idx < 0)
-				//Forcing the loop abort
-				idx=def_vals.size();
+				if(!elem.isEmpty())
+					values.push_back(elem);
+			}
+			else if(quoted)
+				values.push_back(value);
 			else
 			{
-				//Passing to the next value right after the separator
-				pos=sep_idx+1;
-				idx=pos;
+				value=value.trimmed();
+
+				if(value.compare(QString("NULL"), Qt::CaseInsensitive)==0)
+					values.push_back(QString());
+				else if(!value.isEmpty())
+					values.push_back(value);
 			}
+
+			value.clear();
+			quoted=sub_array=false;
+			start=pos + 1;
+		}
+		//Escaped chars are taken literally (even outside quotes)
+		else if(chr=='\\' && pos + 1 < end)
+		{
+			pos++;
+
+			if(decode)
+				value+=chrs[pos];
+		}
+		else if(chr=='"')
+		{
+			/* Discarding the whitespaces before the opening quote. The value is set as an empty (not null)
+			 * string so a quoted empty element, "", isn't confused with NULL */
+			if(!in_quotes && !quoted && decode)
+				value=QString("");
+
+			in_quotes=!in_quotes;
+			quoted=true;
+		}
+		else if(in_quotes)
+		{
+			if(decode)
+				value+=chr;
 		}
-		/* If the separator is between a string delimitation e.g.'abc, def' it will be ignored
-		and the current postion will be moved to the first char after string delimiter */
-		else if(delim_start>=0 && delim_end >= 0 &&
-				sep_idx >= delim_start && sep_idx <=delim_end)
+		else if(chr=='{')
 		{
-			idx=delim_end+1;
+			level++;
+			sub_array=true;
+		}
+		else if(chr=='}')
+			level--;
+		else if(decode && (!quoted || !chr.isSpace()))
+			value+=chr;
+	}
+
+	return(values);
+}
 
-			/* If the index reaches the end of string but the cursor (pos) isn't at end
-			indicates that the last values wasn't retrieved, this way, the value will be
-			pushed to list of values */
-			if(idx >= def_vals.size() && pos < def_vals.size())
-				values.push_back(def_vals.mid(pos, def_vals.size()));
+QStringList Catalog::parseDefaultValues(const QString &def_vals, const QString &str_delim, const QString &val_sep)
+{
+	QStringList values;
+	const QChar *chrs=def_vals.constData();
+	int len=def_vals.size(), delim_len=str_delim.size(), sep_len=val_sep.size(),
+			pos=0, start=0, level=0;
+	bool in_str=false;
+	QChar chr;
+
+	if(def_vals.isEmpty())
+		return(values);
+
+	while(pos < len)
+	{
+		chr=chrs[pos];
+
+		/* Toggling the string delimitation. Doubled delimiters inside a string, e.g. 'abc''s',
+		 * are handled naturally since the string is closed and then reopened */
+		if(delim_len > 0 && chr==str_delim.at(0) && def_vals.midRef(pos, delim_len)==str_delim)
+		{
+			in_str=!in_str;
+			pos+=delim_len;
+		}
+		else if(in_str)
+			pos++;
+		/* Separators inside parenthesis or brackets, e.g. ARRAY[1, 2] or func(a, b),
+		 * belong to the current value so the nesting level is tracked */
+		else if(chr=='(' || chr=='[')
+		{
+			level++;
+			pos++;
+		}
+		else if(chr==')' || chr==']')
+		{
+			level--;
+			pos++;
+		}
+		else if(level <= 0 && sep_len > 0 && chr==val_sep.at(0) && def_vals.midRef(pos, sep_len)==val_sep)
+		{
+			values.push_back(def_vals.mid(start, pos - start).trimmed());
+			pos+=sep_len;
+			start=pos;
 		}
 		else
-			idx++;
+			pos++;
 	}
 
+	values.push_back(def_vals.mid(start).trimmed());
 	return(values);
 }
 
@@ -843,6 +1101,7 @@ void Catalog::operator = (const Catalog &catalog)
 		this->exclude_sys_objs=catalog.exclude_sys_objs;
 		this->exclude_array_types=catalog.exclude_array_types;
 		this->list_only_sys_objs=catalog.list_only_sys_objs;
+		this->bypass_results_cache=catalog.bypass_results_cache;
 		this->connection.connect();
 	}
 	catch(Exception &e)
@@ -31,6 +31,7 @@ This class is the basis for the reverse engineering feature.
 #include "tableobject.h"
 #include <QTextStream>
 #include <QApplication>
+#include <QMutex>
 
 class Catalog {
 	private:
@@ -44,10 +45,7 @@ class Catalog {
 		BoolField,     //! \brief Suffix for boolean fields.
 
 		//! \brief Query used to retrieve extension objects.
-		GetExtensionObjsSql,
-
-		//! \brief This pattern matches the PostgreSQL array values in format [n:n]={a,b,c,d,...} or {a,b,c,d,...}
-		ArrayPattern;
+		GetExtensionObjsSql;
 
 		/*! \brief Stores in comma seperated way the oids of all objects created by extensions. This
 		attribute is use when filtering objects that are created by extensions */
@@ -68,6 +66,34 @@ class Catalog {
 		//! \brief Store the cached catalog queries
 		static attribs_map catalog_queries;
 
+		//! \brief Stores the tuples returned by a catalog query and the moment (msecs since epoch) they were retrieved
+		struct CachedResult {
+			qint64 timestamp;
+			vector<attribs_map> tuples;
+		};
+
+		/*! \brief Stores the results of the catalog queries per server (host:port). Each server entry maps
+		 * the user, database and query text to the tuples returned (see getCatalogQueryResults()) */
+		static map<QString, map<QString, CachedResult>> results_cache;
+
+		//! \brief Controls the access to the results cache since catalogs are used by different threads
+		static QMutex results_cache_mutex;
+
+		//! \brief Time (in seconds) in which a cached result is considered valid. Zero disables the results cache
+		static unsigned results_cache_ttl;
+
+		//! \brief Amount of catalog queries answered by the results cache and the ones that were sent to the server
+		static unsigned cache_hits, cache_misses;
+
+		/*! \brief Maximum amount of tuples kept in the results cache of a single server. When a new result doesn't fit
+		 * the oldest results of the server are discarded. Results bigger than this limit are never cached */
+		static constexpr unsigned MaxCachedTuples=100000;
+
+		/*! \brief Discards the expired results of a server and, if needed, the oldest ones so the new_tuples fit in the
+		 * server's cache (see MaxCachedTuples). Returns false when the new tuples can't be cached at all.
+		 * This method must be called with results_cache_mutex locked */
+		static bool purgeResultsCache(map<QString, CachedResult> &srv_results, qint64 now, size_t new_tuples);
+
 		//! \brief Connection used to query the pg_catalog
 		Connection connection;
 
@@ -86,7 +112,10 @@ class Catalog {
 		exclude_array_types,
 
 		//! \brief Indicates if the catalog must list only system objects
-		list_only_sys_objs;
+		list_only_sys_objs,
+
+		//! \brief Indicates that the catalog queries are always sent to the server, neither reading nor filling the results cache
+		bypass_results_cache;
 
 		/*! \brief Load the schema parser buffer with the catalog query using identified by qry_id.
 		The method will cache the catalog query if it's not cached yet (only when use_cached_queries=true) */
@@ -98,6 +127,18 @@ class Catalog {
 		ParsersAttributes::CUSTOM_FILTER that will be appended to the current filter expression */
 		void executeCatalogQuery(const QString &qry_type, ObjectType obj_type, ResultSet &result, bool single_result=false, attribs_map attribs=attribs_map());
 
+		/*! \brief Executes the provided catalog query and returns the generated tuples. When the results cache is enabled
+		 * the tuples are returned from the cache if the very same query was executed on the same server, database and user
+		 * within the cache TTL, otherwise the query is executed and its tuples are cached */
+		vector<attribs_map> executeCachedQuery(const QString &sql);
+
+		/*! \brief Works like executeCatalogQuery() but returning the tuples generated by the catalog query
+		 * which may be retrieved from the results cache (see executeCachedQuery()) */
+		vector<attribs_map> getCatalogQueryResults(const QString &qry_type, ObjectType obj_type, bool single_result=false, attribs_map attribs=attribs_map());
+
+		//! \brief Returns the key used to scope the cached results of the provided connection
+		static QString getResultsCacheServerId(Connection &conn);
+
 		//! \brief Returns the catalog query according to the type of the object type provided
 		QString getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result=false, attribs_map attribs=attribs_map());
 
@@ -121,6 +162,12 @@ class Catalog {
 		//! \brief Creates a comma separated string containing all the oids to be filtered
 		QString createOidFilter(const vector<unsigned> &oids);
 
+		/*! \brief Splits a PostgreSQL array value in the format [n:n]={a,b,c,d,...} or {a,b,c,d,...} in a single pass.
+		 * When 'decode' is false the elements are returned as they appear in the array (quoted elements keep their quotes
+		 * and escapes). When 'decode' is true the quotes are removed, the escaped chars are resolved and the unquoted
+		 * NULL elements are returned as null strings. Nested arrays are always returned as a single raw element */
+		static QStringList splitArrayValues(const QString &array_val, bool decode);
+
 	public:
 		Catalog(void);
 		Catalog(const Catalog &catalog);
@@ -207,9 +254,14 @@ class Catalog {
 		//! brief This special method returns some server's attributes read from pg_settings
 		attribs_map getServerAttributes(void);
 
-		//! \brief Parse a PostgreSQL array value and return the elements in a string list
+		/*! \brief Parse a PostgreSQL array value and return the elements in a string list.
+		 * Quoted elements are returned with their quotes (see decodeArrayValues()) */
 		static QStringList parseArrayValues(const QString &array_val);
 
+		/*! \brief Parse a PostgreSQL array value and return the elements unquoted and unescaped.
+		 * Unquoted NULL elements are returned as null strings */
+		static QStringList decodeArrayValues(const QString &array_val);
+
 		/*! \brief Parse a function's default value and return the elements in a string list.
 		It can be specified the string delimiter as well the value separator if the input default value
 		contains several values */
@@ -229,6 +281,34 @@ class Catalog {
 		//! \brief Returns the current status of cached catalog queries
 		static bool isCachedQueriesEnabled(void);
 
+		/*! \brief Configures the time (in seconds) in which the catalog queries results are kept in cache.
+		 * Zero disables the results cache. Changing the TTL discards all the cached results */
+		static void setResultsCacheTTL(unsigned ttl);
+
+		//! \brief Returns the current time (in seconds) in which the catalog queries results are kept in cache
+		static unsigned getResultsCacheTTL(void);
+
+		/*! \brief Discards the cached results of all databases in the server of the provided connection. This method must
+		 * be called every time the database structure is (or may have been) changed, e.g., after running DDL commands */
+		static void invalidateResultsCache(Connection &conn);
+
+		//! \brief Discards the cached results of all servers
+		static void clearResultsCache(void);
+
+		/*! \brief Makes the catalog to ignore the results cache, this is, the queries are always sent to the server and their
+		 * results aren't cached. Used by bulk catalog reads (e.g. reverse engineering) that must reflect the current database state
+		 * and whose results would only evict the ones of other catalogs from the cache */
+		void setBypassResultsCache(bool value);
+
+		//! \brief Returns if the catalog ignores the results cache
+		bool isResultsCacheBypassed(void);
+
+		//! \brief Returns the amount of catalog queries answered by the results cache
+		static unsigned getResultsCacheHits(void);
+
+		//! \brief Returns the amount of catalog queries that were sent to the server due to the absence of valid results in cache
+		static unsigned getResultsCacheMisses(void);
+
 		//! \brief Performs the copy between two catalogs
 		void operator = (const Catalog &catalog);
 };
@@ -67,7 +67,8 @@ HEADERS += src/textbox.h \
 	   src/foreignobject.h \
 	   src/foreignserver.h \
 	   src/physicaltable.h \
-	   src/foreigntable.h
+	   src/foreigntable.h \
+	   src/uniquenameallocator.h
 
 SOURCES +=  src/textbox.cpp \
 	    src/domain.cpp \
@@ -123,7 +124,8 @@ SOURCES +=  src/textbox.cpp \
 	    src/foreignobject.cpp \
 	    src/foreignserver.cpp \
 	    src/physicaltable.cpp \
-	    src/foreigntable.cpp
+	    src/foreigntable.cpp \
+	    src/uniquenameallocator.cpp
 
 unix|windows: LIBS += -L$$OUT_PWD/../libparsers/ -lparsers \
                     -L$$OUT_PWD/../libutils/ -lutils
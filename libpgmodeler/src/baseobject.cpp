@@ -19,6 +19,7 @@
 #include "baseobject.h"
 #include "pgmodelerns.h"
 #include <QApplication>
+#include <QCryptographicHash>
 
 const QByteArray BaseObject::special_chars = QByteArray("'_-.@ $:()/<>+*\\=~!#%^&|?{}[]`;");
 
@@ -71,9 +72,10 @@ const QString BaseObject::objs_sql[BaseObject::ObjectTypeCount]={
 	 starts at 40k because the id ranges 0, 1k, 2k, 3k
 	 are respectively assigned to objects of classes Role, Tablespace
    DatabaseModel, Tag */
-unsigned BaseObject::global_id=4000;
+atomic<unsigned> BaseObject::global_id(4000);
 
 QString BaseObject::pgsql_ver=PgSqlVersions::DefaulVersion;
+thread_local QString BaseObject::thread_pgsql_ver;
 bool BaseObject::use_cached_code=true;
 bool BaseObject::escape_comments=true;
 
@@ -742,7 +744,7 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 	{
 		bool format=false;
 
-		schparser.setPgSQLVersion(BaseObject::pgsql_ver);
+		schparser.setPgSQLVersion(getPgSQLVersion());
 		attributes[Attributes::SqlDisabled]=(sql_disabled ? Attributes::True : QString());
 
 		//Formats the object's name in case the SQL definition is being generated
@@ -1044,9 +1046,14 @@ void BaseObject::setPgSQLVersion(const QString &ver)
 	pgsql_ver=ver;
 }
 
+void BaseObject::setThreadPgSQLVersion(const QString &ver)
+{
+	thread_pgsql_ver=ver;
+}
+
 QString BaseObject::getPgSQLVersion(void)
 {
-	return(pgsql_ver);
+	return(thread_pgsql_ver.isEmpty() ? pgsql_ver : thread_pgsql_ver);
 }
 
 attribs_map BaseObject::getSearchAttributes(void)
@@ -1084,6 +1091,8 @@ void BaseObject::setCodeInvalidated(bool value)
 			cached_reduced_code.clear();
 			cached_code[0].clear();
 			cached_code[1].clear();
+			content_hash.clear();
+			content_hash_key.clear();
 		}
 
 		code_invalidated=value;
@@ -1105,46 +1114,89 @@ bool BaseObject::isCodeInvalidated(void)
 	return(use_cached_code && code_invalidated);
 }
 
-bool BaseObject::isCodeDiffersFrom(const QString &xml_def1, const QString &xml_def2, const vector<QString> &ignored_attribs, const vector<QString> &ignored_tags)
+QByteArray BaseObject::getContentHash(const vector<QString> &ignored_attribs, const vector<QString> &ignored_tags)
+{
+	try
+	{
+		QStringList key_items;
+
+		for(auto &attr : ignored_attribs)
+			key_items.append(attr);
+
+		key_items.append(QString());
+
+		for(auto &tag : ignored_tags)
+			key_items.append(tag);
+
+		QString hash_key=key_items.join(',');
+
+		//Database object doesn't handles cached code so its hash is always recalculated
+		if(!use_cached_code || code_invalidated || content_hash.isEmpty() ||
+			 content_hash_key!=hash_key || obj_type==ObjectType::Database)
+		{
+			QString xml_def=this->getCodeDefinition(SchemaParser::XmlDefinition);
+			QByteArray hash;
+
+			if(!ignored_attribs.empty() || !ignored_tags.empty())
+				xml_def=stripXmlCode(xml_def, ignored_attribs, ignored_tags);
+
+			hash=QCryptographicHash::hash(xml_def.toUtf8(), QCryptographicHash::Sha1);
+
+			if(use_cached_code && obj_type!=ObjectType::Database)
+			{
+				content_hash=hash;
+				content_hash_key=hash_key;
+			}
+
+			return(hash);
+		}
+
+		return(content_hash);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+QString BaseObject::stripXmlCode(const QString &xml_def, const vector<QString> &ignored_attribs, const vector<QString> &ignored_tags)
 {
-	QString xml, tag=QString("<%1").arg(this->getSchemaName()),
+	QString xml=xml_def.simplified(),
 			attr_regex=QString("(%1=\")"),
 			tag_regex=QString("<%1[^>]*((/>)|(>((?:(?!</%1>).)*)</%1>))");
-	QStringList xml_defs{ xml_def1, xml_def2 };
 	int start=0, end=-1, tag_end=-1;
 	QRegExp regexp;
 
-	for(int i=0; i < 2; i++)
+	//Removing ignored attributes
+	for(QString attr : ignored_attribs)
 	{
-		xml=xml_defs[i].simplified();
-
-		//Removing ignored attributes
-		for(QString attr : ignored_attribs)
+		do
 		{
-			do
-			{
-				regexp=QRegExp(attr_regex.arg(attr));
-				tag_end=xml.indexOf(QRegExp(QString("(\\\\)?(>)")));
-				start=regexp.indexIn(xml);
-				end=xml.indexOf('"', start + regexp.matchedLength());
+			regexp=QRegExp(attr_regex.arg(attr));
+			tag_end=xml.indexOf(QRegExp(QString("(\\\\)?(>)")));
+			start=regexp.indexIn(xml);
+			end=xml.indexOf('"', start + regexp.matchedLength());
 
-				if(end > tag_end)
-					end=-1;
+			if(end > tag_end)
+				end=-1;
 
-				if(start >=0 && end >=0)
-					xml.remove(start, (end - start) + 1);
-			}
-			while(start >= 0 && end >= 0);
+			if(start >=0 && end >=0)
+				xml.remove(start, (end - start) + 1);
 		}
+		while(start >= 0 && end >= 0);
+	}
 
-		//Removing ignored tags
-		for(QString tag : ignored_tags)
-			xml.remove(QRegExp(tag_regex.arg(tag)));
+	//Removing ignored tags
+	for(QString tag : ignored_tags)
+		xml.remove(QRegExp(tag_regex.arg(tag)));
 
-		xml_defs[i]=xml.simplified();
-	}
+	return(xml.simplified());
+}
 
-	return(xml_defs[0]!=xml_defs[1]);
+bool BaseObject::isCodeDiffersFrom(const QString &xml_def1, const QString &xml_def2, const vector<QString> &ignored_attribs, const vector<QString> &ignored_tags)
+{
+	return(stripXmlCode(xml_def1, ignored_attribs, ignored_tags)!=
+				 stripXmlCode(xml_def2, ignored_attribs, ignored_tags));
 }
 
 bool BaseObject::isCodeDiffersFrom(BaseObject *object, const vector<QString> &ignored_attribs, const vector<QString> &ignored_tags)
@@ -1156,9 +1208,15 @@ bool BaseObject::isCodeDiffersFrom(BaseObject *object, const vector<QString> &ig
 
 	try
 	{
+		/* The content hashes are calculated over the code without the ignored attributes and tags
+		 * so they can be compared directly. They're used only when the code is cached, otherwise they'd force
+		 * the stripping of the xml code on every comparison with no gain */
+		if(use_cached_code)
+			return(this->getContentHash(ignored_attribs, ignored_tags)!=object->getContentHash(ignored_attribs, ignored_tags));
+
 		return(BaseObject::isCodeDiffersFrom(this->getCodeDefinition(SchemaParser::XmlDefinition),
-											 object->getCodeDefinition(SchemaParser::XmlDefinition),
-											 ignored_attribs, ignored_tags));
+																				 object->getCodeDefinition(SchemaParser::XmlDefinition),
+																				 ignored_attribs, ignored_tags));
 	}
 	catch(Exception &e)
 	{
@@ -1168,7 +1226,7 @@ bool BaseObject::isCodeDiffersFrom(BaseObject *object, const vector<QString> &ig
 
 QString BaseObject::getCachedCode(unsigned def_type, bool reduced_form)
 {
-	if(use_cached_code && def_type==SchemaParser::SqlDefinition && schparser.getPgSQLVersion()!=BaseObject::pgsql_ver)
+	if(use_cached_code && def_type==SchemaParser::SqlDefinition && schparser.getPgSQLVersion()!=getPgSQLVersion())
 		code_invalidated=true;
 
 	if(!code_invalidated &&
@@ -1193,7 +1251,7 @@ QString BaseObject::getDropDefinition(bool cascade)
 			attribs_map attribs;
 
 			setBasicAttributes(true);
-			schparser.setPgSQLVersion(BaseObject::pgsql_ver);
+			schparser.setPgSQLVersion(getPgSQLVersion());
 			schparser.ignoreUnkownAttributes(true);
 			schparser.ignoreEmptyAttributes(true);
 
@@ -1226,7 +1284,7 @@ QString BaseObject::getAlterDefinition(QString sch_name, attribs_map &attribs, b
 								GlobalAttributes::AlterSchemaDir + GlobalAttributes::DirSeparator +
 								QString("%1") + GlobalAttributes::SchemaExt;
 
-		schparser.setPgSQLVersion(BaseObject::pgsql_ver);
+		schparser.setPgSQLVersion(getPgSQLVersion());
 		schparser.ignoreEmptyAttributes(ignore_empty_attribs);
 		schparser.ignoreUnkownAttributes(ignore_ukn_attribs);
 		return(schparser.getCodeDefinition(alter_sch_dir.arg(sch_name), attribs));
@@ -1330,3 +1388,27 @@ QString BaseObject::getAlterCommentDefinition(BaseObject *object, attribs_map at
 		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
 	}
 }
+
+size_t BaseObject::getMemoryUsage(unsigned mem_cat)
+{
+	if(mem_cat==MemCachedCode)
+	{
+		return(MemoryUsage::getStringSize(cached_code[SchemaParser::SqlDefinition]) +
+					 MemoryUsage::getStringSize(cached_code[SchemaParser::XmlDefinition]) +
+					 MemoryUsage::getStringSize(cached_reduced_code));
+	}
+	else if(mem_cat==MemParserBuffers)
+		return(schparser.getMemoryUsage());
+	else if(mem_cat==MemObjectData)
+	{
+		return(MemoryUsage::getStringSize(comment) +
+					 MemoryUsage::getStringSize(obj_name) +
+					 MemoryUsage::getStringSize(alias) +
+					 MemoryUsage::getStringSize(appended_sql) +
+					 MemoryUsage::getStringSize(prepended_sql) +
+					 MemoryUsage::getStringMapSize(attributes) +
+					 MemoryUsage::getStringMapSize(search_attribs));
+	}
+
+	return(0);
+}
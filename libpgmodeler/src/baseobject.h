@@ -35,6 +35,7 @@
 #include <QStringList>
 #include <QTextStream>
 #include <type_traits>
+#include <atomic>
 
 enum class ObjectType: unsigned {
 	Column,
@@ -84,6 +85,10 @@ class BaseObject {
 		//! \brief Current PostgreSQL version used in SQL code generation
 		static QString pgsql_ver;
 
+		/*! \brief PostgreSQL version used in SQL code generation only by the current thread.
+		 * When set, it takes precedence over pgsql_ver (see setThreadPgSQLVersion()) */
+		static thread_local QString thread_pgsql_ver;
+
 		//! \brief Indicates the the cached code enabled
 		static bool use_cached_code;
 
@@ -101,8 +106,9 @@ class BaseObject {
 		/*! \brief This static attribute is used to generate the unique identifier for objects.
 		 As object instances are created this value ​​are incremented. In some classes
 		 like Schema, DatabaseModel, Tablespace, Role, Type and Function id generators are
-		 used each with a custom different numbering range (see cited classes declaration). */
-		static unsigned global_id;
+		 used each with a custom different numbering range (see cited classes declaration).
+		 The generators are atomic since models can be loaded concurrently by different threads. */
+		static atomic<unsigned> global_id;
 
 		/*! \brief Stores the unique identifier for the object. This id is nothing else
 		 than the current value of global_id. This identifier is used
@@ -142,6 +148,13 @@ class BaseObject {
 		//! \brief Stores the xml code in reduced form
 		cached_reduced_code;
 
+		/*! \brief Stores the structural content hash of the object. This hash is discarded
+		 * together with the cached code when the object is modified (see setCodeInvalidated()) */
+		QByteArray content_hash;
+
+		//! \brief Stores the ignored attributes and tags used to calculate the cached content hash
+		QString content_hash_key;
+
 		/*! \brief This map stores the name of each object type associated to a schema file
 		 that generates the object's code definition */
 		static const QString objs_schemas[ObjectTypeCount];
@@ -231,6 +244,9 @@ class BaseObject {
 	and tags must be ignored when makin the comparison. NOTE: only the name for attributes and tags must be informed */
 		bool isCodeDiffersFrom(const QString &xml_def1, const QString &xml_def2, const vector<QString> &ignored_attribs, const vector<QString> &ignored_tags);
 
+		//! \brief Removes the provided attributes and tags from the xml buffer returning the simplified result
+		QString stripXmlCode(const QString &xml_def, const vector<QString> &ignored_attribs, const vector<QString> &ignored_tags);
+
 		/*! \brief Copies the non-empty attributes on the map at parameter to the own object attributes map. This method is used
 		as an auxiliary when generating alter definition for some objects. When one or more attributes are copied an especial
 		attribute is inserted (HAS_CHANGES) in order to help the atler generatin process to identify which attributes are
@@ -245,6 +261,15 @@ class BaseObject {
 		//! \brief Maximum number of characters that an object name on PostgreSQL can have
 		static constexpr int ObjectNameMaxLength=63;
 
+		/*! \brief Memory categories used when estimating the memory footprint of the object (see getMemoryUsage()).
+		 * MemObjectData: names, comments, custom SQL and the attributes maps.
+		 * MemCachedCode: the cached SQL/XML code.
+		 * MemParserBuffers: the buffers and attributes held by the object's schema parser. */
+		static constexpr unsigned MemObjectData=0,
+		MemCachedCode=1,
+		MemParserBuffers=2,
+		MemCategoryCount=3;
+
 		/*! \brief The default number of objects supposed to be stored in objects list.
 		 * This values is just a reference (hint) and is used to preallocate (reserve) space on vectors which handle objects
 		 * to avoid excessive allocation/deallocation by resizing the vectors due to insert operation */
@@ -481,6 +506,12 @@ class BaseObject {
 		//! \brief Returns if the code (sql and xml) is invalidated
 		bool isCodeInvalidated(void);
 
+		/*! \brief Returns a hash of the object's xml code without the provided attributes and tags, so two objects
+		 * of the same type have the same hash only when the code compared by isCodeDiffersFrom() using the same ignored
+		 * attributes and tags is identical. The hash is cached until the object's code is invalidated or it is requested
+		 * with a different set of ignored attributes/tags. When the cached code support is disabled it is calculated on every call */
+		virtual QByteArray getContentHash(const vector<QString> &ignored_attribs={}, const vector<QString> &ignored_tags={});
+
 		/*! \brief Compares the xml code between the "this" object and another one. The user can specify which attributes
 		and tags must be ignored when makin the comparison. NOTE: only the name for attributes and tags must be informed */
 		virtual bool isCodeDiffersFrom(BaseObject *object, const vector<QString> &ignored_attribs={}, const vector<QString> &ignored_tags={});
@@ -506,12 +537,21 @@ class BaseObject {
 				is based upon this one */
 		static void setPgSQLVersion(const QString &ver);
 
-		//! \brief Returns the current version for SQL code generation
+		/*! \brief Overrides the version used when generating the SQL code only for the calling thread so
+		 * code can be generated for a specific server (e.g. diff) without affecting the other threads.
+		 * An empty version removes the override */
+		static void setThreadPgSQLVersion(const QString &ver);
+
+		//! \brief Returns the current version for SQL code generation (considering the calling thread's override)
 		static QString getPgSQLVersion(void);
 
 		//! \brief Returns the set of attributes used by the search mechanism
 		attribs_map getSearchAttributes(void);
 
+		/*! \brief Returns an estimation of the heap memory (in bytes) held by the object in the provided category
+		 * (see MemObjectData, MemCachedCode, MemParserBuffers). The size of the object's class itself isn't included */
+		virtual size_t getMemoryUsage(unsigned mem_cat);
+
 		friend class DatabaseModel;
 		friend class ModelValidationHelper;
 		friend class DatabaseImportHelper;
@@ -460,6 +460,26 @@ vector<Column *> Constraint::getRelationshipAddedColumns(void)
 	return(cols);
 }
 
+void Constraint::remapColumns(const map<Column *, Column *> &col_map)
+{
+	for(auto cols : { &columns, &ref_columns })
+	{
+		for(auto &col : *cols)
+		{
+			if(col_map.count(col))
+				col = col_map.at(col);
+		}
+	}
+
+	for(auto &elem : excl_elements)
+	{
+		if(elem.getColumn() && col_map.count(elem.getColumn()))
+			elem.setColumn(col_map.at(elem.getColumn()));
+	}
+
+	setCodeInvalidated(true);
+}
+
 MatchType Constraint::getMatchType(void)
 {
 	return(match_type);
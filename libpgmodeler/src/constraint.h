@@ -205,6 +205,10 @@ class Constraint: public TableObject{
 	added by relationship */
 		vector<Column *> getRelationshipAddedColumns(void);
 
+		/*! \brief Replaces the referenced columns by the ones associated to them in the provided map.
+		 * This is used to make a cloned object reference the columns of the cloned table (see DatabaseModel::cloneObjects()) */
+		void remapColumns(const map<Column *, Column *> &col_map);
+
 		//! \brief Returns the matching type adopted by the constraint
 		MatchType getMatchType(void);
 
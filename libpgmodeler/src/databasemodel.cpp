@@ -19,8 +19,9 @@
 #include "databasemodel.h"
 #include "pgmodelerns.h"
 #include <QtDebug>
+#include <QSet>
 
-unsigned DatabaseModel::dbmodel_id=2000;
+atomic<unsigned> DatabaseModel::dbmodel_id(2000);
 
 DatabaseModel::DatabaseModel(void)
 {
@@ -459,6 +460,9 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 			obj_list->push_back(object);
 	}
 
+	if(obj_type==ObjectType::BaseRelationship)
+		indexViewRelationship(dynamic_cast<BaseRelationship *>(object));
+
 	object->setDatabase(this);
 	emit s_objectAdded(object);
 	this->setInvalidated(true);
@@ -527,6 +531,14 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 					removePermissions(object);
 
 				obj_list->erase(obj_list->begin() + obj_idx);
+
+				if(obj_type==ObjectType::BaseRelationship)
+					indexViewRelationship(dynamic_cast<BaseRelationship *>(object), true);
+				else if(obj_type==ObjectType::View)
+				{
+					indexViewReferences(dynamic_cast<View *>(object), true);
+					view_relationships.erase(dynamic_cast<View *>(object));
+				}
 			}
 		}
 
@@ -823,6 +835,10 @@ void DatabaseModel::destroyObjects(void)
 		for(auto type : rem_obj_types)
 			getObjectList(type)->clear();
 	}
+
+	view_references.clear();
+	referencing_views.clear();
+	view_relationships.clear();
 }
 
 void DatabaseModel::addTable(Table *table, int obj_idx)
@@ -1363,9 +1379,9 @@ void DatabaseModel::updateViewRelationships(View *view, bool force_rel_removal)
 {
 	PhysicalTable *table=nullptr;
 	BaseRelationship *rel=nullptr;
-	Reference ref;
-	unsigned i, ref_count, idx;
-	vector<BaseObject *>::iterator itr, itr_end;
+	unsigned i, ref_count;
+	vector<BaseRelationship *> rels;
+	vector<BaseObject *> *refs=nullptr;
 	vector<PhysicalTable *> tables;
 
 	if(!view)
@@ -1374,62 +1390,34 @@ void DatabaseModel::updateViewRelationships(View *view, bool force_rel_removal)
 	if(getObjectIndex(view) < 0 || force_rel_removal)
 	{
 		//Remove all the relationship related to the view when this latter no longer exists
-		itr=base_relationships.begin();
-		itr_end=base_relationships.end();
+		if(view_relationships.count(view))
+			rels=view_relationships[view];
 
-		idx=0;
-		while(itr!=itr_end)
-		{
-			rel=dynamic_cast<BaseRelationship *>(*itr);
+		for(auto &view_rel : rels)
+			removeRelationship(view_rel);
 
-			if(rel->getTable(BaseRelationship::SrcTable)==view ||
-					rel->getTable(BaseRelationship::DstTable)==view)
-			{
-				removeRelationship(rel);
-				itr=base_relationships.begin() + idx;
-				itr_end=base_relationships.end();
-			}
-			else
-			{
-				itr++; idx++;
-			}
-		}
+		view_relationships.erase(view);
+		indexViewReferences(view, true);
 	}
 	else
 	{
+		indexViewReferences(view);
+		refs=&view_references[view];
+
 		/* Remove the relationships between tables and the view
 		 when this latter doesn't reference the first */
-		itr=base_relationships.begin();
-		itr_end=base_relationships.end();
+		if(view_relationships.count(view))
+			rels=view_relationships[view];
 
-		idx=0;
-		while(itr!=itr_end)
+		for(auto &view_rel : rels)
 		{
-			rel=dynamic_cast<BaseRelationship *>(*itr);
-
-			if(rel->getTable(BaseRelationship::SrcTable)==view ||
-					rel->getTable(BaseRelationship::DstTable)==view)
-			{
-				if(rel->getTable(BaseRelationship::SrcTable)->getObjectType()==ObjectType::Table)
-					table=dynamic_cast<PhysicalTable *>(rel->getTable(BaseRelationship::SrcTable));
-				else
-					table=dynamic_cast<PhysicalTable *>(rel->getTable(BaseRelationship::DstTable));
-
-				if(!view->isReferencingTable(table))
-				{
-					removeRelationship(rel);
-					itr=base_relationships.begin() + idx;
-					itr_end=base_relationships.end();
-				}
-				else
-				{
-					itr++; idx++;
-				}
-			}
+			if(view_rel->getTable(BaseRelationship::SrcTable)==view)
+				table=dynamic_cast<PhysicalTable *>(view_rel->getTable(BaseRelationship::DstTable));
 			else
-			{
-				itr++; idx++;
-			}
+				table=dynamic_cast<PhysicalTable *>(view_rel->getTable(BaseRelationship::SrcTable));
+
+			if(std::find(refs->begin(), refs->end(), table)==refs->end())
+				removeRelationship(view_rel);
 		}
 
 		/* Creates the relationships from the view references
@@ -1450,7 +1438,20 @@ void DatabaseModel::updateViewRelationships(View *view, bool force_rel_removal)
 		// Effectively creating the relationships
 		for(auto &tab : tables)
 		{
-			rel = getRelationship(view, tab);
+			rel = nullptr;
+
+			if(view_relationships.count(view))
+			{
+				for(auto &view_rel : view_relationships[view])
+				{
+					if(view_rel->getTable(BaseRelationship::SrcTable)==tab ||
+						 view_rel->getTable(BaseRelationship::DstTable)==tab)
+					{
+						rel = view_rel;
+						break;
+					}
+				}
+			}
 
 			if(!rel)
 			{
@@ -1462,6 +1463,103 @@ void DatabaseModel::updateViewRelationships(View *view, bool force_rel_removal)
 	}
 }
 
+void DatabaseModel::indexViewReferences(View *view, bool unindex)
+{
+	vector<BaseObject *> &refs=view_references[view];
+	vector<BaseObject *> ref_objs;
+	Reference ref;
+	unsigned count=view->getReferenceCount();
+
+	//Removing the view from the entries of the objects it referenced until now
+	for(auto &obj : refs)
+	{
+		vector<View *> &views=referencing_views[obj];
+
+		views.erase(std::remove(views.begin(), views.end(), view), views.end());
+
+		if(views.empty())
+			referencing_views.erase(obj);
+	}
+
+	refs.clear();
+
+	if(unindex)
+	{
+		view_references.erase(view);
+		return;
+	}
+
+	for(unsigned i=0; i < count; i++)
+	{
+		ref=view->getReference(i);
+		ref_objs.clear();
+
+		if(ref.isDefinitionExpression())
+		{
+			vector<PhysicalTable *> ref_tabs=ref.getReferencedTables();
+			ref_objs.assign(ref_tabs.begin(), ref_tabs.end());
+		}
+		else
+		{
+			ref_objs.push_back(ref.getTable());
+			ref_objs.push_back(ref.getColumn());
+		}
+
+		for(auto &obj : ref_objs)
+		{
+			if(obj && std::find(refs.begin(), refs.end(), obj)==refs.end())
+			{
+				refs.push_back(obj);
+				referencing_views[obj].push_back(view);
+			}
+		}
+	}
+}
+
+void DatabaseModel::indexViewRelationship(BaseRelationship *rel, bool unindex)
+{
+	View *view=dynamic_cast<View *>(rel->getTable(BaseRelationship::SrcTable));
+
+	if(!view)
+		view=dynamic_cast<View *>(rel->getTable(BaseRelationship::DstTable));
+
+	if(!view)
+		return;
+
+	vector<BaseRelationship *> &rels=view_relationships[view];
+	auto itr=std::find(rels.begin(), rels.end(), rel);
+
+	if(unindex && itr!=rels.end())
+		rels.erase(itr);
+	else if(!unindex && itr==rels.end())
+		rels.push_back(rel);
+
+	if(rels.empty())
+		view_relationships.erase(view);
+}
+
+vector<View *> DatabaseModel::getReferencingViews(BaseObject *object)
+{
+	vector<View *> views;
+	PhysicalTable *table=dynamic_cast<PhysicalTable *>(object);
+	Column *column=dynamic_cast<Column *>(object);
+	auto itr=referencing_views.find(object);
+
+	if(itr==referencing_views.end())
+		return(views);
+
+	/* The entries are checked against the views references since the index can hold an
+	 * object removed from the model whose memory address was reused by a new one */
+	for(auto &view : itr->second)
+	{
+		if((table && view->isReferencingTable(table)) ||
+			 (column && view->isReferencingColumn(column)))
+			views.push_back(view);
+	}
+
+	return(views);
+}
+
 void DatabaseModel::disconnectRelationships(void)
 {
 	try
@@ -1503,8 +1601,10 @@ void DatabaseModel::validateRelationships(void)
 	Relationship *rel=nullptr;
 	BaseRelationship *base_rel=nullptr;
 	vector<BaseObject *> vet_rel, vet_rel_inv, rels, fail_rels;
-	bool found_inval_rel, valid_fail_rels=false;
+	bool found_inval_rel, valid_fail_rels=false, conn_failed=false, pks_missing=false;
 	vector<Exception> errors;
+	Exception conn_error;
+	ErrorCode conn_err_code=ErrorCode::Custom;
 	map<unsigned, QString>::iterator itr1, itr1_end;
 	map<unsigned, Exception> error_map;
 	map<unsigned, Exception>::iterator itr2, itr2_end;
@@ -1600,11 +1700,33 @@ void DatabaseModel::validateRelationships(void)
 					itr_ant=itr;
 					itr++;
 
-					try
+					conn_failed=pks_missing=false;
+
+					/* Checking the primary keys needed by the relationship before trying to connect it avoids
+					raising and handling an exception on each retry while the primary keys added by other relationships
+					are not created yet. The error itself is only configured if the relationship needs to be removed */
+					if(!rel->hasRequiredPrimaryKeys())
+					{
+						conn_failed=pks_missing=true;
+						conn_err_code=ErrorCode::InvLinkTablesNoPrimaryKey;
+					}
+					else
 					{
-						//Try to connect the relationship
-						rel->connectRelationship();
+						try
+						{
+							//Try to connect the relationship
+							rel->connectRelationship();
+						}
+						catch(Exception &e)
+						{
+							conn_failed=true;
+							conn_err_code=e.getErrorCode();
+							conn_error=e;
+						}
+					}
 
+					if(!conn_failed)
+					{
 						//Storing the schemas on a auxiliary vector to update them later
 						tab1=rel->getTable(BaseRelationship::SrcTable);
 						tab2=rel->getTable(BaseRelationship::DstTable);
@@ -1636,14 +1758,18 @@ void DatabaseModel::validateRelationships(void)
 					}
 					/* Case some error is raised during the connection the relationship is
 						 permanently invalidated and need to be removed from the model */
-					catch(Exception &e)
+					else
 					{
 						/* If the relationship connection failed after 'rels_gen_pk' times at the
 						different errors or exists on the fail_rels vector (already tried to be validated)
 						it will be deleted from model */
-						if((e.getErrorCode() != ErrorCode::InvLinkTablesNoPrimaryKey && conn_tries[rel] > rels_gen_pk) ||
+						if((conn_err_code != ErrorCode::InvLinkTablesNoPrimaryKey && conn_tries[rel] > rels_gen_pk) ||
 								(std::find(fail_rels.begin(), fail_rels.end(), rel)!=fail_rels.end()))
 						{
+							//Configures the error in case it was detected without an exception
+							if(pks_missing)
+								rel->hasRequiredPrimaryKeys(&conn_error);
+
 							//Removes the relationship
 							__removeObject(rel);
 
@@ -1651,13 +1777,13 @@ void DatabaseModel::validateRelationships(void)
 							rels.erase(itr_ant);
 
 							//Stores the error raised in a list
-							errors.push_back(e);
+							errors.push_back(conn_error);
 						}
 						/* If the relationship connection fails with the ERR_LINK_TABLES_NO_PK error and
 								the connection tries exceed the size of the relationship the relationship is isolated
 								on a "failed to validate" list. This list will be appended to the main rel list when
 								there is only one relationship to be validated */
-						else if(e.getErrorCode()==ErrorCode::InvLinkTablesNoPrimaryKey &&
+						else if(conn_err_code==ErrorCode::InvLinkTablesNoPrimaryKey &&
 								(conn_tries[rel] > rels.size() ||
 								 rel->getRelationshipType()==BaseRelationship::RelationshipNn))
 						{
@@ -3803,6 +3929,7 @@ Schema *DatabaseModel::createSchema(void)
 		setBasicAttributes(schema);
 		schema->setFillColor(QColor(attribs[Attributes::FillColor]));
 		schema->setRectVisible(attribs[Attributes::RectVisible]==Attributes::True);
+		schema->setCollapsed(attribs[Attributes::Collapsed]==Attributes::True);
 		schema->setFadedOut(attribs[Attributes::FadedOut]==Attributes::True);
 		schema->setLayer(attribs[Attributes::Layer].toUInt());
 	}
@@ -6182,29 +6309,14 @@ ForeignTable *DatabaseModel::createForeignTable(void)
 
 void DatabaseModel::updateViewsReferencingTable(PhysicalTable *table)
 {
-	BaseRelationship *rel = nullptr;
-	View *view = nullptr;
-	PhysicalTable *tab = nullptr;
-
 	if(!table) return;
 
-	for(auto obj : base_relationships)
+	for(auto &view : getReferencingViews(table))
 	{
-		rel = dynamic_cast<BaseRelationship *>(obj);
-
-		if(rel->getRelationshipType() != BaseRelationship::RelationshipDep)
-			continue;
-
-		view = dynamic_cast<View *>(rel->getTable(BaseRelationship::SrcTable));
-		tab = dynamic_cast<PhysicalTable *>(rel->getTable(BaseRelationship::DstTable));
-
-		if(view && tab == table)
-		{
-			view->generateColumns();
-			view->setCodeInvalidated(true);
-			view->setModified(true);
-			dynamic_cast<Schema *>(view->getSchema())->setModified(true);
-		}
+		view->generateColumns();
+		view->setCodeInvalidated(true);
+		view->setModified(true);
+		dynamic_cast<Schema *>(view->getSchema())->setModified(true);
 	}
 }
 
@@ -7127,47 +7239,11 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 {
 	try
 	{
-		bool revalidate_rels=false, ref_tab_inheritance=false;
-		Relationship *rel=nullptr;
-		vector<BaseObject *>::iterator itr, itr_end;
-		ObjectType obj_type;
-
-		if(object && parent_tab)
+		if(isRelationshipsRevalidationNeeded(object, parent_tab))
 		{
-			obj_type=object->getObjectType();
-
-			/* Relationship validation condition:
-			> Case the object is a column and its reference by the parent table primary key
-			> Case the parent table is a partition and a column is being removed
-			> Case the object is a constraint and its a table primary key */
-			revalidate_rels=((obj_type==ObjectType::Column &&
-												(parent_tab->isConstraintRefColumn(dynamic_cast<Column *>(object), ConstraintType::PrimaryKey) ||
-												 parent_tab->isPartition() || parent_tab->isPartitioned())) ||
-											 (obj_type==ObjectType::Constraint &&
-												dynamic_cast<Constraint *>(object)->getConstraintType()==ConstraintType::PrimaryKey));
-
-			/* Additional validation for columns: checks if the parent table participates on a
-			generalization/copy as destination table */
-			if(obj_type==ObjectType::Column)
-			{
-				itr=relationships.begin();
-				itr_end=relationships.end();
-
-				while(itr!=itr_end && !ref_tab_inheritance)
-				{
-					rel=dynamic_cast<Relationship *>(*itr);
-					itr++;
-					ref_tab_inheritance=(rel->getRelationshipType()==Relationship::RelationshipGen &&
-															 rel->getReferenceTable()==parent_tab);
-				}
-			}
-
-			if(revalidate_rels || ref_tab_inheritance)
-			{
-				storeSpecialObjectsXML();
-				disconnectRelationships();
-				validateRelationships();
-			}
+			storeSpecialObjectsXML();
+			disconnectRelationships();
+			validateRelationships();
 		}
 	}
 	catch(Exception &e)
@@ -7176,6 +7252,47 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 	}
 }
 
+bool DatabaseModel::isRelationshipsRevalidationNeeded(TableObject *object, Table *parent_tab)
+{
+	bool revalidate_rels=false, ref_tab_inheritance=false;
+	Relationship *rel=nullptr;
+	vector<BaseObject *>::iterator itr, itr_end;
+	ObjectType obj_type;
+
+	if(!object || !parent_tab)
+		return(false);
+
+	obj_type=object->getObjectType();
+
+	/* Relationship validation condition:
+	> Case the object is a column and its reference by the parent table primary key
+	> Case the parent table is a partition and a column is being removed
+	> Case the object is a constraint and its a table primary key */
+	revalidate_rels=((obj_type==ObjectType::Column &&
+										(parent_tab->isConstraintRefColumn(dynamic_cast<Column *>(object), ConstraintType::PrimaryKey) ||
+										 parent_tab->isPartition() || parent_tab->isPartitioned())) ||
+									 (obj_type==ObjectType::Constraint &&
+										dynamic_cast<Constraint *>(object)->getConstraintType()==ConstraintType::PrimaryKey));
+
+	/* Additional validation for columns: checks if the parent table participates on a
+	generalization/copy as destination table */
+	if(!revalidate_rels && obj_type==ObjectType::Column)
+	{
+		itr=relationships.begin();
+		itr_end=relationships.end();
+
+		while(itr!=itr_end && !ref_tab_inheritance)
+		{
+			rel=dynamic_cast<Relationship *>(*itr);
+			itr++;
+			ref_tab_inheritance=(rel->getRelationshipType()==Relationship::RelationshipGen &&
+													 rel->getReferenceTable()==parent_tab);
+		}
+	}
+
+	return(revalidate_rels || ref_tab_inheritance);
+}
+
 QString DatabaseModel::__getCodeDefinition(unsigned def_type)
 {
 	QString def, bkp_appended_sql, bkp_prepended_sql;
@@ -7260,12 +7377,28 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 	BaseObject *object=nullptr;
 	QString def, search_path=QString("pg_catalog,public"),
 			msg=trUtf8("Generating %1 code: `%2' (%3)"),
-			attrib=Attributes::Objects, attrib_aux,
-			def_type_str=(def_type==SchemaParser::SqlDefinition ? QString("SQL") : QString("XML"));
+			attrib=Attributes::Objects, attrib_aux;
 	Type *usr_type=nullptr;
 	map<unsigned, BaseObject *> objects_map;
 	ObjectType obj_type;
 
+	//The XML code is assembled from the same snapshot used to save the model in background
+	if(def_type==SchemaParser::XmlDefinition)
+	{
+		map<QString, QStringList> obj_defs;
+
+		try
+		{
+			getXMLSnapshot(attribs_aux, obj_defs, true);
+			attribs_aux[Attributes::ExportToFile]=(export_file ? Attributes::True : QString());
+			return(getXMLDefinition(attribs_aux, obj_defs));
+		}
+		catch(Exception &e)
+		{
+			throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		}
+	}
+
 	try
 	{
 		objects_map=getCreationOrder(def_type);
@@ -7277,18 +7410,14 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 		attribs_aux[Attributes::Schema]=QString();
 		attribs_aux[Attributes::Tablespace]=QString();
 		attribs_aux[Attributes::Role]=QString();
+		attribs_aux[Attributes::Function]=(!functions.empty() ? Attributes::True : QString());
 
-		if(def_type==SchemaParser::SqlDefinition)
+		for(auto &type : types)
 		{
-			attribs_aux[Attributes::Function]=(!functions.empty() ? Attributes::True : QString());
+			usr_type=dynamic_cast<Type *>(type);
 
-			for(auto &type : types)
-			{
-				usr_type=dynamic_cast<Type *>(type);
-
-				if(usr_type->getConfiguration()==Type::BaseType)
-					usr_type->convertFunctionParameters();
-			}
+			if(usr_type->getConfiguration()==Type::BaseType)
+				usr_type->convertFunctionParameters();
 		}
 
 		for(auto &obj_itr : objects_map)
@@ -7296,7 +7425,7 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 			object=obj_itr.second;
 			obj_type=object->getObjectType();
 
-			if(obj_type==ObjectType::Type && def_type==SchemaParser::SqlDefinition)
+			if(obj_type==ObjectType::Type)
 			{
 				usr_type=dynamic_cast<Type *>(object);
 
@@ -7308,23 +7437,18 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 			}
 			else if(obj_type==ObjectType::Database)
 			{
-				if(def_type==SchemaParser::SqlDefinition)
-				{
-					/* The Database has the SQL code definition disabled when generating the
+				/* The Database has the SQL code definition disabled when generating the
 		  code of the entire model because this object cannot be created from a multiline sql command */
 
-					//Saving the sql disabled state
-					sql_disabled=this->isSQLDisabled();
+				//Saving the sql disabled state
+				sql_disabled=this->isSQLDisabled();
 
-					//Disables the sql to generate a commented code
-					this->setSQLDisabled(true);
-					attribs_aux[this->getSchemaName()]+=this->__getCodeDefinition(def_type);
+				//Disables the sql to generate a commented code
+				this->setSQLDisabled(true);
+				attribs_aux[this->getSchemaName()]+=this->__getCodeDefinition(def_type);
 
-					//Restore the original sql disabled state
-					this->setSQLDisabled(sql_disabled);
-				}
-				else
-					attribs_aux[attrib]+=this->__getCodeDefinition(def_type);
+				//Restore the original sql disabled state
+				this->setSQLDisabled(sql_disabled);
 			}
 			else if(obj_type==ObjectType::Permission)
 			{
@@ -7336,15 +7460,11 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 			}
 			else if(obj_type==ObjectType::Role || obj_type==ObjectType::Tablespace ||  obj_type==ObjectType::Schema)
 			{
-				//The "public" schema does not have the SQL code definition generated
-				if(def_type==SchemaParser::SqlDefinition)
-					attrib_aux=BaseObject::getSchemaName(obj_type);
-				else
-					attrib_aux=attrib;
+				attrib_aux=BaseObject::getSchemaName(obj_type);
 
 				/* The Tablespace has the SQL code definition disabled when generating the
 		  code of the entire model because this object cannot be created from a multiline sql command */
-				if(obj_type==ObjectType::Tablespace && !object->isSystemObject() && def_type==SchemaParser::SqlDefinition)
+				if(obj_type==ObjectType::Tablespace && !object->isSystemObject())
 				{
 					//Saving the sql disabled state
 					sql_disabled=object->isSQLDisabled();
@@ -7356,11 +7476,10 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 					//Restore the original sql disabled state
 					object->setSQLDisabled(sql_disabled);
 				}
-				//System object doesn't has the XML generated (the only exception is for public schema)
+				//System objects and the "public" schema does not have the SQL code definition generated
 				else if((obj_type!=ObjectType::Schema && !object->isSystemObject()) ||
 						(obj_type==ObjectType::Schema &&
-						 ((object->getName()==QString("public") && def_type==SchemaParser::XmlDefinition) ||
-						  (object->getName()!=QString("public") && object->getName()!=QString("pg_catalog")))))
+						 object->getName()!=QString("public") && object->getName()!=QString("pg_catalog")))
 				{
 					if(object->getObjectType()==ObjectType::Schema)
 						search_path+=QString(",") + object->getName(true);
@@ -7379,11 +7498,10 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 
 			gen_defs_count++;
 
-			if((def_type==SchemaParser::SqlDefinition && !object->isSQLDisabled()) ||
-					(def_type==SchemaParser::XmlDefinition && !object->isSystemObject()))
+			if(!object->isSQLDisabled())
 			{
 				emit s_objectLoaded((gen_defs_count/static_cast<double>(general_obj_cnt)) * 100,
-									msg.arg(def_type_str)
+									msg.arg(QString("SQL"))
 									.arg(object->getName())
 									.arg(object->getTypeName()),
 									enum_cast(object->getObjectType()));
@@ -7394,49 +7512,25 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 		attribs_aux[Attributes::ModelAuthor]=author;
 		attribs_aux[Attributes::PgModelerVersion]=GlobalAttributes::PgModelerVersion;
 
-		if(def_type==SchemaParser::XmlDefinition)
+		for(auto &type : types)
 		{
-			QStringList act_layers;
-
-			for(auto &layer_id : active_layers)
-				act_layers.push_back(QString::number(layer_id));
-
-			attribs_aux[Attributes::Layers]=layers.join(';');
-			attribs_aux[Attributes::ActiveLayers]=act_layers.join(';');
-			attribs_aux[Attributes::MaxObjCount]=QString::number(static_cast<unsigned>(getMaxObjectCount() * 1.20));
-			attribs_aux[Attributes::Protected]=(this->is_protected ? Attributes::True : QString());
-			attribs_aux[Attributes::LastPosition]=QString("%1,%2").arg(last_pos.x()).arg(last_pos.y());
-			attribs_aux[Attributes::LastZoom]=QString::number(last_zoom);
-			attribs_aux[Attributes::DefaultSchema]=(default_objs[ObjectType::Schema] ? default_objs[ObjectType::Schema]->getName(true) : QString());
-			attribs_aux[Attributes::DefaultOwner]=(default_objs[ObjectType::Role] ? default_objs[ObjectType::Role]->getName(true) : QString());
-			attribs_aux[Attributes::DefaultTablespace]=(default_objs[ObjectType::Tablespace] ? default_objs[ObjectType::Tablespace]->getName(true) : QString());
-			attribs_aux[Attributes::DefaultCollation]=(default_objs[ObjectType::Collation] ? default_objs[ObjectType::Collation]->getName(true) : QString());
-		}
-		else
-		{
-			for(auto &type : types)
+			usr_type=dynamic_cast<Type *>(type);
+			if(usr_type->getConfiguration()==Type::BaseType)
 			{
-				usr_type=dynamic_cast<Type *>(type);
-				if(usr_type->getConfiguration()==Type::BaseType)
-				{
-					attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
-					usr_type->convertFunctionParameters(true);
-				}
+				attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
+				usr_type->convertFunctionParameters(true);
 			}
 		}
 	}
 	catch(Exception &e)
 	{
-		if(def_type==SchemaParser::SqlDefinition)
+		for(auto &type : types)
 		{
-			for(auto &type : types)
+			usr_type=dynamic_cast<Type *>(type);
+			if(usr_type->getConfiguration()==Type::BaseType)
 			{
-				usr_type=dynamic_cast<Type *>(type);
-				if(usr_type->getConfiguration()==Type::BaseType)
-				{
-					attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
-					usr_type->convertFunctionParameters(true);
-				}
+				attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
+				usr_type->convertFunctionParameters(true);
 			}
 		}
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
@@ -7902,6 +7996,350 @@ void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
 	}
 }
 
+void DatabaseModel::getXMLSnapshot(attribs_map &attribs, map<QString, QStringList> &obj_defs, bool emit_progress)
+{
+	map<unsigned, BaseObject *> objects_map;
+	BaseObject *object=nullptr;
+	ObjectType obj_type;
+	QStringList act_layers;
+	QString search_path=QString("pg_catalog,public"),
+			msg=trUtf8("Generating %1 code: `%2' (%3)");
+	unsigned def_type=SchemaParser::XmlDefinition, gen_defs_count=0;
+
+	attribs.clear();
+	obj_defs.clear();
+
+	try
+	{
+		objects_map=getCreationOrder(def_type);
+
+		/* The objects definitions are only collected here (no concatenation) and, since the code of the objects
+		 * not modified since the last generation comes from their cache, this step is cheap even for huge models */
+		for(auto &obj_itr : objects_map)
+		{
+			object=obj_itr.second;
+			obj_type=object->getObjectType();
+
+			if(obj_type==ObjectType::Database)
+				obj_defs[Attributes::Objects].push_back(this->__getCodeDefinition(def_type));
+			else if(obj_type==ObjectType::Permission)
+				obj_defs[Attributes::Permission].push_back(dynamic_cast<Permission *>(object)->getCodeDefinition(def_type));
+			else if(obj_type==ObjectType::Constraint)
+				obj_defs[Attributes::Objects].push_back(dynamic_cast<Constraint *>(object)->getCodeDefinition(def_type, true));
+			//System schemas doesn't have the XML generated (the only exception is for public schema)
+			else if(obj_type==ObjectType::Schema)
+			{
+				if(object->getName()!=QString("pg_catalog"))
+				{
+					search_path+=QString(",") + object->getName(true);
+					obj_defs[Attributes::Objects].push_back(object->getCodeDefinition(def_type));
+				}
+			}
+			else if(!object->isSystemObject())
+				obj_defs[Attributes::Objects].push_back(object->getCodeDefinition(def_type));
+
+			gen_defs_count++;
+
+			if(emit_progress && !object->isSystemObject())
+			{
+				emit s_objectLoaded((gen_defs_count/static_cast<double>(objects_map.size())) * 100,
+									msg.arg(QString("XML"))
+									.arg(object->getName())
+									.arg(object->getTypeName()),
+									enum_cast(object->getObjectType()));
+			}
+		}
+
+		for(auto &layer_id : active_layers)
+			act_layers.push_back(QString::number(layer_id));
+
+		attribs[Attributes::ShellTypes]=QString();
+		attribs[Attributes::Schema]=QString();
+		attribs[Attributes::Tablespace]=QString();
+		attribs[Attributes::Role]=QString();
+		attribs[Attributes::SearchPath]=search_path;
+		attribs[Attributes::ModelAuthor]=author;
+		attribs[Attributes::PgModelerVersion]=GlobalAttributes::PgModelerVersion;
+		attribs[Attributes::Layers]=layers.join(';');
+		attribs[Attributes::ActiveLayers]=act_layers.join(';');
+		attribs[Attributes::MaxObjCount]=QString::number(static_cast<unsigned>(getMaxObjectCount() * 1.20));
+		attribs[Attributes::Protected]=(this->is_protected ? Attributes::True : QString());
+		attribs[Attributes::LastPosition]=QString("%1,%2").arg(last_pos.x()).arg(last_pos.y());
+		attribs[Attributes::LastZoom]=QString::number(last_zoom);
+		attribs[Attributes::DefaultSchema]=(default_objs[ObjectType::Schema] ? default_objs[ObjectType::Schema]->getName(true) : QString());
+		attribs[Attributes::DefaultOwner]=(default_objs[ObjectType::Role] ? default_objs[ObjectType::Role]->getName(true) : QString());
+		attribs[Attributes::DefaultTablespace]=(default_objs[ObjectType::Tablespace] ? default_objs[ObjectType::Tablespace]->getName(true) : QString());
+		attribs[Attributes::DefaultCollation]=(default_objs[ObjectType::Collation] ? default_objs[ObjectType::Collation]->getName(true) : QString());
+		attribs[Attributes::ExportToFile]=Attributes::True;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+QString DatabaseModel::getXMLDefinition(attribs_map attribs, const map<QString, QStringList> &obj_defs)
+{
+	SchemaParser schparser;
+
+	try
+	{
+		attribs[Attributes::Objects]=QString();
+		attribs[Attributes::Permission]=QString();
+
+		for(auto &itr : obj_defs)
+			attribs[itr.first]=itr.second.join(QString());
+
+		return(schparser.getCodeDefinition(Attributes::DbModel, attribs, SchemaParser::XmlDefinition));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void DatabaseModel::saveSnapshot(const QString &filename, const attribs_map &attribs, const map<QString, QStringList> &obj_defs)
+{
+	QSaveFile output(filename);
+	QByteArray buf;
+
+	output.open(QFile::WriteOnly);
+
+	if(!output.isOpen())
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	try
+	{
+		buf=getXMLDefinition(attribs, obj_defs).toUtf8();
+
+		//The destination file is only replaced when the whole contents is written
+		if(output.write(buf.data(), buf.size())!=buf.size() || !output.commit())
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+	catch(Exception &e)
+	{
+		output.cancelWriting();
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileNotWrittenInvalidDefinition).arg(filename),
+										ErrorCode::FileNotWrittenInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+bool DatabaseModel::canCloneObjects(const vector<BaseObject *> &objects, bool incl_rel_added_objs)
+{
+	QSet<BaseObject *> obj_set;
+	QSet<void *> type_refs;
+	ObjectType obj_type;
+	TableObject *tab_obj=nullptr;
+	Table *table=nullptr;
+	Column *col=nullptr;
+
+	for(auto &object : objects)
+	{
+		obj_set.insert(object);
+
+		//Tables and sequences are referenced as user defined types by their own pointers
+		if(object->getObjectType()==ObjectType::Table)
+			type_refs.insert(dynamic_cast<Table *>(object));
+		else if(object->getObjectType()==ObjectType::Sequence)
+			type_refs.insert(dynamic_cast<Sequence *>(object));
+	}
+
+	for(auto &object : objects)
+	{
+		obj_type=object->getObjectType();
+		tab_obj=dynamic_cast<TableObject *>(object);
+
+		//Table objects are only cloned together with their parent tables
+		if(tab_obj)
+		{
+			if(!tab_obj->getParentTable() || tab_obj->getParentTable()->getObjectType()!=ObjectType::Table ||
+				 !obj_set.contains(tab_obj->getParentTable()))
+				return(false);
+
+			continue;
+		}
+
+		if(object->getDatabase()!=this ||
+			 (obj_type!=ObjectType::Schema && obj_type!=ObjectType::Table &&
+				obj_type!=ObjectType::Sequence && obj_type!=ObjectType::Textbox))
+			return(false);
+
+		table=dynamic_cast<Table *>(object);
+
+		if(!table)
+			continue;
+
+		if(!incl_rel_added_objs && table->isReferRelationshipAddedObject())
+			return(false);
+
+		for(auto &col_obj : *table->getObjectList(ObjectType::Column))
+		{
+			col=dynamic_cast<Column *>(col_obj);
+
+			if(col->getType().isUserType() && type_refs.contains(col->getType().getUserTypeReference()))
+				return(false);
+		}
+	}
+
+	return(true);
+}
+
+void DatabaseModel::cloneObjects(const vector<BaseObject *> &objects, vector<BaseObject *> &clones, bool incl_rel_added_objs)
+{
+	map<BaseObject *, BaseObject *> clone_map;
+	map<Column *, Column *> col_map;
+	vector<BaseObject *> fks;
+	vector<PartitionKey> part_keys;
+	BaseObject *clone=nullptr, *child_clone=nullptr;
+	Table *table=nullptr, *tab_clone=nullptr;
+	Constraint *constr=nullptr;
+	Column *col=nullptr;
+	Sequence *seq=nullptr;
+	Trigger *trig=nullptr;
+
+	clones.clear();
+
+	try
+	{
+		//Creating the clones grouped by type so they can be added to the model in the returned order
+		for(auto type : { ObjectType::Schema, ObjectType::Table, ObjectType::Sequence, ObjectType::Textbox })
+		{
+			for(auto &object : objects)
+			{
+				if(object->getObjectType()!=type || clone_map.count(object))
+					continue;
+
+				clone=nullptr;
+				PgModelerNs::copyObject(&clone, object, type);
+				clone_map[object]=clone;
+				clones.push_back(clone);
+
+				if(type!=ObjectType::Table)
+					continue;
+
+				table=dynamic_cast<Table *>(object);
+				tab_clone=dynamic_cast<Table *>(clone);
+
+				//Columns come first in the child types list so the other children can have their columns remapped
+				for(auto child_type : BaseObject::getChildObjectTypes(ObjectType::Table))
+				{
+					for(auto &tab_obj : *table->getObjectList(child_type))
+					{
+						if(!incl_rel_added_objs && tab_obj->isAddedByRelationship())
+							continue;
+
+						child_clone=nullptr;
+						PgModelerNs::copyObject(&child_clone, tab_obj, child_type);
+						dynamic_cast<TableObject *>(child_clone)->setParentTable(tab_clone);
+
+						col=dynamic_cast<Column *>(child_clone);
+						constr=dynamic_cast<Constraint *>(child_clone);
+
+						if(col)
+						{
+							//Columns added by relationship are cloned as regular columns
+							col->setParentRelationship(nullptr);
+							col_map[dynamic_cast<Column *>(tab_obj)]=col;
+						}
+						else if(constr)
+							constr->remapColumns(col_map);
+						else if(child_type==ObjectType::Index)
+							dynamic_cast<Index *>(child_clone)->remapColumns(col_map);
+						else if(child_type==ObjectType::Trigger)
+							dynamic_cast<Trigger *>(child_clone)->remapColumns(col_map);
+
+						//Foreign keys are attached to the cloned table by the caller (see method's documentation)
+						if(constr && constr->getConstraintType()==ConstraintType::ForeignKey)
+							fks.push_back(constr);
+						else
+							tab_clone->addObject(child_clone);
+
+						child_clone=nullptr;
+					}
+				}
+
+				part_keys=tab_clone->getPartitionKeys();
+
+				if(!part_keys.empty())
+				{
+					for(auto &part_key : part_keys)
+					{
+						if(part_key.getColumn() && col_map.count(part_key.getColumn()))
+							part_key.setColumn(col_map[part_key.getColumn()]);
+					}
+
+					tab_clone->addPartitionKeys(part_keys);
+				}
+			}
+		}
+
+		//Remapping the references between the provided objects to their clones
+		for(auto &itr : clone_map)
+		{
+			clone=itr.second;
+
+			if(clone->getSchema() && clone_map.count(clone->getSchema()))
+				clone->setSchema(clone_map[clone->getSchema()]);
+		}
+
+		for(auto &itr : clone_map)
+		{
+			tab_clone=dynamic_cast<Table *>(itr.second);
+			seq=dynamic_cast<Sequence *>(itr.second);
+
+			if(seq && seq->getOwnerColumn() && col_map.count(seq->getOwnerColumn()))
+				seq->setOwnerColumn(col_map[seq->getOwnerColumn()]);
+
+			if(!tab_clone)
+				continue;
+
+			for(auto &tab_obj : *tab_clone->getObjectList(ObjectType::Column))
+			{
+				col=dynamic_cast<Column *>(tab_obj);
+
+				if(col->getSequence() && clone_map.count(col->getSequence()))
+					col->setSequence(clone_map[col->getSequence()]);
+			}
+
+			for(auto &tab_obj : *tab_clone->getObjectList(ObjectType::Trigger))
+			{
+				trig=dynamic_cast<Trigger *>(tab_obj);
+
+				if(trig->getReferencedTable() && clone_map.count(trig->getReferencedTable()))
+					trig->setReferecendTable(dynamic_cast<BaseTable *>(clone_map[trig->getReferencedTable()]));
+			}
+		}
+
+		//Foreign keys referencing cloned tables are redirected to the clones (tables and columns)
+		for(auto &fk : fks)
+		{
+			constr=dynamic_cast<Constraint *>(fk);
+			constr->remapColumns(col_map);
+
+			if(clone_map.count(constr->getReferencedTable()))
+				constr->setReferencedTable(dynamic_cast<BaseTable *>(clone_map[constr->getReferencedTable()]));
+		}
+
+		clones.insert(clones.end(), fks.begin(), fks.end());
+	}
+	catch(Exception &e)
+	{
+		//Tables destroy their children so only the objects not attached to a clone are destroyed separately
+		delete(child_clone);
+
+		for(auto &fk : fks)
+			delete(fk);
+
+		for(auto &itr : clone_map)
+			delete(itr.second);
+
+		clones.clear();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *> &deps, bool inc_indirect_deps)
 {
 	//Case the object is allocated and is not included in the dependecies list
@@ -8456,7 +8894,6 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 			PhysicalTable *tab=nullptr;
 			Trigger *gat=nullptr;
 			BaseRelationship *base_rel=nullptr;
-			View *view=nullptr;
 			vector<BaseObject *>::iterator itr, itr_end;
 			vector<TableObject *> *tab_objs;
 			unsigned i, count;
@@ -8556,20 +8993,13 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 				itr++;
 			}
 
-			itr=views.begin();
-			itr_end=views.end();
-
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			for(auto &view : getReferencingViews(table))
 			{
-				view=dynamic_cast<View *>(*itr);
-
-				if(view->isReferencingTable(table))
-				{
-					refer=true;
-					refs.push_back(view);
-				}
+				if(exclusion_mode && refer)
+					break;
 
-				itr++;
+				refer=true;
+				refs.push_back(view);
 			}
 
 			/* As base relationship are created automatically by the model they aren't considered
@@ -9491,10 +9921,20 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 			Column *column=dynamic_cast<Column *>(object);
 			vector<BaseObject *> *obj_list=nullptr;
 			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType  obj_types[]={ ObjectType::Sequence, ObjectType::View, ObjectType::Table,
+			ObjectType  obj_types[]={ ObjectType::Sequence, ObjectType::Table,
 																ObjectType::ForeignTable, ObjectType::Relationship };
 			unsigned i, count=sizeof(obj_types)/sizeof(ObjectType);
 
+			//The views referencing the column are retrieved from the view references index
+			for(auto &view : getReferencingViews(column))
+			{
+				if(exclusion_mode && refer)
+					break;
+
+				refer=true;
+				refs.push_back(view);
+			}
+
 			for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
 			{
 				obj_list=getObjectList(obj_types[i]);
@@ -9503,8 +9943,7 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 
 				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
 				{
-					if((obj_types[i]==ObjectType::Sequence && dynamic_cast<Sequence *>(*itr)->getOwnerColumn()==column) ||
-							(obj_types[i]==ObjectType::View && dynamic_cast<View *>(*itr)->isReferencingColumn(column)))
+					if(obj_types[i]==ObjectType::Sequence && dynamic_cast<Sequence *>(*itr)->getOwnerColumn()==column)
 					{
 						refer=true;
 						refs.push_back(*itr);
@@ -9719,20 +10158,50 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 
 void DatabaseModel::__getObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclude_perms)
 {
-	vector<BaseObject *> refs_aux;
 	vector<BaseObject *>::iterator end;
 
-	getObjectReferences(object, refs_aux, exclude_perms);
+	__getObjectReferences(vector<BaseObject *>{ object }, refs, exclude_perms);
+
+	std::sort(refs.begin(), refs.end());
+	end=std::unique(refs.begin(), refs.end());
+	refs.erase(end, refs.end());
+}
+
+void DatabaseModel::__getObjectReferences(const vector<BaseObject *> &objects, vector<BaseObject *> &refs, bool exclude_perms)
+{
+	vector<BaseObject *> refs_aux, pending=objects;
+	QSet<BaseObject *> visited, found;
+	BaseObject *object=nullptr;
 
-	if(!refs_aux.empty())
+	for(auto &obj : objects)
+		visited.insert(obj);
+
+	for(auto &obj : refs)
+		found.insert(obj);
+
+	while(!pending.empty())
 	{
-		refs.insert(refs.end(), refs_aux.begin(), refs_aux.end());
-		std::sort(refs.begin(), refs.end());
-		end=std::unique(refs.begin(), refs.end());
-		refs.erase(end, refs.end());
+		object=pending.back();
+		pending.pop_back();
+
+		refs_aux.clear();
+		getObjectReferences(object, refs_aux, false, exclude_perms);
 
 		for(BaseObject *obj : refs_aux)
-			__getObjectReferences(obj, refs, exclude_perms);
+		{
+			if(!found.contains(obj))
+			{
+				found.insert(obj);
+				refs.push_back(obj);
+			}
+
+			//Each object has its references retrieved only once
+			if(!visited.contains(obj))
+			{
+				visited.insert(obj);
+				pending.push_back(obj);
+			}
+		}
 	}
 }
 
@@ -10489,12 +10958,16 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 	BaseObject *object=nullptr, *new_object=nullptr;
 	BaseTable *src_tab=nullptr, *dst_tab=nullptr, *base_tab=nullptr;
 	vector<QPointF> points;
+	vector<BaseObject *> upd_objs;
+	map<ObjectType, map<QString, BaseObject *>> obj_index;
 	map<QString, unsigned> labels_attrs;
 	vector<QPointF> labels_pos={ QPointF(DNaN,DNaN), QPointF(DNaN,DNaN), QPointF(DNaN,DNaN) };
 	BaseRelationship *rel=nullptr;
 	Schema *schema=nullptr;
 	Tag *tag=nullptr;
-	int progress=0;
+	BaseGraphicObject *graph_obj=nullptr;
+	int progress=0, last_progress=-1;
+	unsigned matched_count=0, missed_count=0;
 	bool load_db_attribs=false, load_objs_pos=false, load_objs_prot=false,
 			load_objs_sqldis=false, load_textboxes=false, load_tags=false,
 			load_custom_sql=false, load_custom_colors=false, load_fadeout=false,
@@ -10543,11 +11016,12 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 						obj_type=BaseObject::getObjectType(elem_name);
 						new_object=createObject(obj_type);
 
-						if(getObjectIndex(new_object->getName(), obj_type) < 0)
+						if(!getObjectFromIndex(obj_index, new_object->getName(), obj_type))
 						{
 							emit s_objectLoaded(progress, trUtf8("Creating object `%1' (%2)")
 																	.arg(new_object->getName()).arg(new_object->getTypeName()), enum_cast(obj_type));
 							addObject(new_object);
+							obj_index[obj_type][new_object->getSignature().remove('"')]=new_object;
 						}
 						else
 						{
@@ -10563,6 +11037,7 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 					{
 						xmlparser.getElementAttributes(attribs);
 						obj_name=attribs[Attributes::Object];
+						object=base_tab=nullptr;
 						xmlparser.savePosition();
 
 						obj_type=BaseObject::getObjectType(attribs[Attributes::Type]);
@@ -10574,10 +11049,10 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 							{
 								QStringList pos=attribs[Attributes::LastPosition].split(',');
 
-								default_objs[ObjectType::Schema]=getSchema(attribs[Attributes::DefaultSchema]);
-								default_objs[ObjectType::Role]=getRole(attribs[Attributes::DefaultOwner]);
-								default_objs[ObjectType::Collation]=getCollation(attribs[Attributes::DefaultCollation]);
-								default_objs[ObjectType::Tablespace]=getTablespace(attribs[Attributes::DefaultTablespace]);
+								default_objs[ObjectType::Schema]=getObjectFromIndex(obj_index, attribs[Attributes::DefaultSchema], ObjectType::Schema);
+								default_objs[ObjectType::Role]=getObjectFromIndex(obj_index, attribs[Attributes::DefaultOwner], ObjectType::Role);
+								default_objs[ObjectType::Collation]=getObjectFromIndex(obj_index, attribs[Attributes::DefaultCollation], ObjectType::Collation);
+								default_objs[ObjectType::Tablespace]=getObjectFromIndex(obj_index, attribs[Attributes::DefaultTablespace], ObjectType::Tablespace);
 								author=attribs[Attributes::ModelAuthor];
 								last_zoom=attribs[Attributes::LastZoom].toDouble();
 
@@ -10589,10 +11064,10 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 						}
 						else if(TableObject::isTableObject(obj_type))
 						{
-							base_tab = getTable(attribs[Attributes::Table]);
+							base_tab = dynamic_cast<BaseTable *>(getObjectFromIndex(obj_index, attribs[Attributes::Table], ObjectType::Table));
 
 							if(!base_tab && (obj_type == ObjectType::Rule || obj_type == ObjectType::Index || obj_type == ObjectType::Trigger))
-								base_tab = getView(attribs[Attributes::Table]);
+								base_tab = dynamic_cast<BaseTable *>(getObjectFromIndex(obj_index, attribs[Attributes::Table], ObjectType::View));
 
 							if(base_tab)
 								object = base_tab->getObject(attribs[Attributes::Object], obj_type);
@@ -10602,23 +11077,41 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 								object = nullptr;
 						}
 						else
-							object=getObject(obj_name, obj_type);
+							object=getObjectFromIndex(obj_index, obj_name, obj_type);
 
 						/* If the object does not exists but it is a relationship, we try to get the relationship
 						 involving the tables in paramenters src-table and dst-table */
 						if(!object && obj_type==ObjectType::Relationship)
 						{
-							src_tab=dynamic_cast<BaseTable *>(getObject(attribs[Attributes::SrcTable],
-																								BaseObject::getObjectType(attribs[Attributes::SrcType])));
-							dst_tab=dynamic_cast<BaseTable *>(getObject(attribs[Attributes::DstTable],
-																								BaseObject::getObjectType(attribs[Attributes::DstType])));
+							src_tab=dynamic_cast<BaseTable *>(getObjectFromIndex(obj_index, attribs[Attributes::SrcTable],
+																																		 BaseObject::getObjectType(attribs[Attributes::SrcType])));
+							dst_tab=dynamic_cast<BaseTable *>(getObjectFromIndex(obj_index, attribs[Attributes::DstTable],
+																																		 BaseObject::getObjectType(attribs[Attributes::DstType])));
 							object=getRelationship(src_tab, dst_tab);
 						}
 
 						if(object)
 						{
-							emit s_objectLoaded(progress, trUtf8("Loading metadata for object `%1' (%2)")
-																	.arg(object->getName()).arg(object->getTypeName()), enum_cast(obj_type));
+							matched_count++;
+
+							/* In order to avoid flooding the output with thousands of messages for large models
+							 we only report the progress when its value really changes */
+							if(progress != last_progress)
+							{
+								emit s_objectLoaded(progress, trUtf8("Loading metadata for object `%1' (%2)")
+																		.arg(object->getName()).arg(object->getTypeName()), enum_cast(obj_type));
+								last_progress=progress;
+							}
+
+							/* Graphical objects have their signals blocked while the metadata is being applied
+							 so their graphical representations are updated only once at the end of the process */
+							graph_obj=dynamic_cast<BaseGraphicObject *>(TableObject::isTableObject(obj_type) ? base_tab : object);
+
+							if(graph_obj && !graph_obj->signalsBlocked())
+							{
+								graph_obj->blockSignals(true);
+								upd_objs.push_back(graph_obj);
+							}
 
 							if(!object->isSystemObject() &&
 								 ((!attribs[Attributes::Protected].isEmpty() && load_objs_prot) ||
@@ -10632,7 +11125,7 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 							}
 							else if((obj_type==ObjectType::Table || obj_type==ObjectType::View) && load_tags && !attribs[Attributes::Tag].isEmpty())
 							{
-								tag=getTag(attribs[Attributes::Tag]);
+								tag=dynamic_cast<Tag *>(getObjectFromIndex(obj_index, attribs[Attributes::Tag], ObjectType::Tag));
 
 								if(tag)
 									dynamic_cast<BaseTable *>(object)->setTag(tag);
@@ -10746,6 +11239,7 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 						}
 						else if(!object)
 						{
+							missed_count++;
 							emit s_objectLoaded(progress, trUtf8("Object `%1' (%2) not found. Ignoring metadata.")
 																	.arg(obj_name).arg(BaseObject::getTypeName(obj_type)), enum_cast(ObjectType::BaseObject));
 						}
@@ -10758,13 +11252,32 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 			while(xmlparser.accessElement(XmlParser::NextElement));
 		}
 
-		emit s_objectLoaded(100, trUtf8("Metadata file successfully loaded!"), enum_cast(ObjectType::BaseObject));
-		setObjectsModified();
+		/* Including the schemas of the affected tables and views in the list of objects to be updated
+		 since their boxes depend on the position of the children objects */
+		for(unsigned idx=0; idx < upd_objs.size(); idx++)
+		{
+			base_tab=dynamic_cast<BaseTable *>(upd_objs[idx]);
+			schema=(base_tab ? dynamic_cast<Schema *>(base_tab->getSchema()) : nullptr);
+
+			if(schema && !schema->signalsBlocked())
+			{
+				schema->blockSignals(true);
+				upd_objs.push_back(schema);
+			}
+		}
+
+		unblockObjectsSignals(upd_objs);
+		setObjectsModified(upd_objs);
+
+		emit s_objectLoaded(100, trUtf8("Metadata file successfully loaded! Objects updated: %1. Objects not found: %2.")
+												.arg(matched_count).arg(missed_count), enum_cast(ObjectType::BaseObject));
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
 
+		unblockObjectsSignals(upd_objs);
+
 		if(xmlparser.getCurrentElement())
 			extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
 
@@ -10772,6 +11285,101 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 	}
 }
 
+BaseObject *DatabaseModel::getObjectFromIndex(map<ObjectType, map<QString, BaseObject *>> &obj_index, const QString &name, ObjectType obj_type)
+{
+	QString aux_name=QString(name).remove('"');
+
+	if(aux_name.isEmpty())
+		return(nullptr);
+
+	//Building the index for the provided type in the first time it is requested
+	if(obj_index.count(obj_type)==0)
+	{
+		vector<BaseObject *> *obj_list=getObjectList(obj_type);
+		map<QString, BaseObject *> &type_idx=obj_index[obj_type];
+
+		if(!obj_list)
+			throw Exception(ErrorCode::ObtObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		//Reverse iteration so the first object in the list prevails in case of repeated signatures (same behavior of getObject)
+		for(auto itr=obj_list->rbegin(); itr!=obj_list->rend(); itr++)
+			type_idx[(*itr)->getSignature().remove('"')]=(*itr);
+	}
+
+	auto itr=obj_index[obj_type].find(aux_name);
+	return(itr!=obj_index[obj_type].end() ? itr->second : nullptr);
+}
+
+void DatabaseModel::unblockObjectsSignals(vector<BaseObject *> &objects)
+{
+	BaseGraphicObject *graph_obj=nullptr;
+
+	for(auto &obj : objects)
+	{
+		graph_obj=dynamic_cast<BaseGraphicObject *>(obj);
+
+		if(graph_obj)
+			graph_obj->blockSignals(false);
+	}
+}
+
+size_t DatabaseModel::getMemoryUsage(map<ObjectType, unsigned> &obj_count, map<ObjectType, vector<size_t>> &obj_usage)
+{
+	vector<BaseObject *> *obj_list=nullptr, tab_objs;
+	vector<ObjectType> types=getObjectTypes(false, { ObjectType::Database });
+	size_t total=0;
+
+	obj_count.clear();
+	obj_usage.clear();
+
+	auto account_obj=[&](BaseObject *obj) {
+		ObjectType obj_type=obj->getObjectType();
+		vector<size_t> &usage=obj_usage[obj_type];
+		size_t size=PgModelerNs::getObjectClassSize(obj_type);
+
+		if(usage.empty())
+			usage.resize(BaseObject::MemCategoryCount, 0);
+
+		obj_count[obj_type]++;
+		usage[BaseObject::MemObjectData]+=size;
+		total+=size;
+
+		for(unsigned mem_cat=0; mem_cat < BaseObject::MemCategoryCount; mem_cat++)
+		{
+			size=obj->getMemoryUsage(mem_cat);
+			usage[mem_cat]+=size;
+			total+=size;
+		}
+	};
+
+	account_obj(this);
+	obj_usage[ObjectType::Database][BaseObject::MemParserBuffers]+=xmlparser.getMemoryUsage();
+	total+=xmlparser.getMemoryUsage();
+
+	for(auto &type : types)
+	{
+		obj_list=getObjectList(type);
+
+		if(!obj_list)
+			continue;
+
+		for(auto &obj : *obj_list)
+		{
+			account_obj(obj);
+
+			if(BaseTable::isBaseTable(type))
+			{
+				tab_objs=dynamic_cast<BaseTable *>(obj)->getObjects();
+
+				for(auto &tab_obj : tab_objs)
+					account_obj(tab_obj);
+			}
+		}
+	}
+
+	return(total);
+}
+
 void DatabaseModel::setLayers(const QStringList &layers)
 {
 	this->layers = layers;
@@ -10913,6 +11521,8 @@ TableClass *DatabaseModel::createPhysicalTable(void)
 					//Retrieving initial data
 					else if(elem==Attributes::InitialData)
 					{
+						xmlparser.getElementAttributes(aux_attribs);
+						table->setInitialDataFormat(aux_attribs[Attributes::DataFormat].toUInt());
 						xmlparser.savePosition();
 						xmlparser.accessElement(XmlParser::ChildElement);
 						table->setInitialData(xmlparser.getElementContent());
@@ -28,6 +28,7 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #define DATABASE_MODEL_H
 
 #include <QFile>
+#include <QSaveFile>
 #include <QObject>
 #include <QStringList>
 #include "baseobject.h"
@@ -71,7 +72,7 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 * to return the list according to the provided type */
 		map<ObjectType, vector<BaseObject *> *> obj_lists;
 
-		static unsigned dbmodel_id;
+		static atomic<unsigned> dbmodel_id;
 
 		XmlParser xmlparser;
 
@@ -142,6 +143,16 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 when revalidating the relationships */
 		map<unsigned, QString> xml_special_objs;
 
+		/*! \brief Bidirectional index between the views and the objects (tables and columns) they reference.
+		 * It's updated by updateViewRelationships() so the views affected by changes in a table or column
+		 * are found without inspecting the references of all views in the model */
+		map<View *, vector<BaseObject *>> view_references;
+
+		map<BaseObject *, vector<View *>> referencing_views;
+
+		//! \brief Stores the base relationships connected to each view (maintained by __addObject() and __removeObject())
+		map<View *, vector<BaseRelationship *>> view_relationships;
+
 		//! \brief Indicates if the model is being loaded
 		bool loading_model,
 
@@ -196,6 +207,23 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Set the initial capacity of the objects list for a optimized memory usage
 		void setObjectListsCapacity(unsigned capacity);
 
+		/*! \brief Returns an object searching it by its name and type in the provided name index. The index for a type is
+		 * created (from the current objects list) the first time that type is requested. This method is used in place of
+		 * getObject(QString, ObjectType) when a large amount of objects need to be resolved by name, e.g., loading metadata */
+		BaseObject *getObjectFromIndex(map<ObjectType, map<QString, BaseObject *>> &obj_index, const QString &name, ObjectType obj_type);
+
+		//! \brief Restores the signals emission of the graphical objects in the list
+		void unblockObjectsSignals(vector<BaseObject *> &objects);
+
+		//! \brief Rebuilds the index entries of the objects referenced by the view. If unindex is true the view is only removed from the index
+		void indexViewReferences(View *view, bool unindex=false);
+
+		//! \brief Adds or removes (unindex=true) the relationship from the index of relationships connected to views
+		void indexViewRelationship(BaseRelationship *rel, bool unindex=false);
+
+		//! \brief Returns the views that reference the provided table or column using the view references index
+		vector<View *> getReferencingViews(BaseObject *object);
+
 	protected:
 		void setLayers(const QStringList &layers);
 		void setActiveLayers(const QList<unsigned> &layers);
@@ -350,6 +378,20 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Saves the specified code definition for the model on the specified filename
 		void saveModel(const QString &filename, unsigned def_type);
 
+		/*! \brief Takes a snapshot of the XML code of the whole model. The objects definitions (mostly reused from their code cache)
+		 * are stored in obj_defs as implicitly shared strings grouped by the dbmodel schema attribute they fill, while the remaining
+		 * attributes are stored in attribs. The snapshot doesn't reference the model so the final code can be assembled in another
+		 * thread (see getXMLDefinition() and saveSnapshot()) even if the model is modified in the meantime. This is also the
+		 * base of the XML returned by getCodeDefinition() which uses emit_progress to notify the generation of each object */
+		void getXMLSnapshot(attribs_map &attribs, map<QString, QStringList> &obj_defs, bool emit_progress=false);
+
+		//! \brief Assembles the XML code of a model from a snapshot taken by getXMLSnapshot()
+		static QString getXMLDefinition(attribs_map attribs, const map<QString, QStringList> &obj_defs);
+
+		/*! \brief Saves the XML code of a model snapshot to the file. The code is written in a temporary file that atomically
+		 * replaces the destination file only after being completely written, so a failure never leaves a truncated model behind */
+		static void saveSnapshot(const QString &filename, const attribs_map &attribs, const map<QString, QStringList> &obj_defs);
+
 		/*! \brief Returns the complete SQL/XML defintion for the entire model (including all the other objects).
 		 The parameter 'export_file' is used to format the generated code in a way that can be saved
 		 in na SQL file and executed later on the DBMS server. This parameter is only used for SQL definition. */
@@ -607,6 +649,10 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Validates the relationship to reflect the modifications on the column/constraint of the passed table
 		void validateRelationships(TableObject *object, Table *parent_tab);
 
+		/*! \brief Returns true when the modification (or removal) of the passed column/constraint of the provided table
+		 * requires the revalidation of all relationships. This is the test used by validateRelationships(TableObject *, Table *) */
+		bool isRelationshipsRevalidationNeeded(TableObject *object, Table *parent_tab);
+
 		/*! \brief Checks if from the passed relationship some redundacy is found. Redundancy generates infinite column
 		 propagation over the tables. This method raises an error when found some. */
 		void checkRelationshipRedundancy(Relationship *rel);
@@ -622,6 +668,19 @@ class DatabaseModel:  public QObject, public BaseObject {
 		getCreationOrder(BaseObject *object) */
 		void __getObjectDependencies(BaseObject *object, vector<BaseObject *> &objs);
 
+		/*! \brief Returns if the provided objects can be copied via cloneObjects(). This is possible only when all the objects belong
+		 * to the model, are schemas, tables, sequences or textboxes (or children of the provided tables) and no column uses as data type
+		 * one of the provided tables/sequences. Tables having objects added by relationships can only be cloned when incl_rel_added_objs is true */
+		bool canCloneObjects(const vector<BaseObject *> &objects, bool incl_rel_added_objs);
+
+		/*! \brief Creates structural copies (clones) of the provided objects without generating and parsing their XML code.
+		 * Tables are cloned together with their children and the references between the provided objects (schemas, columns,
+		 * referenced tables, sequences and owner columns) are remapped to the clones. The clones are not added to the model: the
+		 * clones vector receives first the schemas, tables, sequences and textboxes (in the order they must be added to the model)
+		 * and then the foreign keys of the cloned tables which must be added to their parent tables only after all the cloned
+		 * tables are in the model. The objects must be validated by canCloneObjects() first */
+		void cloneObjects(const vector<BaseObject *> &objects, vector<BaseObject *> &clones, bool incl_rel_added_objs);
+
 		/*! \brief Returns all the objects that references the passed object. The boolean exclusion_mode is used to performance purpose,
 		 generally applied when excluding objects, this means that the method will stop the search when the first
 		 reference is found. The exclude_perms parameter when true will not include permissions in the references list. */
@@ -631,6 +690,11 @@ class DatabaseModel:  public QObject, public BaseObject {
 		meaning that ALL objects directly or inderectly linked to the 'object' are retrieved. */
 		void __getObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclude_perms=false);
 
+		/*! \brief Retrieves in a single traversal all the objects directly or indirectly linked to any of the provided objects.
+		 * Each object is visited only once no matter how many paths lead to it, so this method is preferable over
+		 * calling __getObjectReferences() for each object when computing the impact of a bulk operation */
+		void __getObjectReferences(const vector<BaseObject *> &objects, vector<BaseObject *> &refs, bool exclude_perms=false);
+
 		/*! \brief Marks the graphical objects of the provided types as modified forcing their redraw. User can specify only a set of
 	 graphical objects to be marked */
 		void setObjectsModified(vector<ObjectType> types={});
@@ -683,7 +747,14 @@ class DatabaseModel:  public QObject, public BaseObject {
 				that can be loaded by another model in order to change their objects position */
 		void saveObjectsMetadata(const QString &filename, unsigned options=MetaAllInfo);
 
-		//! \brief Load the file containing the objects positioning to be applied to the model
+		/*! \brief Estimates the memory footprint of the model objects (including table children objects). The map obj_count receives the amount
+		 * of objects per type while obj_usage receives, per type, a vector where each element is the estimated amount of bytes of a memory
+		 * category (see BaseObject::MemObjectData, MemCachedCode and MemParserBuffers). The returned value is the total of bytes of all types.
+		 * The memory held by the model's XML parser is accounted as parser buffers of the database object type. */
+		size_t getMemoryUsage(map<ObjectType, unsigned> &obj_count, map<ObjectType, vector<size_t>> &obj_usage);
+
+		/*! \brief Load the file containing the objects positioning to be applied to the model. The objects are resolved through
+		 * a name index and their graphical representations are updated in a single batch at the end of the process */
 		void loadObjectsMetadata(const QString &filename, unsigned options=MetaAllInfo);
 
 	signals:
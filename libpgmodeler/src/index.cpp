@@ -325,6 +325,17 @@ bool Index::isReferColumn(Column *column)
 	return(found);
 }
 
+void Index::remapColumns(const map<Column *, Column *> &col_map)
+{
+	for(auto &elem : idx_elements)
+	{
+		if(elem.getColumn() && col_map.count(elem.getColumn()))
+			elem.setColumn(col_map.at(elem.getColumn()));
+	}
+
+	setCodeInvalidated(true);
+}
+
 QString Index::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
@@ -141,6 +141,10 @@ class Index: public TableObject{
 
 		//! \brief Returns if some index element is referencing the specified column
 		bool isReferColumn(Column *column);
+
+		/*! \brief Replaces the referenced columns by the ones associated to them in the provided map.
+		 * This is used to make a cloned object reference the columns of the cloned table (see DatabaseModel::cloneObjects()) */
+		void remapColumns(const map<Column *, Column *> &col_map);
 };
 
 #endif
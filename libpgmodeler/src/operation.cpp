@@ -131,3 +131,11 @@ bool Operation::isOperationValid(void)
 {
 	return(operation_id==generateOperationId());
 }
+
+size_t Operation::getMemoryUsage(void)
+{
+	return(sizeof(Operation) +
+				 MemoryUsage::getStringSize(operation_id) +
+				 MemoryUsage::getStringSize(xml_definition) +
+				 (permissions.capacity() * sizeof(Permission *)));
+}
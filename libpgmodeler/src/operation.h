@@ -107,6 +107,9 @@ class Operation {
 		vector<Permission *> getPermissions(void);
 		QString getXMLDefinition(void);
 		bool isOperationValid(void);
+
+		//! \brief Returns an estimation of the memory (in bytes) held by the operation excluding the pool object
+		size_t getMemoryUsage(void);
 };
 
 #endif
@@ -45,6 +45,28 @@ unsigned OperationList::getCurrentSize(void)
 	return(operations.size());
 }
 
+size_t OperationList::getMemoryUsage(void)
+{
+	size_t size=0;
+	vector<BaseObject *> objs;
+
+	for(auto &oper : operations)
+		size+=oper->getMemoryUsage();
+
+	objs=object_pool;
+	objs.insert(objs.end(), not_removed_objs.begin(), not_removed_objs.end());
+
+	for(auto &obj : objs)
+	{
+		size+=PgModelerNs::getObjectClassSize(obj->getObjectType());
+
+		for(unsigned mem_cat=0; mem_cat < BaseObject::MemCategoryCount; mem_cat++)
+			size+=obj->getMemoryUsage(mem_cat);
+	}
+
+	return(size);
+}
+
 unsigned OperationList::getMaximumSize(void)
 {
 	return(max_size);
@@ -159,6 +159,10 @@ class OperationList: public QObject {
 		//! \brief Gets the current operation index
 		int getCurrentIndex(void);
 
+		/*! \brief Returns an estimation of the memory (in bytes) held by the undo/redo history. This includes the
+		 * operations themselves (with their XML snapshots) and the copies of the objects stored in the pool */
+		size_t getMemoryUsage(void);
+
 		//! \brief Returns if the list is prepared to execute redo operations
 		bool isRedoAvailable(void);
 
@@ -167,9 +167,36 @@ namespace PgModelerNs {
 		}
 	}
 
+	size_t getObjectClassSize(ObjectType obj_type)
+	{
+		static map<ObjectType, size_t> sizes={
+			{ ObjectType::Column, sizeof(Column) }, { ObjectType::Constraint, sizeof(Constraint) },
+			{ ObjectType::Function, sizeof(Function) }, { ObjectType::Trigger, sizeof(Trigger) },
+			{ ObjectType::Index, sizeof(Index) }, { ObjectType::Rule, sizeof(Rule) },
+			{ ObjectType::Table, sizeof(Table) }, { ObjectType::View, sizeof(View) },
+			{ ObjectType::Domain, sizeof(Domain) }, { ObjectType::Schema, sizeof(Schema) },
+			{ ObjectType::Aggregate, sizeof(Aggregate) }, { ObjectType::Operator, sizeof(Operator) },
+			{ ObjectType::Sequence, sizeof(Sequence) }, { ObjectType::Role, sizeof(Role) },
+			{ ObjectType::Conversion, sizeof(Conversion) }, { ObjectType::Cast, sizeof(Cast) },
+			{ ObjectType::Language, sizeof(Language) }, { ObjectType::Type, sizeof(Type) },
+			{ ObjectType::Tablespace, sizeof(Tablespace) }, { ObjectType::OpFamily, sizeof(OperatorFamily) },
+			{ ObjectType::OpClass, sizeof(OperatorClass) }, { ObjectType::Database, sizeof(DatabaseModel) },
+			{ ObjectType::Collation, sizeof(Collation) }, { ObjectType::Extension, sizeof(Extension) },
+			{ ObjectType::EventTrigger, sizeof(EventTrigger) }, { ObjectType::Policy, sizeof(Policy) },
+			{ ObjectType::ForeignDataWrapper, sizeof(ForeignDataWrapper) }, { ObjectType::ForeignServer, sizeof(ForeignServer) },
+			{ ObjectType::ForeignTable, sizeof(ForeignTable) }, { ObjectType::UserMapping, sizeof(UserMapping) },
+			{ ObjectType::Relationship, sizeof(Relationship) }, { ObjectType::Textbox, sizeof(Textbox) },
+			{ ObjectType::Permission, sizeof(Permission) }, { ObjectType::Parameter, sizeof(Parameter) },
+			{ ObjectType::TypeAttribute, sizeof(TypeAttribute) }, { ObjectType::Tag, sizeof(Tag) },
+			{ ObjectType::GenericSql, sizeof(GenericSQL) }, { ObjectType::BaseRelationship, sizeof(BaseRelationship) }
+		};
+
+		return(sizes.count(obj_type) ? sizes.at(obj_type) : 0);
+	}
+
 	bool isReservedKeyword(const QString &word)
 	{
-		static QHash<QChar, QStringList> keywords={
+		static const QHash<QChar, QStringList> keywords={
 			{QChar('A'), {QString("ALL"), QString("ANALYSE"), QString("ANALYZE"), QString("AND"),
 										QString("ANY"), QString("AS"),      QString("ASC"),     QString("AUTHORIZATION")}},
 
@@ -45,6 +45,10 @@ namespace PgModelerNs {
 		 the template function above. */
 	extern void copyObject(BaseObject **psrc_obj, BaseObject *copy_obj, ObjectType obj_type);
 
+	/*! \brief Returns the size (in bytes) of the class that implements the provided object type.
+		 This is used as the fixed portion of the objects' memory footprint estimations */
+	extern size_t getObjectClassSize(ObjectType obj_type);
+
 	//! \brief Returns true if the specified word is a PostgreSQL reserved word.
 	extern bool isReservedKeyword(const QString &word);
 
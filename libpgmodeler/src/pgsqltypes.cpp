@@ -741,6 +741,7 @@ QString SpatialType::operator * (void)
  * CLASS: PgSQLType *
  ********************/
 vector<UserTypeConfig> PgSqlType::user_types;
+QMutex PgSqlType::user_types_mutex(QMutex::Recursive);
 
 PgSqlType::PgSqlType(void)
 {
@@ -870,27 +871,27 @@ PgSqlType PgSqlType::parseString(const QString &str)
 
 	try
 	{
-		try
+		/* If the type is not registered (specially with PostGiS types) split the string to remove
+		the schema name and try to create the type once more. The registration is checked in advance
+		instead of handling the error raised by the type creation since this is done for every column
+		during reverse engineering */
+		if(!isRegistered(type_str))
 		{
-			//Creates the type based on the extracted values
-			type=PgSqlType(type_str);
-		}
-		catch(Exception &)
-		{
-			/* In case of error (specially with PostGiS types) split the string to remove
-				the schema name and try to create the type once more */
 			QStringList typname=type_str.split('.');
 
 			if(typname.size()==2)
-				type=PgSqlType(typname[1]);
+				type_str=typname[1];
 			else
 			{
 				/* One last try it to check if the type has an entry on user defined types
 		   as pg_catalog.[type name] */
-				type=PgSqlType(QString("pg_catalog.") + type_str);
+				type_str.prepend(QString("pg_catalog."));
 			}
 		}
 
+		//Creates the type based on the extracted values
+		type=PgSqlType(type_str);
+
 		type.setWithTimezone(with_tz);
 		type.setDimension(dim);
 
@@ -968,6 +969,8 @@ unsigned PgSqlType::operator = (const QString &type_name)
 
 void *PgSqlType::getUserTypeReference(void)
 {
+	QMutexLocker locker(&user_types_mutex);
+
 	if(this->isUserType())
 		return(user_types[this->type_idx - (PseudoEnd + 1)].ptype);
 	else
@@ -976,6 +979,8 @@ void *PgSqlType::getUserTypeReference(void)
 
 unsigned PgSqlType::getUserTypeConfig(void)
 {
+	QMutexLocker locker(&user_types_mutex);
+
 	if(this->isUserType())
 		return(user_types[this->type_idx - (PseudoEnd + 1)].type_conf);
 	else
@@ -1112,6 +1117,7 @@ void PgSqlType::setWithTimezone(bool with_tz)
 
 void PgSqlType::setUserType(unsigned type_id)
 {
+	QMutexLocker locker(&user_types_mutex);
 	unsigned lim1, lim2;
 
 	lim1=PseudoEnd + 1;
@@ -1137,6 +1143,8 @@ void PgSqlType::setUserType(void *ptype)
 
 void PgSqlType::addUserType(const QString &type_name, void *ptype, void *pmodel, unsigned type_conf)
 {
+	QMutexLocker locker(&user_types_mutex);
+
 	if(!type_name.isEmpty() && ptype && pmodel &&
 			(type_conf==UserTypeConfig::DomainType ||
 			 type_conf==UserTypeConfig::SequenceType ||
@@ -1159,6 +1167,8 @@ void PgSqlType::addUserType(const QString &type_name, void *ptype, void *pmodel,
 
 void PgSqlType::removeUserType(const QString &type_name, void *ptype)
 {
+	QMutexLocker locker(&user_types_mutex);
+
 	if(PgSqlType::user_types.size() > 0 &&
 			!type_name.isEmpty() && ptype)
 	{
@@ -1184,6 +1194,8 @@ void PgSqlType::removeUserType(const QString &type_name, void *ptype)
 
 void PgSqlType::renameUserType(const QString &type_name, void *ptype,const QString &new_name)
 {
+	QMutexLocker locker(&user_types_mutex);
+
 	if(PgSqlType::user_types.size() > 0 &&
 			!type_name.isEmpty() && ptype && type_name!=new_name)
 	{
@@ -1206,6 +1218,8 @@ void PgSqlType::renameUserType(const QString &type_name, void *ptype,const QStri
 
 void PgSqlType::removeUserTypes(void *pmodel)
 {
+	QMutexLocker locker(&user_types_mutex);
+
 	if(pmodel)
 	{
 		vector<UserTypeConfig>::iterator itr;
@@ -1240,6 +1254,8 @@ unsigned PgSqlType::getBaseTypeIndex(const QString &type_name)
 
 unsigned PgSqlType::getUserTypeIndex(const QString &type_name, void *ptype, void *pmodel)
 {
+	QMutexLocker locker(&user_types_mutex);
+
 	if(PgSqlType::user_types.size() > 0 && (!type_name.isEmpty() || ptype))
 	{
 		vector<UserTypeConfig>::iterator itr, itr_end;
@@ -1269,6 +1285,7 @@ unsigned PgSqlType::getUserTypeIndex(const QString &type_name, void *ptype, void
 
 QString PgSqlType::getUserTypeName(unsigned type_id)
 {
+	QMutexLocker locker(&user_types_mutex);
 	unsigned lim1, lim2;
 
 	lim1=PseudoEnd + 1;
@@ -1284,6 +1301,7 @@ QString PgSqlType::getUserTypeName(unsigned type_id)
 
 void PgSqlType::getUserTypes(QStringList &type_list, void *pmodel, unsigned inc_usr_types)
 {
+	QMutexLocker locker(&user_types_mutex);
 	unsigned idx,total;
 
 	type_list.clear();
@@ -1300,6 +1318,7 @@ void PgSqlType::getUserTypes(QStringList &type_list, void *pmodel, unsigned inc_
 
 void PgSqlType::getUserTypes(vector<void *> &ptypes, void *pmodel, unsigned inc_usr_types)
 {
+	QMutexLocker locker(&user_types_mutex);
 	unsigned idx, total;
 
 	ptypes.clear();
@@ -1317,7 +1336,10 @@ void PgSqlType::getUserTypes(vector<void *> &ptypes, void *pmodel, unsigned inc_
 QString PgSqlType::operator ~ (void)
 {
 	if(type_idx >= PseudoEnd + 1)
+	{
+		QMutexLocker locker(&user_types_mutex);
 		return(user_types[type_idx - (PseudoEnd + 1)].name);
+	}
 	else
 	{
 		QString name=BaseType::type_list[type_idx];
@@ -1545,6 +1567,7 @@ void PgSqlType::setDimension(unsigned dim)
 {
 	if(dim > 0 && this->isUserType())
 	{
+		QMutexLocker locker(&user_types_mutex);
 		int idx=getUserTypeIndex(~(*this), nullptr) - (PseudoEnd + 1);
 		if(static_cast<unsigned>(idx) < user_types.size() &&
 				user_types[idx].type_conf==UserTypeConfig::SequenceType)
@@ -30,6 +30,7 @@
 #include "schemaparser.h"
 #include <vector>
 #include <QRegExp>
+#include <QMutex>
 
 class BaseType{
 	protected:
@@ -333,6 +334,10 @@ class PgSqlType: public BaseType{
 		//! \brief Configuration for user defined types
 		static vector<UserTypeConfig> user_types;
 
+		/*! \brief Serializes the access to the user defined types list since models can be
+		 * loaded (thus registering their types) concurrently by different threads */
+		static QMutex user_types_mutex;
+
 		//! \brief Dimension of the type if it's configured as array
 		unsigned dimension,
 
@@ -35,6 +35,7 @@ PhysicalTable::PhysicalTable(void) : BaseTable()
 	attributes[Attributes::ColIndexes]=QString();
 	attributes[Attributes::ConstrIndexes]=QString();
 	attributes[Attributes::InitialData]=QString();
+	attributes[Attributes::DataFormat]=QString();
 	attributes[Attributes::Partitioning]=QString();
 	attributes[Attributes::PartitionKey]=QString();
 	attributes[Attributes::PartitionedTable]=QString();
@@ -43,6 +44,9 @@ PhysicalTable::PhysicalTable(void) : BaseTable()
 
 	copy_table=partitioned_table=nullptr;
 	partitioning_type=BaseType::Null;
+	data_row_count=0;
+	raw_data_valid=col_data_valid=true;
+	data_format=InsertDataFormat;
 }
 
 void PhysicalTable::destroyObjects(void)
@@ -1384,7 +1388,8 @@ void PhysicalTable::setTableAttributes(unsigned def_type, bool incl_rel_added_ob
 		setRelObjectsIndexesAttribute();
 		setPositionAttribute();
 		setFadedOutAttribute();
-		attributes[Attributes::InitialData]=initial_data;
+		attributes[Attributes::InitialData]=getInitialData();
+		attributes[Attributes::DataFormat]=(data_format!=InsertDataFormat ? QString::number(data_format) : QString());
 		attributes[Attributes::MaxObjCount]=QString::number(static_cast<unsigned>(getMaxObjectCount() * 1.20));
 	}
 	else
@@ -1402,6 +1407,12 @@ void PhysicalTable::operator = (PhysicalTable &table)
 	this->constr_indexes=table.constr_indexes;
 	this->partitioning_type=table.partitioning_type;
 	this->initial_data=table.initial_data;
+	this->data_columns=table.data_columns;
+	this->data_values=table.data_values;
+	this->data_row_count=table.data_row_count;
+	this->raw_data_valid=table.raw_data_valid;
+	this->col_data_valid=table.col_data_valid;
+	this->data_format=table.data_format;
 	this->partition_keys=table.partition_keys;
 
 	PgSqlType::renameUserType(prev_name, this, this->getName(true));
@@ -1584,115 +1595,306 @@ void PhysicalTable::setCodeInvalidated(bool value)
 
 void PhysicalTable::setInitialData(const QString &value)
 {
-	setCodeInvalidated(initial_data != value);
+	setCodeInvalidated(getInitialData() != value);
 	initial_data = value;
+	raw_data_valid = true;
+
+	//The columnar data is filled again only when needed
+	col_data_valid = false;
+	data_columns.clear();
+	data_values.clear();
+	data_row_count = 0;
+}
+
+void PhysicalTable::setInitialData(const QStringList &col_names, const vector<QStringList> &values)
+{
+	setCodeInvalidated(true);
+
+	data_columns = col_names;
+	data_values = values;
+	data_values.resize(data_columns.size());
+	data_row_count = 0;
+
+	for(auto &col_vals : data_values)
+		data_row_count = std::max(data_row_count, col_vals.size());
+
+	for(auto &col_vals : data_values)
+	{
+		while(col_vals.size() < data_row_count)
+			col_vals.append(QString());
+	}
+
+	//The raw buffer is generated only when needed
+	col_data_valid = true;
+	raw_data_valid = false;
+	initial_data.clear();
 }
 
 QString PhysicalTable::getInitialData(void)
 {
+	if(!raw_data_valid)
+	{
+		QStringList buffer, row_vals;
+
+		if(!data_columns.isEmpty() && data_row_count > 0)
+		{
+			//The first line of the buffer consists in the column names
+			buffer.append(data_columns.join(DataSeparator));
+
+			for(int row = 0; row < data_row_count; row++)
+			{
+				row_vals.clear();
+
+				for(auto &col_vals : data_values)
+					row_vals.append(col_vals.at(row));
+
+				buffer.append(row_vals.join(DataSeparator));
+			}
+		}
+
+		initial_data = buffer.join(DataLineBreak);
+		raw_data_valid = true;
+	}
+
 	return(initial_data);
 }
 
-QString PhysicalTable::getInitialDataCommands(void)
+int PhysicalTable::splitInitialData(const QString &buffer, QStringList &col_names, vector<QStringList> &values)
 {
-	QStringList buffer=initial_data.split(DataLineBreak);
+	QVector<QStringRef> lines = buffer.splitRef(DataLineBreak);
+	QVector<QStringRef> row_vals;
+	int col_count = 0, row_count = 0;
+
+	col_names.clear();
+	values.clear();
+
+	if(lines.isEmpty() || lines.at(0).isEmpty())
+		return(0);
+
+	//The first line of the buffer always has the column names
+	for(auto &name : lines.at(0).split(DataSeparator))
+		col_names.append(name.toString());
+
+	col_count = col_names.size();
+	row_count = lines.size() - 1;
+	values.resize(col_count);
+
+	for(auto &col_vals : values)
+		col_vals.reserve(row_count);
 
-	if(!buffer.isEmpty() && !buffer.at(0).isEmpty())
+	for(int ln = 1; ln < lines.size(); ln++)
 	{
-		QStringList	col_names, col_values, commands, selected_cols;
-		int curr_col=0;
-		QList<int> ignored_cols;
+		row_vals = lines.at(ln).split(DataSeparator);
 
-		col_names=(buffer.at(0)).split(DataSeparator);
-		col_names.removeDuplicates();
-		buffer.removeFirst();
+		for(int col = 0; col < col_count; col++)
+			values[col].append(col < row_vals.size() ? row_vals.at(col).toString() : QString());
+	}
 
-		//Separating valid columns (selected) from the invalids (ignored)
-		for(QString col_name : col_names)
-		{
-			if(getObjectIndex(col_name, ObjectType::Column) >= 0)
-				selected_cols.append(col_name);
-			else
-				ignored_cols.append(curr_col);
+	return(row_count);
+}
 
-			curr_col++;
-		}
+void PhysicalTable::parseInitialData(void)
+{
+	if(col_data_valid)
+		return;
 
-		for(QString buf_row : buffer)
-		{
-			curr_col=0;
+	data_row_count = splitInitialData(initial_data, data_columns, data_values);
+	col_data_valid = true;
+}
 
-			//Filtering the invalid columns' values
-			for(QString value : buf_row.split(DataSeparator))
-			{
-				if(ignored_cols.contains(curr_col))
-					continue;
+QStringList PhysicalTable::getInitialDataColumns(void)
+{
+	parseInitialData();
+	return(data_columns);
+}
 
-				col_values.append(value);
-			}
+vector<QStringList> PhysicalTable::getInitialDataValues(void)
+{
+	parseInitialData();
+	return(data_values);
+}
 
-			commands.append(createInsertCommand(selected_cols, col_values));
-			col_values.clear();
-		}
+int PhysicalTable::getInitialDataRowCount(void)
+{
+	parseInitialData();
+	return(data_row_count);
+}
 
-		return(commands.join('\n'));
-	}
+void PhysicalTable::setInitialDataFormat(unsigned format)
+{
+	if(format > CopyDataFormat)
+		format = InsertDataFormat;
 
-	return(QString());
+	setCodeInvalidated(data_format != format);
+	data_format = format;
 }
 
-QString PhysicalTable::createInsertCommand(const QStringList &col_names, const QStringList &values)
+unsigned PhysicalTable::getInitialDataFormat(void)
 {
-	QString fmt_cmd, insert_cmd = QString("INSERT INTO %1 (%2) VALUES (%3);\n%4");
-	QStringList val_list, col_list;
-	int curr_col=0;
+	return(data_format);
+}
 
-	for(QString col_name : col_names)
-		col_list.push_back(BaseObject::formatName(col_name));
+QString PhysicalTable::getInitialDataCommands(void)
+{
+	QStringList selected_cols, commands;
+	QList<int> col_idxs, insert_rows, copy_rows;
+	bool copyable = false;
 
-	for(QString value : values)
+	parseInitialData();
+
+	if(data_columns.isEmpty() || data_row_count == 0)
+		return(QString());
+
+	/* Separating valid columns (selected) from the invalids (ignored).
+	 * Only the first occurrence of a duplicated column is considered */
+	for(int col = 0; col < data_columns.size(); col++)
 	{
-		//Empty values as considered as DEFAULT
-		if(value.isEmpty())
-		{
-			value=QString("DEFAULT");
-		}
-		//Unescaped values will not be enclosed in quotes
-		else if(value.startsWith(PgModelerNs::UnescValueStart) && value.endsWith(PgModelerNs::UnescValueEnd))
+		if(!selected_cols.contains(data_columns[col]) &&
+			 getObjectIndex(data_columns[col], ObjectType::Column) >= 0)
 		{
-			value.remove(0,1);
-			value.remove(value.length()-1, 1);
+			selected_cols.append(data_columns[col]);
+			col_idxs.append(col);
 		}
-		//Quoting value
+	}
+
+	if(selected_cols.isEmpty())
+		return(QString());
+
+	/* When using COPY the rows containing values that can't be represented in
+	 * COPY text format (DEFAULT and expressions) are still generated as INSERT commands */
+	for(int row = 0; row < data_row_count; row++)
+	{
+		copyable = (data_format == CopyDataFormat);
+
+		for(int i = 0; i < col_idxs.size() && copyable; i++)
+			copyable = isCopyableValue(data_values[col_idxs[i]].at(row));
+
+		if(copyable)
+			copy_rows.append(row);
 		else
-		{
-			value.replace(QString("\\") + PgModelerNs::UnescValueStart, PgModelerNs::UnescValueStart);
-			value.replace(QString("\\") + PgModelerNs::UnescValueEnd, PgModelerNs::UnescValueEnd);
-			value.replace(QString("\'"), QString("''"));
-			value.replace(QChar(QChar::LineFeed), QString("\\n"));
-			value=QString("E'") + value + QString("'");
-		}
+			insert_rows.append(row);
+	}
+
+	if(!copy_rows.isEmpty())
+		commands.append(createCopyCommand(selected_cols, col_idxs, copy_rows));
+
+	if(!insert_rows.isEmpty())
+		commands.append(createInsertCommands(selected_cols, col_idxs, insert_rows));
+
+	return(commands.join('\n'));
+}
+
+QString PhysicalTable::formatInsertValue(QString value)
+{
+	//Empty values as considered as DEFAULT
+	if(value.isEmpty())
+	{
+		value=QString("DEFAULT");
+	}
+	//Unescaped values will not be enclosed in quotes
+	else if(value.startsWith(PgModelerNs::UnescValueStart) && value.endsWith(PgModelerNs::UnescValueEnd))
+	{
+		value.remove(0,1);
+		value.remove(value.length()-1, 1);
+	}
+	//Quoting value
+	else
+	{
+		value.replace(QString("\\") + PgModelerNs::UnescValueStart, PgModelerNs::UnescValueStart);
+		value.replace(QString("\\") + PgModelerNs::UnescValueEnd, PgModelerNs::UnescValueEnd);
+		value.replace(QString("\'"), QString("''"));
+		value.replace(QChar(QChar::LineFeed), QString("\\n"));
+		value=QString("E'") + value + QString("'");
+	}
+
+	return(value);
+}
+
+bool PhysicalTable::isCopyableValue(const QString &value)
+{
+	if(value.isEmpty() || value == QString("\\N") ||
+		 (value.startsWith(PgModelerNs::UnescValueStart) && value.endsWith(PgModelerNs::UnescValueEnd)))
+		return(false);
+
+	for(int i = 0; i < value.size() - 1; i++)
+	{
+		if(value.at(i) != QChar('\\'))
+			continue;
+
+		//The character after the backslash is skipped so escaped backslashes (\\) aren't checked twice
+		i++;
 
-		val_list.push_back(value);
+		if(value.at(i) == QChar('v') || value.at(i) == QChar('u') || value.at(i) == QChar('U'))
+			return(false);
 	}
 
-	if(!col_list.isEmpty() && !val_list.isEmpty())
+	return(true);
+}
+
+QString PhysicalTable::formatCopyValue(QString value)
+{
+	/* Backslash sequences are kept as is since they have the same meaning in COPY text format
+	 * as in the escape string constants (E'') used by the INSERT commands. The values containing
+	 * the sequences that differ are rejected by isCopyableValue() and generated as INSERT commands */
+	value.replace(QString("\\") + PgModelerNs::UnescValueStart, PgModelerNs::UnescValueStart);
+	value.replace(QString("\\") + PgModelerNs::UnescValueEnd, PgModelerNs::UnescValueEnd);
+	value.replace(QChar(QChar::LineFeed), QString("\\n"));
+	value.replace(QChar(QChar::CarriageReturn), QString("\\r"));
+	value.replace(QChar(QChar::Tabulation), QString("\\t"));
+
+	return(value);
+}
+
+QString PhysicalTable::createInsertCommands(const QStringList &col_names, const QList<int> &col_idxs, const QList<int> &rows)
+{
+	QString insert_cmd = QString("INSERT INTO %1 (%2) VALUES\n%3;\n%4"), signature = getSignature(), cols;
+	QStringList val_list, col_list, tuples, commands;
+
+	for(QString col_name : col_names)
+		col_list.push_back(BaseObject::formatName(col_name));
+
+	cols = col_list.join(", ");
+
+	for(int i = 0; i < rows.size(); i++)
 	{
-		//If the set of values is greater than the set of columns it will be truncated
-		if(val_list.size() > col_list.size())
-			val_list.erase(val_list.begin() + col_list.size(), val_list.end());
-		//If the set of columns is greater than the set of values than DEFAULT values will be provided
-		else if(col_list.size() > val_list.size())
+		val_list.clear();
+
+		for(auto &col_idx : col_idxs)
+			val_list.append(formatInsertValue(data_values[col_idx].at(rows[i])));
+
+		tuples.append(QString("(%1)").arg(val_list.join(", ")));
+
+		//Each command inserts at most InsertBatchSize rows
+		if(tuples.size() == InsertBatchSize || i == rows.size() - 1)
 		{
-			for(curr_col = val_list.size(); curr_col < col_list.size(); curr_col++)
-				val_list.append(QString("DEFAULT"));
+			commands.append(insert_cmd.arg(signature, cols, tuples.join(",\n"), Attributes::DdlEndToken));
+			tuples.clear();
 		}
+	}
+
+	return(commands.join('\n'));
+}
+
+QString PhysicalTable::createCopyCommand(const QStringList &col_names, const QList<int> &col_idxs, const QList<int> &rows)
+{
+	QString copy_cmd = QString("COPY %1 (%2) FROM stdin;\n%3\\.\n%4"), data;
+	QStringList val_list, col_list;
+
+	for(QString col_name : col_names)
+		col_list.push_back(BaseObject::formatName(col_name));
+
+	for(auto &row : rows)
+	{
+		val_list.clear();
+
+		for(auto &col_idx : col_idxs)
+			val_list.append(formatCopyValue(data_values[col_idx].at(row)));
 
-		fmt_cmd=insert_cmd.arg(getSignature()).arg(col_list.join(", "))
-									.arg(val_list.join(", ")).arg(Attributes::DdlEndToken);
+		data += val_list.join(QChar('\t'));
+		data += QChar('\n');
 	}
 
-	return(fmt_cmd);
+	return(copy_cmd.arg(getSignature(), col_list.join(", "), data, Attributes::DdlEndToken));
 }
 
 void PhysicalTable::setObjectListsCapacity(unsigned capacity)
@@ -43,10 +43,27 @@ class PhysicalTable: public BaseTable {
 		//! \brief Specifies the copy table options
 		CopyOptions copy_op;
 
-		/*! \brief Stores the initial data of the table in CSV like form.
-		This will produce a set of INSERT commands that is appended to the table's SQL definition */
+		/*! \brief Stores the initial data of the table in CSV like form (the raw buffer). This buffer is
+		 * only serialized from the columnar data (see data_values) when requested (see getInitialData()) */
 		QString initial_data;
 
+		//! \brief Names of the columns in the initial data (the first line of the raw buffer)
+		QStringList data_columns;
+
+		/*! \brief Initial data values stored per column, data_values[col][row]. This structure is filled
+		 * from the raw buffer only when the values are needed (see parseInitialData()) */
+		vector<QStringList> data_values;
+
+		//! \brief Amount of rows in the initial data
+		int data_row_count;
+
+		/*! \brief Indicates which representation of the initial data is up to date. When both are true
+		 * the raw buffer and the columnar data are equivalent */
+		bool raw_data_valid, col_data_valid;
+
+		//! \brief Indicates how the initial data is translated to SQL (see InsertDataFormat and CopyDataFormat)
+		unsigned data_format;
+
 		//! \brief The partition bounding expression
 		QString part_bounding_expr;
 
@@ -116,8 +133,28 @@ class PhysicalTable: public BaseTable {
 		void saveRelObjectsIndexes(ObjectType obj_type);
 		void restoreRelObjectsIndexes(ObjectType obj_type);
 
-		//! \brief Create an insert command from a list of columns and the values.
-		QString createInsertCommand(const QStringList &col_names, const QStringList &values);
+		//! \brief Fills the columnar data from the raw initial data buffer. Nothing is done if the columnar data is up to date
+		void parseInitialData(void);
+
+		/*! \brief Creates INSERT commands from a list of columns and the values of the provided rows. Each command
+		 * inserts at most InsertBatchSize rows. The col_idxs list contains the indexes (in data_values) of the columns used */
+		QString createInsertCommands(const QStringList &col_names, const QList<int> &col_idxs, const QList<int> &rows);
+
+		/*! \brief Creates a COPY ... FROM stdin command followed by the values of the provided rows in COPY text format.
+		 * The col_idxs list contains the indexes (in data_values) of the columns used */
+		QString createCopyCommand(const QStringList &col_names, const QList<int> &col_idxs, const QList<int> &rows);
+
+		//! \brief Formats the raw value to be used in an INSERT command
+		static QString formatInsertValue(QString value);
+
+		//! \brief Formats the raw value to be used in the data section of a COPY command
+		static QString formatCopyValue(QString value);
+
+		/*! \brief Returns true when the raw value can be written in COPY text format.
+		 * Empty values (DEFAULT) and unescaped values (expressions) can only be used in INSERT commands. The same happens
+		 * to values with backslash sequences that have a different meaning in COPY text format and in escape string
+		 * constants, e.g. \N (NULL in COPY but the letter N in E''), \v, \u and \U */
+		static bool isCopyableValue(const QString &value);
 
 		//! \brief Performs the destruction of all children objects and internal lists clearing
 		void destroyObjects(void);
@@ -129,6 +166,15 @@ class PhysicalTable: public BaseTable {
 		//! \brief Default char for data line break in initial-data tag
 		DataLineBreak;
 
+		/*! \brief Formats used to translate the initial data to SQL: multi-row INSERT commands or a COPY ... FROM stdin block.
+		 * When using COPY the rows containing DEFAULT values or expressions are still generated as INSERT commands.
+		 * Note that COPY FROM stdin blocks can only be executed by clients like psql */
+		static constexpr unsigned InsertDataFormat=0,
+		CopyDataFormat=1;
+
+		//! \brief Maximum amount of rows inserted by each INSERT command generated from the initial data
+		static constexpr int InsertBatchSize=1000;
+
 		PhysicalTable(void);
 		~PhysicalTable(void){}
 
@@ -353,10 +399,33 @@ class PhysicalTable: public BaseTable {
 		rows use the DATA_LINE_BREAK */
 		void setInitialData(const QString &value);
 
+		/*! \brief Splits a CSV-like buffer (in the same format of the initial data) into columns. The col_names list receives
+		 * the names in the first line and values the data stored per column, values[col][row]. Rows with less values than columns
+		 * are completed with empty values and the exceeding values are discarded. The amount of rows is returned */
+		static int splitInitialData(const QString &buffer, QStringList &col_names, vector<QStringList> &values);
+
+		/*! \brief Defines the initial data of the table from a set of columns and their values.
+		 * The values are stored per column, values[col][row], and the raw buffer is generated only when needed */
+		void setInitialData(const QStringList &col_names, const vector<QStringList> &values);
+
 		//! \brief Returns the table's initial data in raw format
 		QString getInitialData(void);
 
-		/*! \brief Translate the CSV-like initial data to a set of INSERT commands.
+		//! \brief Returns the names of the columns in the initial data (including the unknown/duplicated ones)
+		QStringList getInitialDataColumns(void);
+
+		//! \brief Returns the initial data values stored per column, [col][row]
+		vector<QStringList> getInitialDataValues(void);
+
+		//! \brief Returns the amount of rows in the initial data
+		int getInitialDataRowCount(void);
+
+		//! \brief Defines how the initial data will be translated to SQL (see InsertDataFormat and CopyDataFormat)
+		void setInitialDataFormat(unsigned format);
+
+		unsigned getInitialDataFormat(void);
+
+		/*! \brief Translate the CSV-like initial data to a set of INSERT commands or a COPY command depending on the data format.
 		In invalid columns exist in the buffer they will be rejected when generating the commands */
 		QString getInitialDataCommands(void);
 
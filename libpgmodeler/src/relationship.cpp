@@ -2361,6 +2361,30 @@ void Relationship::forceInvalidate(void)
 	this->invalidated=true;
 }
 
+bool Relationship::hasRequiredPrimaryKeys(Exception *error)
+{
+	PhysicalTable *ref_tab=getReferenceTable(),
+			*src_tab=dynamic_cast<PhysicalTable *>(src_table),
+			*dst_tab=dynamic_cast<PhysicalTable *>(dst_table);
+	bool has_pks=true;
+
+	if(rel_type==Relationship11 || rel_type==Relationship1n)
+		has_pks=(ref_tab && ref_tab->getPrimaryKey());
+	else if(rel_type==RelationshipNn)
+		has_pks=(src_tab && src_tab->getPrimaryKey() && dst_tab && dst_tab->getPrimaryKey());
+
+	if(!has_pks && error)
+	{
+		(*error)=Exception(Exception::getErrorMessage(ErrorCode::InvLinkTablesNoPrimaryKey)
+											 .arg(this->obj_name)
+											 .arg(src_table->getName(true))
+											 .arg(dst_table->getName(true)),
+											 ErrorCode::InvLinkTablesNoPrimaryKey,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(has_pks);
+}
+
 bool Relationship::isInvalidated(void)
 {
 	unsigned rel_cols_count=0, tab_cols_count=0, i=0, count=0;
@@ -405,6 +405,11 @@ class Relationship: public BaseRelationship {
 			made on de model class ​​only because it treats all cases of invalidity at once. */
 		bool isInvalidated(void);
 
+		/*! \brief Returns if the linked tables have the primary keys needed to connect the relationship (1:1, 1:n and n:n).
+			This allows checking the connection viability without raising exceptions. When the keys are missing and
+			the error parameter is specified it is configured with the same error raised by connectRelationship() */
+		bool hasRequiredPrimaryKeys(Exception *error=nullptr);
+
 		/*! \brief Forces the relationship to go into invalidated state. This method is useful to invalidate the
 		relationship without add/remove attributes from it. Calling this method will cause the model to revalidate
 		the relationship even it's structure does not reflect an invalid state (see isInvalidate).
@@ -23,8 +23,10 @@ Schema::Schema(void)
 	obj_type=ObjectType::Schema;
 	fill_color=QColor(225,225,225, 80);
 	rect_visible=false;
+	collapsed=false;
 	attributes[Attributes::FillColor]=QString();
 	attributes[Attributes::RectVisible]=QString();
+	attributes[Attributes::Collapsed]=QString();
 }
 
 void Schema::setName(const QString &name)
@@ -62,6 +64,17 @@ bool Schema::isRectVisible(void)
 	return(rect_visible);
 }
 
+void Schema::setCollapsed(bool value)
+{
+	setCodeInvalidated(collapsed != value);
+	collapsed=value;
+}
+
+bool Schema::isCollapsed(void)
+{
+	return(collapsed);
+}
+
 QString Schema::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
@@ -70,6 +83,7 @@ QString Schema::getCodeDefinition(unsigned def_type)
 	attributes[Attributes::Layer]=QString::number(layer);
 	attributes[Attributes::FillColor]=fill_color.name();
 	attributes[Attributes::RectVisible]=(rect_visible ? Attributes::True : QString());
+	attributes[Attributes::Collapsed]=(collapsed ? Attributes::True : QString());
 	setFadedOutAttribute();
 
 	return(BaseObject::__getCodeDefinition(def_type));
@@ -34,6 +34,10 @@ class Schema: public BaseGraphicObject {
 		QColor fill_color;
 		bool rect_visible;
 
+		/*! \brief Indicates that the schema is collapsed in the scene, this is, its tables and views
+		 * are not rendered and the whole schema is represented by a single placeholder box */
+		bool collapsed;
+
 	public:
 		Schema(void);
 
@@ -45,6 +49,11 @@ class Schema: public BaseGraphicObject {
 		void setRectVisible(bool value);
 		bool isRectVisible(void);
 
+		//! \brief Collapses/expands the schema contents in the scene
+		void setCollapsed(bool value);
+
+		bool isCollapsed(void);
+
 		virtual QString getCodeDefinition(unsigned def_type) final;
 };
 
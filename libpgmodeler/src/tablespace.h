@@ -30,7 +30,7 @@
 
 class Tablespace: public BaseObject{
 	private:
-		static unsigned tabspace_id;
+		static atomic<unsigned> tabspace_id;
 
 		//! \brief Directory where the tablespace resides
 		QString directory;
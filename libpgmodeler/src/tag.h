@@ -33,7 +33,7 @@ that replaces the original colors of tables/views that owns them.
 
 class Tag: public BaseObject {
 	private:
-		static unsigned tag_id;
+		static atomic<unsigned> tag_id;
 
 		//! \brief Stores the object colors configuration
 		map<QString, vector<QColor>> color_config;
@@ -343,6 +343,17 @@ vector<Column *> Trigger::getRelationshipAddedColumns(void)
 	return(cols);
 }
 
+void Trigger::remapColumns(const map<Column *, Column *> &col_map)
+{
+	for(auto &col : upd_columns)
+	{
+		if(col_map.count(col))
+			col = col_map.at(col);
+	}
+
+	setCodeInvalidated(true);
+}
+
 void Trigger::setBasicAttributes(unsigned def_type)
 {
 	QString str_aux,
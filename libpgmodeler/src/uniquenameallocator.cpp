@@ -0,0 +1,84 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "uniquenameallocator.h"
+
+QString UniqueNameAllocator::allocateName(BaseObject *obj, QSet<QString> &names, QHash<QString, unsigned> &counters,
+																					const QString &suffix, bool use_suf_on_conflict)
+{
+	ObjectType obj_type=obj->getObjectType();
+	QString obj_name, aux_name, prefix, id;
+	QChar oper_uniq_chr='?'; //Char appended at end of operator names in order to resolve conflicts
+	unsigned counter=0;
+
+	//Cast objects will not have the name changed since their name are automatically generated
+	if(obj_type==ObjectType::Cast || obj_type==ObjectType::Database)
+		return(obj->getName());
+
+	obj_name=obj->getName();
+
+	if(!use_suf_on_conflict && obj_type!=ObjectType::Operator)
+		obj_name += suffix;
+
+	counter=(use_suf_on_conflict && obj_type!=ObjectType::Operator ? 0 : 1);
+	id=QString::number(obj->getObjectId());
+
+	//If the name length exceeds the maximum size
+	if(obj_name.size() + id.size() > BaseObject::ObjectNameMaxLength)
+	{
+		//Remove the last chars in the count of 3 + length of id
+		obj_name.chop(id.size() + 3);
+
+		//Append the id of the object on its name (this is not applied to operators)
+		if(obj_type!=ObjectType::Operator)
+			obj_name+=QString("_") + id;
+	}
+
+	aux_name=obj_name;
+
+	if(names.contains(aux_name))
+	{
+		prefix=(obj_type==ObjectType::Operator || !use_suf_on_conflict ? obj_name : obj_name + suffix);
+
+		//Resumes from the last counter used for the same prefix
+		counter=std::max(counter, counters.value(prefix, counter));
+
+		do
+		{
+			//For operators is appended a '?' on the name
+			if(obj_type==ObjectType::Operator)
+				aux_name=QString("%1%2").arg(obj_name).arg(QString("").leftJustified(counter, oper_uniq_chr));
+			else
+				aux_name=QString("%1%2").arg(prefix).arg(use_suf_on_conflict && counter == 0 ? QString() : QString::number(counter));
+
+			counter++;
+		}
+		while(names.contains(aux_name));
+
+		counters[prefix]=counter;
+	}
+
+	names.insert(aux_name);
+	return(aux_name);
+}
+
+void UniqueNameAllocator::clear(void)
+{
+	used_names.clear();
+	next_counters.clear();
+}
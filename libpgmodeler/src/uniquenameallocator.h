@@ -0,0 +1,80 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler
+\class UniqueNameAllocator
+\brief Generates unique names for several objects in batch (e.g. when pasting or duplicating objects).
+The names in use are indexed (per container object and object type) in the first allocation so each
+allocation costs a few hash lookups instead of scanning the objects list as PgModelerNs::generateUniqueName() does.
+The allocated names are registered as in use so objects allocated in the same batch never conflict with each other.
+*/
+
+#ifndef UNIQUE_NAME_ALLOCATOR_H
+#define UNIQUE_NAME_ALLOCATOR_H
+
+#include "baseobject.h"
+#include <QSet>
+#include <QHash>
+
+class UniqueNameAllocator {
+	private:
+		//! \brief Names in use for each object type in each container object (database, table or view)
+		map<BaseObject *, map<ObjectType, QSet<QString>>> used_names;
+
+		/*! \brief Next counter to be tried for each name prefix. This avoids testing the same
+		 * candidates again when several objects with the same name are allocated */
+		map<BaseObject *, map<ObjectType, QHash<QString, unsigned>>> next_counters;
+
+		//! \brief Generates the unique name for the object using the provided name index
+		QString allocateName(BaseObject *obj, QSet<QString> &names, QHash<QString, unsigned> &counters,
+												 const QString &suffix, bool use_suf_on_conflict);
+
+	public:
+		UniqueNameAllocator(void) {}
+
+		/*! \brief Returns a name for the object that doesn't conflict with the objects in obj_list (children of container)
+		 * nor with the names previously allocated for the same container. The rules used to generate the name are the
+		 * same of PgModelerNs::generateUniqueName(). The list is only indexed in the first allocation for the
+		 * container/object type pair so it must not change (except by the allocated objects) between allocations */
+		template <class Class>
+		QString allocateName(BaseObject *obj, BaseObject *container, vector<Class *> &obj_list, const QString &suffix=QString(), bool use_suf_on_conflict=false)
+		{
+			if(!obj)
+				return(QString());
+
+			ObjectType obj_type=obj->getObjectType();
+
+			if(!used_names[container].count(obj_type))
+			{
+				QSet<QString> &names=used_names[container][obj_type];
+
+				names.reserve(obj_list.size());
+
+				for(auto &aux_obj : obj_list)
+					names.insert(aux_obj->getName());
+			}
+
+			return(allocateName(obj, used_names[container][obj_type], next_counters[container][obj_type], suffix, use_suf_on_conflict));
+		}
+
+		//! \brief Clears the names index
+		void clear(void);
+};
+
+#endif
@@ -120,7 +120,14 @@ SOURCES += src/mainwindow.cpp \
     src/layerswidget.cpp \
     src/foreigndatawrapperwidget.cpp \
     src/foreignserverwidget.cpp \
-    src/usermappingwidget.cpp
+    src/usermappingwidget.cpp \
+    src/memoryusagewidget.cpp \
+    src/stallmonitorwidget.cpp \
+    src/svgstreamdevice.cpp \
+    src/sqlhistorystore.cpp \
+    src/modelloadhelper.cpp \
+    src/modelsavehelper.cpp \
+    src/modelprinthelper.cpp
 
 
 HEADERS += src/mainwindow.h \
@@ -228,7 +235,14 @@ HEADERS += src/mainwindow.h \
     src/layerswidget.h \
     src/foreigndatawrapperwidget.h \
     src/foreignserverwidget.h \
-    src/usermappingwidget.h
+    src/usermappingwidget.h \
+    src/memoryusagewidget.h \
+    src/stallmonitorwidget.h \
+    src/svgstreamdevice.h \
+    src/sqlhistorystore.h \
+    src/modelloadhelper.h \
+    src/modelsavehelper.h \
+    src/modelprinthelper.h
 
 FORMS += ui/mainwindow.ui \
 	 ui/textboxwidget.ui \
@@ -316,7 +330,9 @@ FORMS += ui/mainwindow.ui \
     ui/layerswidget.ui \
     ui/foreigndatawrapperwidget.ui \
     ui/foreignserverwidget.ui \
-    ui/usermappingwidget.ui
+    ui/usermappingwidget.ui \
+    ui/memoryusagewidget.ui \
+    ui/stallmonitorwidget.ui
 
 unix|windows: LIBS += -L$$OUT_PWD/../libobjrenderer/ -lobjrenderer \
                       -L$$OUT_PWD/../libpgconnector/ -lpgconnector \
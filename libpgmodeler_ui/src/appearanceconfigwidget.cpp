@@ -17,6 +17,7 @@
 */
 
 #include "appearanceconfigwidget.h"
+#include "messagebox.h"
 
 map<QString, attribs_map> AppearanceConfigWidget::config_params;
 
@@ -234,6 +235,21 @@ void AppearanceConfigWidget::updatePlaceholderItem(void)
 	placeholder->setPen(pen);
 }
 
+void AppearanceConfigWidget::showEvent(QShowEvent *event)
+{
+	BaseConfigWidget::showEvent(event);
+
+	try
+	{
+		this->loadExampleModel();
+	}
+	catch(Exception &e)
+	{
+		Messagebox msg_box;
+		msg_box.show(e);
+	}
+}
+
 void AppearanceConfigWidget::loadConfiguration(void)
 {
 	try
@@ -241,7 +257,6 @@ void AppearanceConfigWidget::loadConfiguration(void)
 		int i, count=conf_items.size();
 
 		BaseObjectView::loadObjectsStyle();
-		this->loadExampleModel();
 
 		for(i=0; i < count; i++)
 		{
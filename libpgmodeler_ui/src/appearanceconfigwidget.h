@@ -72,6 +72,10 @@ class AppearanceConfigWidget: public BaseConfigWidget, public Ui::AppearanceConf
 		//! \brief Updates the color configuration for the placeholder item
 		void updatePlaceholderItem(void);
 		
+	protected:
+		//! \brief Loads the example model only when the widget is shown for the first time, saving its loading at startup
+		void showEvent(QShowEvent *event);
+		
 	public:
 		AppearanceConfigWidget(QWidget * parent = nullptr);
 		~AppearanceConfigWidget(void);
@@ -18,12 +18,86 @@
 
 #include "baseconfigwidget.h"
 #include "messagebox.h"
+#include <QThreadPool>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QCryptographicHash>
+
+map<QString, BaseConfigWidget::PreloadedConfig> BaseConfigWidget::preloaded_confs;
+QMutex BaseConfigWidget::preloaded_confs_mtx;
+
+BaseConfigWidget::ConfigReader::ConfigReader(const QString &conf_id)
+{
+	this->conf_id=conf_id;
+}
+
+void BaseConfigWidget::ConfigReader::run(void)
+{
+	PreloadedConfig conf;
+	QFileInfo fi(getConfigurationFile(conf_id));
+
+	try
+	{
+		//The file stamp is taken before reading so a change made meanwhile invalidates the preloaded data
+		conf.last_modified=fi.lastModified();
+		conf.size=fi.size();
+		readConfigurationFile(conf_id, conf.elements);
+
+		QMutexLocker locker(&preloaded_confs_mtx);
+		preloaded_confs[conf_id]=conf;
+	}
+	catch(Exception &)
+	{
+		//The error is raised again (and reported) when the subclass loads the file by itself
+	}
+}
 
 BaseConfigWidget::BaseConfigWidget(QWidget *parent) : QWidget(parent)
 {
 	config_changed=false;
 }
 
+QString BaseConfigWidget::getConfigurationFile(const QString &conf_id)
+{
+	return(GlobalAttributes::ConfigurationsDir +
+				 GlobalAttributes::DirSeparator +
+				 conf_id +
+				 GlobalAttributes::ConfigurationExt);
+}
+
+QString BaseConfigWidget::getCacheFile(const QString &conf_id)
+{
+	return(GlobalAttributes::ConfigurationsDir +
+				 GlobalAttributes::DirSeparator +
+				 GlobalAttributes::ConfsCacheDir +
+				 GlobalAttributes::DirSeparator +
+				 conf_id + QString(".cache"));
+}
+
+QByteArray BaseConfigWidget::getFileHash(const QString &filename)
+{
+	QFile input(filename);
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+
+	if(input.open(QFile::ReadOnly))
+	{
+		hash.addData(&input);
+		input.close();
+	}
+
+	return(hash.result());
+}
+
+void BaseConfigWidget::preloadConfigurations(const QStringList &conf_ids)
+{
+	QThreadPool pool;
+
+	for(auto &conf_id : conf_ids)
+		pool.start(new ConfigReader(conf_id));
+
+	pool.waitForDone();
+}
+
 void BaseConfigWidget::addConfigurationParam(map<QString, attribs_map> &config_params, const QString &param, const attribs_map &attribs)
 {
 	if(!param.isEmpty() && !attribs.empty())
@@ -144,94 +218,247 @@ void BaseConfigWidget::restoreDefaults(const QString &conf_id, bool silent)
 
 void BaseConfigWidget::loadConfiguration(const QString &conf_id, map<QString, attribs_map> &config_params, const vector<QString> &key_attribs)
 {
-	QString filename;
+	QString filename=getConfigurationFile(conf_id);
+	vector<ConfigElement> elements;
+	bool preloaded=false;
 
 	try
 	{
-		filename = GlobalAttributes::ConfigurationsDir +
-							 GlobalAttributes::DirSeparator +
-							 conf_id +
-							 GlobalAttributes::ConfigurationExt;
-
 		config_params.clear();
-		xmlparser.restartParser();
-		xmlparser.setDTDFile(GlobalAttributes::TmplConfigurationDir +
-							 GlobalAttributes::DirSeparator +
-							 GlobalAttributes::ObjectDTDDir +
-							 GlobalAttributes::DirSeparator +
-							 conf_id +
-							 GlobalAttributes::ObjectDTDExt,
-							 conf_id);
-
-		xmlparser.loadXMLFile(filename);
-
-		if(xmlparser.accessElement(XmlParser::ChildElement))
+
+		preloaded_confs_mtx.lock();
+		auto itr=preloaded_confs.find(conf_id);
+
+		if(itr!=preloaded_confs.end())
 		{
-			do
+			QFileInfo fi(filename);
+
+			//The preloaded elements are discarded if the file was changed after being read
+			if(itr->second.last_modified==fi.lastModified() && itr->second.size==fi.size())
 			{
-				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+				elements.swap(itr->second.elements);
+				preloaded=true;
+			}
+
+			preloaded_confs.erase(itr);
+		}
+
+		preloaded_confs_mtx.unlock();
+
+		if(!preloaded)
+			readConfigurationFile(conf_id, elements);
+
+		for(auto &elem : elements)
+			getConfigurationParams(elem, config_params, key_attribs);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, filename);
+	}
+}
+
+void BaseConfigWidget::readConfigurationFile(const QString &conf_id, vector<ConfigElement> &elements)
+{
+	QByteArray conf_hash;
+
+	elements.clear();
+
+	if(loadCachedConfiguration(conf_id, elements, conf_hash))
+	{
+		//The file was touched but its contents are the same, so only the stamp in the cache is refreshed
+		if(!conf_hash.isEmpty())
+			saveCachedConfiguration(conf_id, elements, conf_hash);
+
+		return;
+	}
+
+	if(conf_hash.isEmpty())
+		conf_hash=getFileHash(getConfigurationFile(conf_id));
+
+	parseConfigurationFile(conf_id, elements);
+	saveCachedConfiguration(conf_id, elements, conf_hash);
+}
+
+void BaseConfigWidget::parseConfigurationFile(const QString &conf_id, vector<ConfigElement> &elements)
+{
+	XmlParser xmlparser;
+
+	auto read_element=[&xmlparser, &elements](){
+		ConfigElement elem;
+
+		elem.name=xmlparser.getElementName();
+		xmlparser.getElementAttributes(elem.attribs);
+
+		//Extract the contents of the child element and create a special element on map called "_contents_"
+		if(xmlparser.hasElement(XmlParser::ChildElement, XML_TEXT_NODE))
+		{
+			xmlparser.savePosition();
+			xmlparser.accessElement(XmlParser::ChildElement);
+			elem.attribs[Attributes::Contents]=xmlparser.getElementContent();
+			xmlparser.restorePosition();
+		}
+
+		if(!elem.attribs.empty())
+			elements.push_back(elem);
+	};
+
+	xmlparser.setDTDFile(GlobalAttributes::TmplConfigurationDir +
+						 GlobalAttributes::DirSeparator +
+						 GlobalAttributes::ObjectDTDDir +
+						 GlobalAttributes::DirSeparator +
+						 conf_id +
+						 GlobalAttributes::ObjectDTDExt,
+						 conf_id);
+
+	xmlparser.loadXMLFile(getConfigurationFile(conf_id));
+
+	if(xmlparser.accessElement(XmlParser::ChildElement))
+	{
+		do
+		{
+			if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+			{
+				read_element();
+
+				if(xmlparser.hasElement(XmlParser::ChildElement, XML_ELEMENT_NODE))
 				{
-					this->getConfigurationParams(config_params, key_attribs);
+					xmlparser.savePosition();
+					xmlparser.accessElement(XmlParser::ChildElement);
 
-					if(xmlparser.hasElement(XmlParser::ChildElement, XML_ELEMENT_NODE))
+					if(xmlparser.getElementType()!=XML_TEXT_NODE)
 					{
-						xmlparser.savePosition();
-						xmlparser.accessElement(XmlParser::ChildElement);
-
-						if(xmlparser.getElementType()!=XML_TEXT_NODE)
+						do
 						{
-							do
-							{
-								this->getConfigurationParams(config_params, key_attribs);
-							}
-							while(xmlparser.accessElement(XmlParser::NextElement));
+							read_element();
 						}
-
-						xmlparser.restorePosition();
+						while(xmlparser.accessElement(XmlParser::NextElement));
 					}
+
+					xmlparser.restorePosition();
 				}
 			}
-			while(xmlparser.accessElement(XmlParser::NextElement));
 		}
+		while(xmlparser.accessElement(XmlParser::NextElement));
 	}
-	catch(Exception &e)
+}
+
+bool BaseConfigWidget::loadCachedConfiguration(const QString &conf_id, vector<ConfigElement> &elements, QByteArray &conf_hash)
+{
+	QFile cache_file(getCacheFile(conf_id));
+	QFileInfo conf_fi(getConfigurationFile(conf_id)),
+			dtd_fi(GlobalAttributes::TmplConfigurationDir + GlobalAttributes::DirSeparator +
+						 GlobalAttributes::ObjectDTDDir + GlobalAttributes::DirSeparator +
+						 conf_id + GlobalAttributes::ObjectDTDExt);
+	QDataStream stream;
+	quint32 magic=0, format=0, elem_count=0, attr_count=0;
+	qint64 conf_mtime=0, conf_size=0, dtd_mtime=0, dtd_size=0;
+	QString version, attr_name, attr_value;
+	QByteArray cached_hash;
+	ConfigElement elem;
+
+	if(!conf_fi.exists() || !cache_file.open(QFile::ReadOnly))
+		return(false);
+
+	stream.setDevice(&cache_file);
+	stream >> magic >> format >> version >> conf_mtime >> conf_size >> cached_hash >> dtd_mtime >> dtd_size;
+
+	//Caches created by other versions or against a different DTD are rebuilt
+	if(stream.status()!=QDataStream::Ok || magic!=CacheMagic || format!=CacheFormatVersion ||
+		 version!=GlobalAttributes::PgModelerVersion ||
+		 dtd_mtime!=dtd_fi.lastModified().toMSecsSinceEpoch() || dtd_size!=dtd_fi.size())
+		return(false);
+
+	//The hash is computed only when the file stamp differs from the one cached
+	if(conf_mtime!=conf_fi.lastModified().toMSecsSinceEpoch() || conf_size!=conf_fi.size())
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, filename);
+		conf_hash=getFileHash(conf_fi.absoluteFilePath());
+
+		if(conf_hash!=cached_hash)
+			return(false);
+	}
+
+	stream >> elem_count;
+
+	for(quint32 i=0; i < elem_count && stream.status()==QDataStream::Ok; i++)
+	{
+		elem.attribs.clear();
+		stream >> elem.name >> attr_count;
+
+		for(quint32 j=0; j < attr_count && stream.status()==QDataStream::Ok; j++)
+		{
+			stream >> attr_name >> attr_value;
+			elem.attribs[attr_name]=attr_value;
+		}
+
+		elements.push_back(elem);
+	}
+
+	cache_file.close();
+
+	//A truncated cache is discarded and the configuration file is parsed again
+	if(stream.status()!=QDataStream::Ok)
+	{
+		elements.clear();
+		conf_hash.clear();
+		return(false);
 	}
+
+	return(true);
 }
 
-void BaseConfigWidget::getConfigurationParams(map<QString, attribs_map> &config_params, const vector<QString> &key_attribs)
+void BaseConfigWidget::saveCachedConfiguration(const QString &conf_id, const vector<ConfigElement> &elements, const QByteArray &conf_hash)
 {
-	attribs_map aux_attribs;
-	attribs_map::iterator itr, itr_end;
-	QString key;
+	QString cache_filename=getCacheFile(conf_id);
+	QSaveFile cache_file(cache_filename);
+	QFileInfo conf_fi(getConfigurationFile(conf_id)),
+			dtd_fi(GlobalAttributes::TmplConfigurationDir + GlobalAttributes::DirSeparator +
+						 GlobalAttributes::ObjectDTDDir + GlobalAttributes::DirSeparator +
+						 conf_id + GlobalAttributes::ObjectDTDExt);
+	QDataStream stream;
+
+	QDir().mkpath(QFileInfo(cache_filename).absolutePath());
+
+	if(!cache_file.open(QFile::WriteOnly))
+		return;
+
+	stream.setDevice(&cache_file);
+	stream << CacheMagic << CacheFormatVersion << GlobalAttributes::PgModelerVersion
+				 << conf_fi.lastModified().toMSecsSinceEpoch() << conf_fi.size() << conf_hash
+				 << dtd_fi.lastModified().toMSecsSinceEpoch() << dtd_fi.size()
+				 << static_cast<quint32>(elements.size());
+
+	for(auto &elem : elements)
+	{
+		stream << elem.name << static_cast<quint32>(elem.attribs.size());
+
+		for(auto &attr : elem.attribs)
+			stream << attr.first << attr.second;
+	}
+
+	if(stream.status()==QDataStream::Ok)
+		cache_file.commit();
+	else
+		cache_file.cancelWriting();
+}
 
-	xmlparser.getElementAttributes(aux_attribs);
+void BaseConfigWidget::getConfigurationParams(const ConfigElement &elem, map<QString, attribs_map> &config_params, const vector<QString> &key_attribs)
+{
+	attribs_map::const_iterator itr, itr_end;
+	QString key;
 
-	itr=aux_attribs.begin();
-	itr_end=aux_attribs.end();
+	itr=elem.attribs.begin();
+	itr_end=elem.attribs.end();
 
 	while(itr!=itr_end && key.isEmpty())
 	{
-		if(key.isEmpty() && std::find(key_attribs.begin(), key_attribs.end(), itr->first)!=key_attribs.end())
+		if(itr->first!=Attributes::Contents && std::find(key_attribs.begin(), key_attribs.end(), itr->first)!=key_attribs.end())
 			key=itr->second;
 
 		itr++;
 	}
 
 	if(key.isEmpty())
-		key=xmlparser.getElementName();
+		key=elem.name;
 
-	//Extract the contents of the child element and create a special element on map called "_contents_"
-	if(xmlparser.hasElement(XmlParser::ChildElement, XML_TEXT_NODE))
-	{
-		xmlparser.savePosition();
-		xmlparser.accessElement(XmlParser::ChildElement);
-		aux_attribs[Attributes::Contents]=xmlparser.getElementContent();
-		xmlparser.restorePosition();
-	}
-
-	if(!aux_attribs.empty())
-		config_params[key]=aux_attribs;
+	config_params[key]=elem.attribs;
 }
-
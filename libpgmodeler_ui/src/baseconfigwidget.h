@@ -32,15 +32,70 @@
 #include "attributes.h"
 #include <algorithm>
 #include <QWidget>
+#include <QRunnable>
+#include <QMutex>
+#include <QDateTime>
 
 class BaseConfigWidget: public QWidget {
 	private:
 		Q_OBJECT
 		
+		//! \brief Stores an element read from a configuration file (the text contents are stored in Attributes::Contents)
+		struct ConfigElement {
+			QString name;
+			attribs_map attribs;
+		};
+
+		//! \brief Stores the elements of a configuration file read in advance by preloadConfigurations()
+		struct PreloadedConfig {
+			QDateTime last_modified;
+			qint64 size;
+			vector<ConfigElement> elements;
+		};
+
+		//! \brief Reads a single configuration file in a worker thread (see preloadConfigurations())
+		class ConfigReader: public QRunnable {
+			private:
+				QString conf_id;
+
+			public:
+				ConfigReader(const QString &conf_id);
+				void run(void);
+		};
+
+		//! \brief Identifies the precompiled configuration files and the version of their layout
+		static constexpr quint32 CacheMagic=0x7067636e, CacheFormatVersion=1;
+
+		//! \brief Configuration files read in advance and not yet consumed by loadConfiguration()
+		static map<QString, PreloadedConfig> preloaded_confs;
+
+		static QMutex preloaded_confs_mtx;
+
 		bool config_changed;
-		
+
+		static QString getConfigurationFile(const QString &conf_id);
+		static QString getCacheFile(const QString &conf_id);
+
+		/*! \brief Reads the elements of the configuration file. The DTD validation is performed only when the file
+		 * differs from the one stored in the precompiled cache (conf/cache/[conf_id].cache), otherwise, the elements are
+		 * read straight from the cache. This method is thread safe */
+		static void readConfigurationFile(const QString &conf_id, vector<ConfigElement> &elements);
+
+		//! \brief Parses and validates the configuration file against its DTD
+		static void parseConfigurationFile(const QString &conf_id, vector<ConfigElement> &elements);
+
+		/*! \brief Reads the elements from the precompiled cache. Returns false when the cache does not exist or is outdated.
+		 * The hash of the configuration file is computed only when its modification time and size differ from the ones stored,
+		 * in that case, the conf_hash is assigned and the cache must be saved again to refresh the file stamp */
+		static bool loadCachedConfiguration(const QString &conf_id, vector<ConfigElement> &elements, QByteArray &conf_hash);
+
+		//! \brief Saves the elements to the precompiled cache. Failures are ignored since the cache is only an optimization
+		static void saveCachedConfiguration(const QString &conf_id, const vector<ConfigElement> &elements, const QByteArray &conf_hash);
+
+		//! \brief Returns the SHA1 hash of the specified file contents
+		static QByteArray getFileHash(const QString &filename);
+
 	protected:
-		XmlParser xmlparser;
 		SchemaParser schparser;
 		
 		/*! \brief Saves the configuration params on file. The conf_id param indicates the type of
@@ -52,8 +107,8 @@ class BaseConfigWidget: public QWidget {
 		 considered as a key on the configuration map */
 		void loadConfiguration(const QString &conf_id, map<QString, attribs_map> &config_params, const vector<QString> &key_attribs=vector<QString>());
 		
-		//! \brief Get a configuratoin key from the xml parser
-		void getConfigurationParams(map<QString, attribs_map> &config_params, const vector<QString> &key_attribs);
+		//! \brief Get a configuration key from an element read from the configuration file
+		void getConfigurationParams(const ConfigElement &elem, map<QString, attribs_map> &config_params, const vector<QString> &key_attribs);
 		
 		/*! \brief Restore the configuration specified by conf_in loading them from the original file (conf/defaults)
 		 * The silent parameter indicates that the restoration should not emit a message box informing the restoration sucess */
@@ -70,6 +125,11 @@ class BaseConfigWidget: public QWidget {
 		
 		bool isConfigurationChanged(void);
 		
+		/*! \brief Reads the specified configuration files in parallel so the next call to loadConfiguration() for each one
+		 * only needs to build the configuration parameters. Files that fail to be read are ignored here and their errors
+		 * are raised when the subclass loads them */
+		static void preloadConfigurations(const QStringList &conf_ids);
+		
 		//! \brief Applies the configuration to object
 		virtual void applyConfiguration(void)=0;
 		
@@ -110,6 +110,10 @@ void ConfigurationForm::loadConfiguration(void)
 {
 	BaseConfigWidget *config_wgt = nullptr;
 
+	//Reading the independent configuration files in parallel before applying them to each widget
+	BaseConfigWidget::preloadConfigurations({ GlobalAttributes::GeneralConf, GlobalAttributes::ConnectionsConf,
+																						GlobalAttributes::RelationshipsConf, GlobalAttributes::SnippetsConf });
+
 	for(int i=GeneralConfWgt; i <= PluginsConfWgt; i++)
 	{
 		try
@@ -248,6 +248,17 @@ DatabaseExplorerWidget::DatabaseExplorerWidget(QWidget *parent): QWidget(parent)
 	act=refresh_menu->addAction(trUtf8("Full refresh"), this, SLOT(listObjects()), QKeySequence("Ctrl+F5"));
 	act->setData(QVariant::fromValue<bool>(false));
 
+	//Displays the catalog cache usage each time the refresh menu is shown
+	refresh_menu->addSeparator();
+	act=refresh_menu->addAction(QString());
+	act->setEnabled(false);
+
+	connect(refresh_menu, &QMenu::aboutToShow, [act](){
+		act->setText(trUtf8("Catalog cache: %1 hit(s), %2 miss(es)")
+								 .arg(Catalog::getResultsCacheHits())
+								 .arg(Catalog::getResultsCacheMisses()));
+	});
+
 	refresh_tb->setPopupMode(QToolButton::InstantPopup);
 	refresh_tb->setMenu(refresh_menu);
 
@@ -284,7 +295,10 @@ bool DatabaseExplorerWidget::eventFilter(QObject *object, QEvent *event)
 				}
 			}
 			else if(k_event->key()==Qt::Key_F6)
+			{
+				Catalog::invalidateResultsCache(connection);
 				updateItem(objects_trw->currentItem());
+			}
 			else if(k_event->key()==Qt::Key_F2)
 				startObjectRename(objects_trw->currentItem());
 			else if(k_event->key()==Qt::Key_F7)
@@ -1003,6 +1017,8 @@ void DatabaseExplorerWidget::listObjects(void)
 		QAction *act=qobject_cast<QAction *>(sender());
 		bool quick_refresh=(act ? act->data().toBool() : true);
 
+		//A manual refresh always retrieves fresh data from the catalog
+		Catalog::invalidateResultsCache(connection);
 		configureImportHelper();
 		objects_trw->blockSignals(true);
 
@@ -1114,7 +1130,10 @@ void DatabaseExplorerWidget::handleObject(QTreeWidgetItem *item, int)
 		else if(exec_action==truncate_action || exec_action==trunc_cascade_action)
 			truncateTable(item,  exec_action==trunc_cascade_action);
 		else if(exec_action==refresh_action)
+		{
+			Catalog::invalidateResultsCache(connection);
 			updateItem(objects_trw->currentItem());
+		}
 		else if(exec_action==rename_action)
 			startObjectRename(item);
 		else if(exec_action==properties_action)
@@ -1310,6 +1329,7 @@ void DatabaseExplorerWidget::dropObject(QTreeWidgetItem *item, bool cascade)
 				conn=connection;
 				conn.connect();
 				conn.executeDDLCommand(drop_cmd);
+				Catalog::invalidateResultsCache(conn);
 
 				//Updates the object count on the parent item
 				parent=item->parent();
@@ -1377,6 +1397,7 @@ bool DatabaseExplorerWidget::truncateTable(const QString &sch_name, const QStrin
 			conn = connection;
 			conn.connect();
 			conn.executeDDLCommand(truc_cmd);
+			Catalog::invalidateResultsCache(conn);
 		}
 
 		return(msg_box.result()==QDialog::Accepted);
@@ -1775,6 +1796,7 @@ void DatabaseExplorerWidget::finishObjectRename(void)
 			//Executes the rename cmd
 			conn.connect();
 			conn.executeDDLCommand(rename_cmd);
+			Catalog::invalidateResultsCache(conn);
 
 			rename_item->setFlags(rename_item->flags() ^ Qt::ItemIsEditable);
 			rename_item=nullptr;
@@ -2028,6 +2050,7 @@ void DatabaseExplorerWidget::dropDatabase(void)
 			conn.connect();
 			conn.executeDDLCommand(QString("DROP DATABASE \"%1\";").arg(dbname));
 			conn.close();
+			Catalog::invalidateResultsCache(conn);
 			this->setEnabled(false);
 			emit s_databaseDropped(dbname);
 		}
@@ -215,6 +215,9 @@ void DatabaseImportForm::importDatabase(void)
 			PgModelerUiNs::createOutputTreeItem(output_trw, trUtf8("<strong>Low verbosity is set:</strong> only key informations and errors will be displayed."),
 																					QPixmap(PgModelerUiNs::getIconPath("msgbox_alerta")), nullptr, false);
 
+		//The objects must be imported as they currently are in the database so the server's cached catalog results are discarded
+		Catalog::invalidateResultsCache(*reinterpret_cast<Connection *>(connections_cmb->itemData(connections_cmb->currentIndex()).value<void *>()));
+
 		getCheckedItems(obj_oids, col_oids);
 		obj_oids[ObjectType::Database].push_back(database_cmb->itemData(database_cmb->currentIndex()).value<unsigned>());
 
@@ -323,6 +326,9 @@ void DatabaseImportForm::listObjects(void)
 		{
 			Connection *conn=reinterpret_cast<Connection *>(connections_cmb->itemData(connections_cmb->currentIndex()).value<void *>());
 
+			//Listing the objects as they currently are in the database instead of using cached catalog results
+			Catalog::invalidateResultsCache(*conn);
+
 			//Set the working database on import helper
 			import_helper->closeConnection();
 			import_helper->setConnection(*conn);
@@ -30,6 +30,9 @@ DatabaseImportHelper::DatabaseImportHelper(QObject *parent) : QObject(parent)
 	import_filter=Catalog::ListAllObjects | Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs;
 	xmlparser=nullptr;
 	dbmodel=nullptr;
+
+	//The objects are imported as they currently are in the database so the catalog results cache isn't used
+	catalog.setBypassResultsCache(true);
 }
 
 void DatabaseImportHelper::setConnection(Connection &conn)
@@ -356,7 +359,8 @@ void DatabaseImportHelper::createObjects(void)
 			//Scan the oid list recreating the objects
 			while(itr!=itr_end && !import_canceled)
 			{
-				attribs=user_objs[*itr];
+				oid=(*itr);
+				attribs=user_objs[oid];
 				obj_type=static_cast<ObjectType>(attribs[Attributes::ObjectType].toUInt());
 				itr++;
 
@@ -374,7 +378,7 @@ void DatabaseImportHelper::createObjects(void)
 				catch(Exception &e)
 				{
 					//In case of some error store the oid and the error in separated lists
-					not_created_objs.push_back(*itr);
+					not_created_objs.push_back(oid);
 					aux_errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs)));
 				}
 
@@ -1563,8 +1567,7 @@ void DatabaseImportHelper::createType(attribs_map &attribs)
 
 		if(!attribs[Attributes::EnumType].isEmpty())
 		{
-			attribs[Attributes::Enumerations]=Catalog::parseArrayValues(attribs[Attributes::Enumerations]).join(',');
-			attribs[Attributes::Enumerations].remove('"');
+			attribs[Attributes::Enumerations]=Catalog::decodeArrayValues(attribs[Attributes::Enumerations]).join(',');
 		}
 		else if(!attribs[Attributes::CompositeType].isEmpty())
 		{
@@ -2136,7 +2139,7 @@ void DatabaseImportHelper::createEventTrigger(attribs_map &attribs)
 										   .arg(Attributes::Filter)
 										   .arg(Attributes::Variable).arg(Attributes::Tag.toUpper())
 										   .arg(Attributes::Values)
-										   .arg(Catalog::parseArrayValues(attribs[Attributes::Values].remove('"')).join(','));
+										   .arg(Catalog::decodeArrayValues(attribs[Attributes::Values]).join(','));
 
 		loadObjectXML(ObjectType::EventTrigger, attribs);
 		dbmodel->addEventTrigger(dbmodel->createEventTrigger());
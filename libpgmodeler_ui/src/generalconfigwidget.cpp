@@ -130,6 +130,8 @@ GeneralConfigWidget::GeneralConfigWidget(QWidget * parent) : BaseConfigWidget(pa
 	config_params[Attributes::Configuration][Attributes::UsePlaceholders]=QString();
 	config_params[Attributes::Configuration][Attributes::MinObjectOpacity]=QString();
 	config_params[Attributes::Configuration][Attributes::HistoryMaxLength]=QString();
+	config_params[Attributes::Configuration][Attributes::ResultsMemLimit]=QString();
+	config_params[Attributes::Configuration][Attributes::CatalogCacheTtl]=QString();
 	config_params[Attributes::Configuration][Attributes::SourceEditorApp]=QString();
 	config_params[Attributes::Configuration][Attributes::UiLanguage]=QString();
 	config_params[Attributes::Configuration][Attributes::UseCurvedLines]=QString();
@@ -290,6 +292,12 @@ void GeneralConfigWidget::loadConfiguration(void)
 		oplist_size_spb->setValue((config_params[Attributes::Configuration][Attributes::OpListSize]).toUInt());
 		history_max_length_spb->setValue(config_params[Attributes::Configuration][Attributes::HistoryMaxLength].toUInt());
 
+		if(!config_params[Attributes::Configuration][Attributes::ResultsMemLimit].isEmpty())
+			results_mem_limit_spb->setValue(config_params[Attributes::Configuration][Attributes::ResultsMemLimit].toUInt());
+
+		if(!config_params[Attributes::Configuration][Attributes::CatalogCacheTtl].isEmpty())
+			catalog_cache_ttl_spb->setValue(config_params[Attributes::Configuration][Attributes::CatalogCacheTtl].toUInt());
+
 		interv=(config_params[Attributes::Configuration][Attributes::AutoSaveInterval]).toUInt();
 		tab_width=(config_params[Attributes::Configuration][Attributes::CodeTabWidth]).toInt();
 
@@ -521,6 +529,8 @@ void GeneralConfigWidget::saveConfiguration(void)
 		config_params[Attributes::Configuration][Attributes::MinObjectOpacity]=QString::number(min_obj_opacity_spb->value());
 		config_params[Attributes::Configuration][Attributes::UsePlaceholders]=(use_placeholders_chk->isChecked() ? Attributes::True : QString());
 		config_params[Attributes::Configuration][Attributes::HistoryMaxLength]=QString::number(history_max_length_spb->value());
+		config_params[Attributes::Configuration][Attributes::ResultsMemLimit]=QString::number(results_mem_limit_spb->value());
+		config_params[Attributes::Configuration][Attributes::CatalogCacheTtl]=QString::number(catalog_cache_ttl_spb->value());
 		config_params[Attributes::Configuration][Attributes::UseCurvedLines]=(use_curved_lines_chk->isChecked() ? Attributes::True : QString());
 		config_params[Attributes::Configuration][Attributes::AttribsPerPage]=QString::number(attribs_per_page_spb->value());
 		config_params[Attributes::Configuration][Attributes::ExtAttribsPerPage]=QString::number(ext_attribs_per_page_spb->value());
@@ -682,6 +692,8 @@ void GeneralConfigWidget::applyConfiguration(void)
 	MainWindow::setConfirmValidation(confirm_validation_chk->isChecked());
 	BaseObjectView::setPlaceholderEnabled(use_placeholders_chk->isChecked());
 	SQLExecutionWidget::setSQLHistoryMaxLength(history_max_length_spb->value());
+	ResultSetModel::setMemoryLimit(static_cast<qint64>(results_mem_limit_spb->value()) * 1024 * 1024);
+	Catalog::setResultsCacheTTL(catalog_cache_ttl_spb->value());
 
 	fnt.setFamily(config_params[Attributes::Configuration][Attributes::CodeFont]);
 	fnt.setPointSizeF(fnt_size);
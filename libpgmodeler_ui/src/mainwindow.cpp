@@ -21,11 +21,20 @@
 #include "bugreportform.h"
 #include "metadatahandlingform.h"
 #include "sqlexecutionwidget.h"
+#include "stallmonitorwidget.h"
 
 bool MainWindow::confirm_validation=true;
 
 MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(parent, flags)
 {
+	QElapsedTimer startup_timer;
+	vector<pair<QString, qint64>> startup_phases;
+
+	auto finish_phase=[&startup_timer, &startup_phases](const QString &phase){
+		startup_phases.push_back({ phase, startup_timer.restart() });
+	};
+
+	startup_timer.start();
 	setupUi(this);
 
 	map<QString, attribs_map >confs;
@@ -36,6 +45,7 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 
 	pending_op=NoPendingOp;
 	central_wgt=nullptr;
+	tmpmodel_snapshot_time=0;
 
 	layers_wgt = new LayersWidget(this);
 	layers_wgt->setVisible(false);
@@ -75,10 +85,12 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 		grid->setSpacing(0);
 		grid->addWidget(sql_tool_wgt, 0, 0);
 		views_stw->widget(ManageView)->setLayout(grid);
+		finish_phase(QString("User interface setup"));
 
 		configuration_form=new ConfigurationForm(nullptr, Qt::WindowTitleHint | Qt::WindowMinMaxButtonsHint | Qt::WindowCloseButtonHint);
 		PgModelerUiNs::resizeDialog(configuration_form);
 		configuration_form->loadConfiguration();
+		finish_phase(QString("Configuration loading"));
 
 		plugins_conf_wgt=dynamic_cast<PluginsConfigWidget *>(configuration_form->getConfigurationWidget(ConfigurationForm::PluginsConfWgt));
 		plugins_conf_wgt->installPluginsActions(plugins_menu, this, SLOT(executePlugin(void)));
@@ -86,6 +98,7 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 		plugins_menu->setEnabled(!plugins_menu->isEmpty());
 		action_plugins->setEnabled(!plugins_menu->isEmpty());
 		action_plugins->setMenu(plugins_menu);
+		finish_phase(QString("Plugins initialization"));
 
 		action_other_actions->setMenu(&more_actions_menu);
 
@@ -166,6 +179,7 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 		overview_wgt=new ModelOverviewWidget;
 		model_valid_wgt=new ModelValidationWidget;
 		obj_finder_wgt=new ObjectFinderWidget;
+		finish_phase(QString("Auxiliary widgets creation"));
 	}
 	catch(Exception &e)
 	{
@@ -246,6 +260,7 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 	connect(action_manage, SIGNAL(toggled(bool)), this, SLOT(changeCurrentView(bool)));
 
 	connect(action_bug_report, SIGNAL(triggered()), this, SLOT(reportBug()));
+	connect(action_stall_monitor, SIGNAL(triggered()), this, SLOT(showStallMonitor()));
 	connect(action_handle_metadata, SIGNAL(triggered(bool)), this, SLOT(handleObjectsMetadata()));
 
 	connect(model_valid_wgt, &ModelValidationWidget::s_connectionsUpdateRequest, [&](){ updateConnections(true); });
@@ -342,6 +357,19 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 
 	connect(&tmpmodel_save_timer, SIGNAL(timeout()), this, SLOT(saveTemporaryModels()));
 
+	tmpmodel_thread=new QThread;
+	tmpmodel_save_helper=new ModelSaveHelper;
+	tmpmodel_save_helper->moveToThread(tmpmodel_thread);
+
+	/* The thread is finished directly by the helper so it can be waited (see closeModel())
+	 * without depending on the main event loop */
+	connect(tmpmodel_thread, SIGNAL(started()), tmpmodel_save_helper, SLOT(saveSnapshots()));
+	connect(tmpmodel_save_helper, SIGNAL(s_savingFinished(int,qint64)), tmpmodel_thread, SLOT(quit()), Qt::DirectConnection);
+	connect(tmpmodel_save_helper, SIGNAL(s_savingAborted(Exception)), tmpmodel_thread, SLOT(quit()), Qt::DirectConnection);
+	connect(tmpmodel_save_helper, SIGNAL(s_progressUpdated(int)), bg_saving_pb, SLOT(setValue(int)), Qt::QueuedConnection);
+	connect(tmpmodel_save_helper, SIGNAL(s_savingFinished(int,qint64)), this, SLOT(finishTemporaryModelsSaving(int,qint64)), Qt::QueuedConnection);
+	connect(tmpmodel_save_helper, SIGNAL(s_savingAborted(Exception)), this, SLOT(abortTemporaryModelsSaving(Exception)), Qt::QueuedConnection);
+
 	models_tbw_parent->resize(QSize(models_tbw_parent->maximumWidth(), models_tbw_parent->height()));
 
 	//Forcing the splitter that handles the bottom widgets to resize its children to their minimum size
@@ -405,9 +433,12 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 			act->setToolTip(act->toolTip() + QString(" (%1)").arg(act->shortcut().toString()));
 	}
 
+	finish_phase(QString("Settings application"));
+
 	try
 	{
 		SQLExecutionWidget::loadSQLHistory();
+		finish_phase(QString("SQL history loading"));
 	}
 	catch(Exception &){}
 
@@ -454,6 +485,34 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 #warning "DEMO VERSION: demonstration version startup alert."
 	QTimer::singleShot(5000, this, SLOT(showDemoVersionWarning()));
 #endif
+
+	finish_phase(QString("Window state restoration"));
+	writeStartupLog(startup_phases);
+}
+
+void MainWindow::writeStartupLog(const vector<pair<QString, qint64>> &phases)
+{
+	QFile log(GlobalAttributes::TemporaryDir + GlobalAttributes::DirSeparator + GlobalAttributes::StartupLogFile);
+	QTextStream out(&log);
+	qint64 total=0;
+
+	//The log holds only the last startup so it's overwritten each time
+	if(!log.open(QFile::WriteOnly | QFile::Truncate | QFile::Text))
+		return;
+
+	out << QString("[%1] pgModeler %2 startup")
+				 .arg(QDateTime::currentDateTime().toString(QString("yyyy-MM-dd hh:mm:ss.zzz")))
+				 .arg(GlobalAttributes::PgModelerVersion) << endl;
+
+	for(auto &phase : phases)
+	{
+		out << QString("  %1 ms : %2").arg(phase.second, 6).arg(phase.first) << endl;
+		total+=phase.second;
+	}
+
+	out << QString("  %1 ms : Total").arg(total, 6) << endl;
+	out.flush();
+	log.close();
 }
 
 MainWindow::~MainWindow(void)
@@ -471,6 +530,10 @@ MainWindow::~MainWindow(void)
 		delete(model);
 	}
 
+	tmpmodel_thread->wait();
+	delete(tmpmodel_thread);
+	delete(tmpmodel_save_helper);
+
 	//This fix the crash on exit at Mac OSX system (but not sure why) (???)
 	file_menu->clear();
 	delete(restoration_form);
@@ -490,35 +553,35 @@ void MainWindow::restoreTemporaryModels(void)
 		if(restoration_form->result()==QDialog::Accepted)
 		{
 			ModelWidget *model=nullptr;
-			QString model_file;
-			QStringList tmp_models=restoration_form->getSelectedModels();
 
-			while(!tmp_models.isEmpty())
+			try
 			{
-				try
+				for(auto &model_file : restoration_form->getSelectedModels())
 				{
-					model_file=tmp_models.front();
-					tmp_models.pop_front();
-					this->addModel(model_file);
+					model=addModelInBackground(model_file);
 
-					//Get the model widget generated from file
-					model=dynamic_cast<ModelWidget *>(models_tbw->widget(models_tbw->count()-1));
-
-					//Set the model as modified forcing the user to save when the autosave timer ends
-					model->setModified(true);
-					model->filename.clear();
-					restoration_form->removeTemporaryModel(model_file);
-				}
-				catch(Exception &e)
-				{
-					//Destroy the temp file if the "keep  models" isn't checked
-					if(!restoration_form->keep_models_chk->isChecked())
+					connect(model, &ModelWidget::s_modelLoaded, [&, model, model_file](){
+						//Set the model as modified forcing the user to save when the autosave timer ends
+						model->setModified(true);
+						model->filename.clear();
 						restoration_form->removeTemporaryModel(model_file);
+					});
 
-					Messagebox msg_box;
-					msg_box.show(e);
+					connect(model, &ModelWidget::s_modelLoadAborted, [&, model_file](Exception e){
+						//Destroy the temp file if the "keep  models" isn't checked
+						if(!restoration_form->keep_models_chk->isChecked())
+							restoration_form->removeTemporaryModel(model_file);
+
+						Messagebox msg_box;
+						msg_box.show(e);
+					});
 				}
 			}
+			catch(Exception &e)
+			{
+				Messagebox msg_box;
+				msg_box.show(e);
+			}
 		}
 	}
 }
@@ -562,26 +625,30 @@ void MainWindow::restoreLastSession(void)
 	if(QApplication::arguments().size() <= 1 &&
 			!prev_session_files.isEmpty() && restoration_form->result()==QDialog::Rejected)
 	{
+		ModelWidget *model=nullptr;
+
 		try
 		{
-			qApp->setOverrideCursor(Qt::WaitCursor);
-
 			while(!prev_session_files.isEmpty())
 			{
-				this->addModel(prev_session_files.front());
+				model=addModelInBackground(prev_session_files.front());
 				prev_session_files.pop_front();
-			}
 
-			action_restore_session->setEnabled(false);
-			central_wgt->last_session_tb->setEnabled(false);
-			qApp->restoreOverrideCursor();
+				connect(model, &ModelWidget::s_modelLoadAborted, [&](Exception e){
+					Messagebox msg_box;
+					msg_box.show(e);
+				});
+			}
 		}
 		catch(Exception &e)
 		{
-			qApp->restoreOverrideCursor();
+			prev_session_files.clear();
 			Messagebox msg_box;
 			msg_box.show(e);
 		}
+
+		action_restore_session->setEnabled(false);
+		central_wgt->last_session_tb->setEnabled(false);
 	}
 }
 
@@ -639,8 +706,8 @@ void MainWindow::resizeEvent(QResizeEvent *)
 
 void MainWindow::closeEvent(QCloseEvent *event)
 {
-	//pgModeler will not close when the validation thread is still running
-	if(model_valid_wgt->isValidationRunning())
+	//pgModeler will not close when the validation thread or the models loading threads are still running
+	if(model_valid_wgt->isValidationRunning() || !loading_models.empty())
 		event->ignore();
 	else
 	{
@@ -652,6 +719,7 @@ void MainWindow::closeEvent(QCloseEvent *event)
 		//Stops the saving timers as well the temp. model saving thread before close pgmodeler
 		model_save_timer.stop();
 		tmpmodel_save_timer.stop();
+		tmpmodel_thread->wait();
 		plugins_menu->clear();
 
 		//If not in demo version there is no confirmation before close the software
@@ -750,8 +818,6 @@ void MainWindow::closeEvent(QCloseEvent *event)
 
 			conf_wgt->saveConfiguration();
 			restoration_form->removeTemporaryFiles();
-
-			SQLExecutionWidget::saveSQLHistory();
 			qApp->quit();
 		}
 	}
@@ -779,42 +845,55 @@ void MainWindow::updateConnections(bool force)
 
 void MainWindow::saveTemporaryModels(void)
 {
+	StallMarker stall_marker(__PRETTY_FUNCTION__);
+
 #ifdef DEMO_VERSION
 #warning "DEMO VERSION: temporary model saving disabled."
 #else
+	//If the previous saving is still running the models will be saved in the next cycle
+	if(tmpmodel_thread->isRunning())
+	{
+		tmpmodel_save_timer.start();
+		return;
+	}
+
 	try
 	{
 		ModelWidget *model=nullptr;
-		int count=models_tbw->count();
+		attribs_map attribs;
+		map<QString, QStringList> obj_defs;
+		QElapsedTimer timer;
+
+		timer.start();
 
-		if(count > 0)
+		for(int i=0; i < models_tbw->count(); i++)
 		{
-			QApplication::setOverrideCursor(Qt::WaitCursor);
-			scene_info_parent->setVisible(false);
-			bg_saving_wgt->setVisible(true);
-			bg_saving_pb->setValue(0);
-			bg_saving_wgt->repaint();
+			model=dynamic_cast<ModelWidget *>(models_tbw->widget(i));
 
-			for(int i=0; i < count; i++)
+			if(model->isModified())
 			{
-				model=dynamic_cast<ModelWidget *>(models_tbw->widget(i));
-				bg_saving_pb->setValue(((i+1)/static_cast<double>(count)) * 100);
-
-				if(model->isModified())
-					model->getDatabaseModel()->saveModel(model->getTempFilename(), SchemaParser::XmlDefinition);
+				model->getDatabaseModel()->getXMLSnapshot(attribs, obj_defs);
+				tmpmodel_save_helper->addSnapshot(model->getTempFilename(), attribs, obj_defs);
 			}
-
-			bg_saving_pb->setValue(100);
-			bg_saving_wgt->setVisible(false);
-			scene_info_parent->setVisible(true);
-			QApplication::restoreOverrideCursor();
 		}
 
-		tmpmodel_save_timer.start();
+		tmpmodel_snapshot_time=timer.elapsed();
+
+		if(tmpmodel_save_helper->hasSnapshots())
+		{
+			scene_info_parent->setVisible(false);
+			bg_saving_lbl->setText(trUtf8("Saving temp. models"));
+			bg_saving_pb->setValue(0);
+			bg_saving_pb->setVisible(true);
+			bg_saving_wgt->setVisible(true);
+			tmpmodel_thread->start();
+		}
+		else
+			tmpmodel_save_timer.start();
 	}
 	catch(Exception &e)
 	{
-		QApplication::restoreOverrideCursor();
+		tmpmodel_save_helper->clearSnapshots();
 		Messagebox msg_box;
 		msg_box.show(e);
 		tmpmodel_save_timer.start();
@@ -822,6 +901,36 @@ void MainWindow::saveTemporaryModels(void)
 #endif
 }
 
+void MainWindow::finishTemporaryModelsSaving(int count, qint64 elapsed)
+{
+	tmpmodel_thread->wait();
+	bg_saving_pb->setVisible(false);
+	bg_saving_lbl->setText(trUtf8("Temp. models saved: %1 (snapshot: %2 ms, writing: %3 ms)")
+												 .arg(count).arg(tmpmodel_snapshot_time).arg(elapsed));
+
+	//Keeps the saving report visible for a few seconds before showing the scene info again
+	QTimer::singleShot(3000, this, [&](){
+		if(!tmpmodel_thread->isRunning())
+		{
+			bg_saving_wgt->setVisible(false);
+			scene_info_parent->setVisible(true);
+		}
+	});
+
+	tmpmodel_save_timer.start();
+}
+
+void MainWindow::abortTemporaryModelsSaving(Exception e)
+{
+	tmpmodel_thread->wait();
+	bg_saving_wgt->setVisible(false);
+	scene_info_parent->setVisible(true);
+
+	Messagebox msg_box;
+	msg_box.show(e);
+	tmpmodel_save_timer.start();
+}
+
 void MainWindow::updateRecentModelsMenu(void)
 {
 	QAction *act=nullptr;
@@ -855,22 +964,31 @@ void MainWindow::loadModelFromAction(void)
 	if(act)
 	{
 		QString filename=act->data().toString();
+		ModelWidget *model=nullptr;
 
 		try
 		{
-			qApp->setOverrideCursor(Qt::WaitCursor);
-			addModel(filename);
-			recent_models.push_back(act->data().toString());
-			updateRecentModelsMenu();
-			qApp->restoreOverrideCursor();
+			model=addModelInBackground(filename);
+
+			connect(model, &ModelWidget::s_modelLoaded, [&, filename](){
+				recent_models.push_back(filename);
+				updateRecentModelsMenu();
+			});
+
+			connect(model, &ModelWidget::s_modelLoadAborted, [&, filename](Exception e){
+				if(QFileInfo(filename).exists())
+					showFixMessage(e, filename);
+				else
+				{
+					Messagebox msg_box;
+					msg_box.show(e);
+				}
+			});
 		}
 		catch(Exception &e)
 		{
-			qApp->restoreOverrideCursor();
-			if(QFileInfo(filename).exists())
-				showFixMessage(e, filename);
-			else
-				throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			Messagebox msg_box;
+			msg_box.show(e);
 		}
 	}
 }
@@ -885,7 +1003,7 @@ void MainWindow::addModel(const QString &filename)
 {
 #ifdef DEMO_VERSION
 #warning "DEMO VERSION: database model creation limit."
-	if(models_tbw->count()==1)
+	if(models_tbw->count()==1 || !loading_models.empty())
 		throw Exception(trUtf8("The demonstration version can create only `one' instance of database model!"),
 										ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 #endif
@@ -978,6 +1096,83 @@ void MainWindow::addModel(const QString &filename)
 	}
 }
 
+ModelWidget *MainWindow::addModelInBackground(const QString &filename)
+{
+#ifdef DEMO_VERSION
+	//The models still being loaded are counted too since their tabs are only added when the loading finishes
+	if(models_tbw->count() > 0 || !loading_models.empty())
+		throw Exception(trUtf8("The demonstration version can create only `one' instance of database model!"),
+										ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+#endif
+
+	ModelWidget *model_tab=new ModelWidget;
+
+	model_tab->db_model->createSystemObjects(false);
+
+	//Indicating that there are models being loaded without blocking the user interaction
+	if(loading_models.empty())
+		qApp->setOverrideCursor(Qt::BusyCursor);
+
+	loading_models.push_back(model_tab);
+
+	connect(model_tab, &ModelWidget::s_modelLoaded, [&, model_tab, filename](){
+		Schema *public_sch=nullptr;
+		bool start_timers=(models_tbw->count() == 0);
+
+		loading_models.erase(std::find(loading_models.begin(), loading_models.end(), model_tab));
+
+		if(loading_models.empty())
+			qApp->restoreOverrideCursor();
+
+		//Get the "public" schema and set as system object
+		public_sch=dynamic_cast<Schema *>(model_tab->db_model->getObject(QString("public"), ObjectType::Schema));
+		if(public_sch)	public_sch->setSystemObject(true);
+
+		model_tab->db_model->setInvalidated(false);
+		model_tab->setObjectName(QString("model_%1").arg(models_tbw->count()));
+
+		//Making a copy of the loaded database model file as the first version of the temp. model
+		QFile::copy(filename, model_tab->getTempFilename());
+
+		try
+		{
+			addModel(model_tab);
+			models_tbw->setTabToolTip(models_tbw->indexOf(model_tab), filename);
+			model_tab->restoreLastCanvasPosition();
+
+			if(start_timers)
+			{
+				if(model_save_timer.interval() > 0)
+					model_save_timer.start();
+
+				tmpmodel_save_timer.start();
+			}
+
+			model_tab->setModified(false);
+			action_save_model->setEnabled(false);
+		}
+		catch(Exception &e)
+		{
+			Messagebox msg_box;
+			msg_box.show(e);
+		}
+	});
+
+	connect(model_tab, &ModelWidget::s_modelLoadAborted, [&, model_tab](Exception){
+		loading_models.erase(std::find(loading_models.begin(), loading_models.end(), model_tab));
+
+		if(loading_models.empty())
+			qApp->restoreOverrideCursor();
+
+		//Destroy the temp file generated by allocating a new model widget
+		restoration_form->removeTemporaryModel(model_tab->getTempFilename());
+		model_tab->deleteLater();
+	});
+
+	model_tab->loadModelInBackground(filename);
+	return(model_tab);
+}
+
 void MainWindow::addModel(ModelWidget *model_wgt)
 {
 	try
@@ -1047,13 +1242,9 @@ void MainWindow::setCurrentModel(void)
 	edit_menu->addAction(action_redo);
 	edit_menu->addSeparator();
 
-	//Avoids the tree state saving in order to restore the current model tree state
+	//Avoids the tree state saving since the tree of the new current model is stored by the objects widget itself
 	model_objs_wgt->saveTreeState(false);
 
-	//Restore the tree state
-	if(current_model)
-		model_objs_wgt->saveTreeState(model_tree_states[current_model]);
-
 	models_tbw->setCurrentIndex(model_nav_wgt->getCurrentIndex());
 	current_model=dynamic_cast<ModelWidget *>(models_tbw->currentWidget());
 	action_arrange_objects->setEnabled(current_model != nullptr);
@@ -1092,6 +1283,7 @@ void MainWindow::setCurrentModel(void)
 		more_actions_menu.addAction(current_model->action_fade);
 		more_actions_menu.addAction(current_model->action_collapse_mode);
 		more_actions_menu.addAction(current_model->action_edit_creation_order);
+		more_actions_menu.addAction(current_model->action_memory_usage);
 		general_tb->addAction(action_other_actions);
 		tool_btn = qobject_cast<QToolButton *>(general_tb->widgetForAction(action_other_actions));
 		tool_btn->setPopupMode(QToolButton::InstantPopup);
@@ -1156,14 +1348,12 @@ void MainWindow::setCurrentModel(void)
 
 	updateToolsState();
 
+	/* The dock widgets keep the state of each model they've already shown so
+	 * switching between models swaps the stored states instead of rebuilding them */
 	oper_list_wgt->setModel(current_model);
 	model_objs_wgt->setModel(current_model);
 	model_valid_wgt->setModel(current_model);
 	obj_finder_wgt->setModel(current_model);
-
-	if(current_model)
-		model_objs_wgt->restoreTreeState(model_tree_states[current_model]);
-
 	model_objs_wgt->saveTreeState(true);
 
 	emit s_currentModelChanged(current_model);
@@ -1263,7 +1453,9 @@ void MainWindow::closeModel(int model_id)
 		{
 			QApplication::setOverrideCursor(Qt::WaitCursor);
 			model_nav_wgt->removeModel(model_id);
-			model_tree_states.erase(model);
+			oper_list_wgt->removeOperationsState(model);
+			model_objs_wgt->removeViewState(model);
+			obj_finder_wgt->removeSearchState(model);
 
 			disconnect(tab, nullptr, oper_list_wgt, nullptr);
 			disconnect(tab, nullptr, model_objs_wgt, nullptr);
@@ -1272,8 +1464,10 @@ void MainWindow::closeModel(int model_id)
 			disconnect(action_show_grid, nullptr, this, nullptr);
 			disconnect(action_show_delimiters, nullptr, this, nullptr);
 
-			//Remove the temporary file related to the closed model
+			/* Remove the temporary file related to the closed model. If the temporary models are being
+			 * saved we wait the writing to finish otherwise the file could be recreated after the removal */
 			QDir arq_tmp;
+			tmpmodel_thread->wait();
 			arq_tmp.remove(model->getTempFilename());
 
 			//Removing model specific actions from general toolbar
@@ -1577,12 +1771,15 @@ void MainWindow::printModel(void)
 		QPrinter *printer=nullptr;
 		QPrinter::PageSize paper_size, curr_paper_size;
 		QPrinter::Orientation orientation, curr_orientation;
-		QRectF margins;
+		QRectF margins, pg_margins;
 		QSizeF custom_size;
 		qreal ml,mt,mr,mb, ml1, mt1, mr1, mb1;
+		unsigned h_page_cnt=0, v_page_cnt=0;
+		int page_cnt=0;
 		GeneralConfigWidget *conf_wgt=dynamic_cast<GeneralConfigWidget *>(configuration_form->getConfigurationWidget(ConfigurationForm::GeneralConfWgt));
 
 		print_dlg.setOption(QAbstractPrintDialog::PrintCurrentPage, false);
+		print_dlg.setOption(QAbstractPrintDialog::PrintPageRange, true);
 		print_dlg.setWindowTitle(trUtf8("Database model printing"));
 
 		//Get the page configuration of the scene
@@ -1594,6 +1791,10 @@ void MainWindow::printModel(void)
 		//Sets the printer options based upon the configurations from the scene
 		ObjectsScene::configurePrinter(printer);
 
+		//Limiting the page range to the amount of pages of the model
+		page_cnt=ModelPrintHelper::getPagesForPrinting(current_model->getObjectsScene(), printer, pg_margins, h_page_cnt, v_page_cnt).size();
+		print_dlg.setMinMax(1, std::max(1, page_cnt));
+
 		printer->getPageMargins(&mt,&ml,&mb,&mr,QPrinter::Millimeter);
 
 		print_dlg.exec();
@@ -1620,7 +1821,14 @@ void MainWindow::printModel(void)
 				if(msg_box.result()==QDialog::Rejected)
 					ObjectsScene::configurePrinter(printer);
 
-				current_model->printModel(printer, conf_wgt->print_grid_chk->isChecked(), conf_wgt->print_pg_num_chk->isChecked());
+				try
+				{
+					current_model->printModel(printer, conf_wgt->print_grid_chk->isChecked(), conf_wgt->print_pg_num_chk->isChecked());
+				}
+				catch(Exception &e)
+				{
+					msg_box.show(e);
+				}
 			}
 		}
 	}
@@ -1655,25 +1863,30 @@ void MainWindow::loadModel(const QString &filename)
 
 void MainWindow::loadModels(const QStringList &list)
 {
-	int i=0;
+	ModelWidget *model=nullptr;
 
+	/* Each model is loaded in its own thread and has its tab created as soon as it is ready,
+	 * so a slow or broken file doesn't prevent the others from being opened */
 	try
 	{
-		qApp->setOverrideCursor(Qt::WaitCursor);
-
-		for(i=0; i < list.count(); i++)
+		for(auto &filename : list)
 		{
-			addModel(list[i]);
-			recent_models.push_front(list[i]);
-		}
+			model=addModelInBackground(filename);
+
+			connect(model, &ModelWidget::s_modelLoaded, [&, filename](){
+				recent_models.push_front(filename);
+				updateRecentModelsMenu();
+			});
 
-		updateRecentModelsMenu();		
-		qApp->restoreOverrideCursor();
+			connect(model, &ModelWidget::s_modelLoadAborted, [&, filename](Exception e){
+				showFixMessage(e, filename);
+			});
+		}
 	}
 	catch(Exception &e)
 	{
-		qApp->restoreOverrideCursor();
-		showFixMessage(e, list[i]);
+		Messagebox msg_box;
+		msg_box.show(e);
 	}
 }
 
@@ -1739,6 +1952,8 @@ void MainWindow::updateToolsState(bool model_closed)
 
 void MainWindow::updateDockWidgets(void)
 {
+	StallMarker stall_marker(__PRETTY_FUNCTION__);
+
 	oper_list_wgt->updateOperationList();
 	model_objs_wgt->updateObjectsView();
 
@@ -2018,6 +2233,19 @@ void MainWindow::reportBug(void)
 	GeneralConfigWidget::saveWidgetGeometry(&bugrep_frm);
 }
 
+void MainWindow::showStallMonitor(void)
+{
+	BaseForm parent_form(this);
+	StallMonitorWidget *stall_mon_wgt=new StallMonitorWidget;
+
+	stall_mon_wgt->setWatchdog(&stall_watchdog);
+	parent_form.setMainWidget(stall_mon_wgt);
+
+	GeneralConfigWidget::restoreWidgetGeometry(&parent_form, stall_mon_wgt->metaObject()->className());
+	parent_form.exec();
+	GeneralConfigWidget::saveWidgetGeometry(&parent_form, stall_mon_wgt->metaObject()->className());
+}
+
 void MainWindow::removeOperations(void)
 {
 	//Clears the operation list everytime a fix is applied to the model
@@ -51,6 +51,9 @@
 #include "donatewidget.h"
 #include "sceneinfowidget.h"
 #include "layerswidget.h"
+#include "stallwatchdog.h"
+#include "modelsavehelper.h"
+#include "modelprinthelper.h"
 
 class MainWindow: public QMainWindow, public Ui::MainWindow {
 	private:
@@ -77,6 +80,18 @@ class MainWindow: public QMainWindow, public Ui::MainWindow {
 		//! \brief Timer used for auto saving the model and temporary model.
 		QTimer model_save_timer,	tmpmodel_save_timer;
 
+		//! \brief Thread that writes the temporary models snapshots (see saveTemporaryModels())
+		QThread *tmpmodel_thread;
+
+		//! \brief Helper that assembles and writes the temporary models snapshots in the tmpmodel_thread
+		ModelSaveHelper *tmpmodel_save_helper;
+
+		//! \brief Time spent (in ms) taking the snapshots of the temporary models in the last autosave
+		qint64 tmpmodel_snapshot_time;
+
+		//! \brief Opt-in monitor of the event loop stalls (see StallMonitorWidget)
+		StallWatchdog stall_watchdog;
+
 		AboutWidget *about_wgt;
 
 		DonateWidget *donate_wgt;
@@ -123,8 +138,8 @@ class MainWindow: public QMainWindow, public Ui::MainWindow {
 		//! \brief Stores the currently focused model
 		ModelWidget *current_model;
 
-		//! \brief Stores the model objects tree state for each opened model
-		map<ModelWidget *, vector<BaseObject *> > model_tree_states;
+		//! \brief Stores the models being loaded in background (see addModelInBackground())
+		vector<ModelWidget *> loading_models;
 
 		//! \brief Stores the defaul window title
 		QString window_title;
@@ -163,9 +178,18 @@ class MainWindow: public QMainWindow, public Ui::MainWindow {
 		//! \brief Restore the dock widget configurations from the parameters loaded from main configuration file
 		void restoreDockWidgetsSettings(void);
 
+		//! \brief Writes the time spent in each phase of the main window creation to the startup log (see GlobalAttributes::StartupLogFile)
+		void writeStartupLog(const vector<pair<QString, qint64>> &phases);
+
 		//! \brief Shows a error dialog informing that the model demands a fix after the error ocurred when loading the filename.
 		void showFixMessage(Exception &e, const QString &filename);
 
+		/*! \brief Loads the model file in background, adding its tab only when the model is ready. Several models can be
+		 * loaded concurrently this way. The returned widget emits ModelWidget::s_modelLoaded() or ModelWidget::s_modelLoadAborted()
+		 * so the caller can do additional operations when the loading finishes. In case of errors the widget is destroyed
+		 * right after the emission of the latter signal */
+		ModelWidget *addModelInBackground(const QString &filename);
+
 		/*! \brief This method determines if the provided layout has togglable buttons and one of them are checked.
 		 * This is an auxiliary method used to determine if widget bars (bottom or right) can be displayed based upon
 		 * the current button toggle state. */
@@ -277,9 +301,16 @@ class MainWindow: public QMainWindow, public Ui::MainWindow {
 		//! \brief Updates the connections list of the validator widget
 		void updateConnections(bool force = false);
 
-		//! \brief Save the temp files for all opened models
+		/*! \brief Save the temp files for all opened models. Only the snapshots of the models are taken in the main thread,
+		 * the code assembling and the writing of the files are done in background by the tmpmodel_thread */
 		void saveTemporaryModels(void);
 
+		//! \brief Reports the time spent in the last temporary models saving and restarts the saving timer
+		void finishTemporaryModelsSaving(int count, qint64 elapsed);
+
+		//! \brief Shows the error raised when saving the temporary models and restarts the saving timer
+		void abortTemporaryModelsSaving(Exception e);
+
 		//! \brief Opens the pgModeler Wiki in a web browser window
 		void openSupport(void);
 
@@ -301,6 +332,7 @@ class MainWindow: public QMainWindow, public Ui::MainWindow {
 		void showDemoVersionWarning(void);
 		void changeCurrentView(bool checked);
 		void reportBug(void);
+		void showStallMonitor(void);
 		void removeOperations(void);
 		void handleObjectsMetadata(void);
 		void restoreTemporaryModels(void);
@@ -0,0 +1,185 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "memoryusagewidget.h"
+#include "pgmodeleruins.h"
+
+MemoryUsageWidget::MemoryUsageWidget(QWidget *parent) : QWidget(parent)
+{
+	setupUi(this);
+	model_wgt=nullptr;
+
+	usage_trw->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+	usage_trw->header()->setSectionResizeMode(1, QHeaderView::ResizeToContents);
+	usage_trw->header()->setSectionResizeMode(2, QHeaderView::ResizeToContents);
+
+	connect(refresh_tb, SIGNAL(clicked(bool)), this, SLOT(updateMemoryUsage()));
+}
+
+void MemoryUsageWidget::setModelWidget(ModelWidget *model_wgt)
+{
+	this->model_wgt=model_wgt;
+	refresh_tb->setEnabled(model_wgt != nullptr);
+	updateMemoryUsage();
+}
+
+QString MemoryUsageWidget::getSubsystemName(unsigned subsystem)
+{
+	static const QStringList names={ trUtf8("Model objects"), trUtf8("Cached code"), trUtf8("Parser buffers"),
+																	 trUtf8("Undo history"), trUtf8("Scene items") };
+
+	if(subsystem >= SubsystemCount)
+		return(QString());
+
+	return(names[subsystem]);
+}
+
+size_t MemoryUsageWidget::getMemoryUsage(DatabaseModel *model, ObjectsScene *scene, OperationList *op_list, vector<map<ObjectType, pair<unsigned, size_t>>> &usage)
+{
+	map<ObjectType, unsigned> obj_count, item_count;
+	map<ObjectType, vector<size_t>> obj_usage;
+	map<ObjectType, size_t> items_usage;
+	unsigned subsys_cats[]={ BaseObject::MemObjectData, BaseObject::MemCachedCode, BaseObject::MemParserBuffers };
+	size_t total=0;
+
+	usage.clear();
+	usage.resize(SubsystemCount);
+
+	if(!model)
+		return(0);
+
+	total=model->getMemoryUsage(obj_count, obj_usage);
+
+	for(auto &itr : obj_usage)
+	{
+		for(unsigned subsys=ModelObjects; subsys <= ParserBuffers; subsys++)
+			usage[subsys][itr.first]=std::make_pair(obj_count[itr.first], itr.second[subsys_cats[subsys]]);
+	}
+
+	if(op_list)
+	{
+		size_t size=op_list->getMemoryUsage();
+		usage[UndoHistory][ObjectType::BaseObject]=std::make_pair(op_list->getCurrentSize(), size);
+		total+=size;
+	}
+
+	if(scene)
+	{
+		total+=scene->getItemsMemoryUsage(item_count, items_usage);
+
+		for(auto &itr : items_usage)
+			usage[SceneItems][itr.first]=std::make_pair(item_count[itr.first], itr.second);
+	}
+
+	return(total);
+}
+
+QString MemoryUsageWidget::getMemoryUsageReport(DatabaseModel *model, ObjectsScene *scene, OperationList *op_list)
+{
+	vector<map<ObjectType, pair<unsigned, size_t>>> usage;
+	QString report;
+	QTextStream out(&report);
+	size_t total=0, subsys_total=0;
+	unsigned subsys_count=0;
+
+	total=getMemoryUsage(model, scene, op_list, usage);
+
+	for(unsigned subsys=0; subsys < SubsystemCount; subsys++)
+	{
+		subsys_total=subsys_count=0;
+
+		for(auto &itr : usage[subsys])
+		{
+			subsys_count+=itr.second.first;
+			subsys_total+=itr.second.second;
+		}
+
+		out << QString("%1 (%2): %3").arg(getSubsystemName(subsys)).arg(subsys_count).arg(MemoryUsage::formatSize(subsys_total)) << endl;
+
+		for(auto &itr : usage[subsys])
+		{
+			if(itr.second.second == 0)
+				continue;
+
+			out << QString("  %1 (%2): %3")
+						 .arg(itr.first == ObjectType::BaseObject ? trUtf8("Other") : BaseObject::getTypeName(itr.first))
+						 .arg(itr.second.first)
+						 .arg(MemoryUsage::formatSize(itr.second.second)) << endl;
+		}
+	}
+
+	out << trUtf8("Estimated total: %1").arg(MemoryUsage::formatSize(total)) << endl;
+	out.flush();
+
+	return(report);
+}
+
+void MemoryUsageWidget::updateMemoryUsage(void)
+{
+	vector<map<ObjectType, pair<unsigned, size_t>>> usage;
+	QTreeWidgetItem *subsys_item=nullptr, *item=nullptr;
+	size_t total=0, subsys_total=0;
+	unsigned subsys_count=0;
+
+	usage_trw->clear();
+	total_lbl->setText(trUtf8("Estimated total: <strong>-</strong>"));
+
+	if(!model_wgt)
+		return;
+
+	QApplication::setOverrideCursor(Qt::WaitCursor);
+	total=getMemoryUsage(model_wgt->getDatabaseModel(), model_wgt->getObjectsScene(), model_wgt->getOperationList(), usage);
+
+	for(unsigned subsys=0; subsys < SubsystemCount; subsys++)
+	{
+		subsys_total=subsys_count=0;
+		subsys_item=new QTreeWidgetItem(usage_trw);
+		subsys_item->setText(0, getSubsystemName(subsys));
+
+		for(auto &itr : usage[subsys])
+		{
+			subsys_count+=itr.second.first;
+			subsys_total+=itr.second.second;
+
+			if(itr.second.second == 0)
+				continue;
+
+			item=new QTreeWidgetItem(subsys_item);
+			item->setText(0, itr.first == ObjectType::BaseObject ? trUtf8("Other") : BaseObject::getTypeName(itr.first));
+			item->setText(1, QString::number(itr.second.first));
+			item->setText(2, MemoryUsage::formatSize(itr.second.second));
+			item->setData(2, Qt::UserRole, QVariant::fromValue<qulonglong>(itr.second.second));
+
+			if(itr.first != ObjectType::BaseObject)
+				item->setIcon(0, QPixmap(PgModelerUiNs::getIconPath(itr.first)));
+		}
+
+		subsys_item->setText(1, QString::number(subsys_count));
+		subsys_item->setText(2, MemoryUsage::formatSize(subsys_total));
+
+		//Sorting the object types by the amount of memory used (bigger first)
+		QList<QTreeWidgetItem *> children=subsys_item->takeChildren();
+		std::sort(children.begin(), children.end(), [](QTreeWidgetItem *item1, QTreeWidgetItem *item2){
+			return(item1->data(2, Qt::UserRole).toULongLong() > item2->data(2, Qt::UserRole).toULongLong());
+		});
+		subsys_item->addChildren(children);
+	}
+
+	total_lbl->setText(trUtf8("Estimated total: <strong>%1</strong>").arg(MemoryUsage::formatSize(total)));
+	QApplication::restoreOverrideCursor();
+}
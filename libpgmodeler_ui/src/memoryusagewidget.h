@@ -0,0 +1,69 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class MemoryUsageWidget
+\brief Implements the panel that displays the estimated memory footprint of a model per subsystem and object type.
+*/
+
+#ifndef MEMORY_USAGE_WIDGET_H
+#define MEMORY_USAGE_WIDGET_H
+
+#include <QWidget>
+#include "ui_memoryusagewidget.h"
+#include "modelwidget.h"
+
+class MemoryUsageWidget: public QWidget, public Ui::MemoryUsageWidget {
+	private:
+		Q_OBJECT
+
+		//! \brief The model widget which memory usage is being displayed
+		ModelWidget *model_wgt;
+
+	public:
+		//! \brief Subsystems in which the memory usage is grouped
+		static constexpr unsigned ModelObjects=0,
+		CachedCode=1,
+		ParserBuffers=2,
+		UndoHistory=3,
+		SceneItems=4,
+		SubsystemCount=5;
+
+		MemoryUsageWidget(QWidget *parent = nullptr);
+
+		void setModelWidget(ModelWidget *model_wgt);
+
+		//! \brief Returns the translated name of the provided subsystem
+		static QString getSubsystemName(unsigned subsystem);
+
+		/*! \brief Collects the estimated memory usage of the provided model, scene and operation list (the two latter are optional).
+		 * Each element of the usage vector represents a subsystem and stores, per object type, the amount of items and the estimated bytes.
+		 * The returned value is the total of bytes of all subsystems */
+		static size_t getMemoryUsage(DatabaseModel *model, ObjectsScene *scene, OperationList *op_list,
+																 vector<map<ObjectType, pair<unsigned, size_t>>> &usage);
+
+		//! \brief Returns the memory usage of the provided model, scene and operation list as a plain text report
+		static QString getMemoryUsageReport(DatabaseModel *model, ObjectsScene *scene, OperationList *op_list);
+
+	public slots:
+		//! \brief Recalculates the memory usage of the current model and updates the panel
+		void updateMemoryUsage(void);
+};
+
+#endif
@@ -531,6 +531,10 @@ void ModelDatabaseDiffForm::importDatabase(unsigned thread_id)
 			import_item=PgModelerUiNs::createOutputTreeItem(output_trw, step_lbl->text(), *step_ico_lbl->pixmap(), nullptr);
 
 		pgsql_ver=conn.getPgSQLVersion(true);
+
+		//The diff must reflect the current state of the database so the catalog bypasses the results cache and the server's cached results are discarded
+		Catalog::invalidateResultsCache(conn);
+		catalog.setBypassResultsCache(true);
 		catalog.setConnection(conn);
 
 		//The import process will exclude built-in array array types, system and extension objects
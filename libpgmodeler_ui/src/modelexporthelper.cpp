@@ -1,5 +1,6 @@
 #include "modelexporthelper.h"
-#include <QSvgGenerator>
+#include "svgstreamdevice.h"
+#include "catalog.h"
 
 ModelExportHelper::ModelExportHelper(QObject *parent) : QObject(parent)
 {
@@ -248,66 +249,125 @@ void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename
 		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	bool shw_dlm=false, shw_grd=false, align_objs=false;
-	QSvgGenerator svg_gen;
 	QRectF scene_rect=scene->itemsBoundingRect(true);
-	QFileInfo fi(filename);
+	QList<QGraphicsItem *> items;
+	QGraphicsItem *top_item=nullptr, *curr_top_item=nullptr;
+	BaseObjectView *obj_view=nullptr;
+	BaseObject *object=nullptr;
+	QStyleOptionGraphicsItem option;
+	QTransform offset;
+	QPainter painter;
+	QString group_id;
+	map<QString, unsigned> group_ids;
+	int item_idx=0, progress=0, prev_progress=-1;
+	SvgStreamDevice svg_dev(filename, scene_rect.size().toSize(),
+													trUtf8("SVG representation of database model"),
+													trUtf8("SVG file generated by pgModeler"));
 
 	//Making a backup of the current scene options
 	shw_grd = ObjectsScene::isShowGrid();
 	shw_dlm = ObjectsScene::isShowPageDelimiters();
 	align_objs = ObjectsScene::isAlignObjectsToGrid();
-	scene->setBackgroundBrush(Qt::NoBrush);
 
-	//Disabling grid and delimiters
 	ObjectsScene::setGridOptions(show_grid, false, show_delim);
 	scene->update();
 
 	emit s_progressUpdated(0, trUtf8("Exporting model to SVG file."));
 
-	svg_gen.setFileName(filename);
-	svg_gen.setTitle(trUtf8("SVG representation of database model"));
-	svg_gen.setDescription(trUtf8("SVG file generated by pgModeler"));
+	if(!painter.begin(&svg_dev))
+	{
+		ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
+		scene->update();
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
 
-	QPainter *painter=new QPainter(&svg_gen);
-	scene->render(painter, QRectF(0, 0, scene_rect.size().width(), scene_rect.size().height()), scene_rect);
-	delete(painter);
+	offset.translate(-scene_rect.left(), -scene_rect.top());
 
-	//Restoring the scene settings
-	ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
-	scene->update();
+	//Forcing the usage of the font settings defined for BaseObjectView and its subclasses
+	svg_dev.setFontFamilyReplacement(scene->font().family(), BaseObjectView::getFontStyle(Attributes::Global).font().family());
 
-	if(!fi.exists() || !fi.isWritable() || !fi.isReadable())
-			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
-											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	//The background (grid and page delimiters) is written only when one of them is displayed
+	if(show_grid || show_delim)
+	{
+		painter.setTransform(offset);
+		painter.setPen(Qt::NoPen);
+		painter.setBrush(scene->backgroundBrush());
+		painter.drawRect(scene_rect);
+	}
 
-	QFile svg_file;
-	svg_file.setFileName(filename);
-	svg_file.open(QFile::ReadOnly);
+	/* Instead of rendering the whole scene in one pass each item is painted in the stacking order
+	 * and the items of the same object are grouped in an element identified by the object's type and id
+	 * (e.g. <g id="table_1234" class="table">) so they can be addressed in the resulting file */
+	items=scene->items(scene_rect, Qt::IntersectsItemBoundingRect, Qt::AscendingOrder);
+	option.state=QStyle::State_None;
 
-	if(svg_file.isOpen())
+	for(auto &item : items)
 	{
-		QByteArray buf;
-		QString svg_def, font_attr=QString("font-family=\"%1\"");
+		item_idx++;
 
-		svg_def.append(svg_file.readAll());
-		svg_file.close();
+		if(!item->isVisible())
+			continue;
 
-		//Forcing the usage of the font settings defined for BaseObjectView and its subclasses
-		svg_def.replace(font_attr.arg(scene->font().family()),
-										font_attr.arg(BaseObjectView::getFontStyle(Attributes::Global).font().family()));
+		top_item=item->topLevelItem();
 
-		/* Removing the empty (transparent) backgound object in order to save some space in the file if
-		the grid or delimiter is displayed */
-		if(!show_delim && !show_grid)
-			svg_def.replace(QRegExp("(<image)(.)*(xlink:href)(=)(\")(\\w|=|/|\\+|:|;|,|\n)+(\")( )+(/>)"), QString());
+		if(top_item != curr_top_item)
+		{
+			if(curr_top_item)
+				svg_dev.endGroup();
+
+			curr_top_item=top_item;
+			obj_view=dynamic_cast<BaseObjectView *>(top_item);
+			object=(obj_view ? obj_view->getUnderlyingObject() : nullptr);
+
+			if(object)
+			{
+				//If the items of an object are not contiguous a new group with a suffixed id is created
+				group_id=QString("%1_%2").arg(object->getSchemaName()).arg(object->getObjectId());
 
-		buf.append(svg_def);
+				if(group_ids[group_id]++ > 0)
+					group_id+=QString("_%1").arg(group_ids[group_id]);
 
-		svg_file.open(QFile::WriteOnly | QFile::Truncate);
-		svg_file.write(buf);
-		svg_file.close();
+				svg_dev.beginGroup(group_id, object->getSchemaName(), object->getSignature(false));
+			}
+			else
+				svg_dev.beginGroup(QString(), QString(), QString());
+		}
+
+		/* Since the items are painted individually the clipping done by the parents (e.g. the columns of
+		 * tables clipped by the body's shape) is applied by configuring the clip path of the item's elements */
+		svg_dev.setClipPath(item->isClipped() ? (item->sceneTransform() * offset).map(item->clipPath()) : QPainterPath());
+
+		painter.setTransform(item->sceneTransform() * offset);
+		painter.setOpacity(item->effectiveOpacity());
+		painter.setPen(QPen());
+		painter.setBrush(Qt::NoBrush);
+		option.exposedRect=item->boundingRect();
+		option.rect=option.exposedRect.toRect();
+		item->paint(&painter, &option, nullptr);
+
+		progress=(item_idx/static_cast<double>(items.size())) * 90;
+
+		if(progress != prev_progress)
+		{
+			emit s_progressUpdated(progress, trUtf8("Exporting model to SVG file."));
+			prev_progress=progress;
+		}
 	}
 
+	if(curr_top_item)
+		svg_dev.endGroup();
+
+	painter.end();
+
+	//Restoring the scene settings
+	ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
+	scene->update();
+
+	if(svg_dev.hasError())
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
 	emit s_progressUpdated(100, trUtf8("Output file `%1' successfully written.").arg(filename), ObjectType::BaseObject);
 	emit s_exportFinished();
 }
@@ -515,7 +575,9 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 			emit s_progressUpdated(progress, trUtf8("Generating SQL for `%1' objects...").arg(db_model->getObjectCount()));
 
 			//Exporting the database model definition using the opened connection
+			saveInitialDataFormats(db_model);
 			buf=db_model->getCodeDefinition(SchemaParser::SqlDefinition, false);
+			restoreInitialDataFormats();
 			progress=40;
 			exportBufferToDBMS(buf, new_db_conn, drop_objs);
 		}
@@ -535,6 +597,9 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 
 		conn.close();
 
+		//The catalog results cached for the server are discarded since its databases were changed
+		Catalog::invalidateResultsCache(conn);
+
 		if(!export_canceled)
 			emit s_exportFinished();
 		else
@@ -543,6 +608,7 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 	catch(Exception &e)
 	{
 		disconnect(db_model, nullptr, this, nullptr);
+		restoreInitialDataFormats();
 
 		if(ignore_dup)
 			restoreGenAtlerCmdsStatus();
@@ -558,6 +624,7 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 		catch(Exception &){}
 
 		conn.close();
+		Catalog::invalidateResultsCache(conn);
 
 		/* When running in a separated thread (other than the main application thread)
 	redirects the error in form of signal */
@@ -657,6 +724,39 @@ void ModelExportHelper::restoreGenAtlerCmdsStatus(void)
 	alter_cmds_status.clear();
 }
 
+void ModelExportHelper::saveInitialDataFormats(DatabaseModel *db_model)
+{
+	vector<BaseObject *> objects;
+	PhysicalTable *tab=nullptr;
+
+	objects.insert(objects.end(), db_model->getObjectList(ObjectType::Table)->begin(),
+								 db_model->getObjectList(ObjectType::Table)->end());
+
+	objects.insert(objects.end(), db_model->getObjectList(ObjectType::ForeignTable)->begin(),
+								 db_model->getObjectList(ObjectType::ForeignTable)->end());
+
+	data_formats.clear();
+
+	for(auto &obj : objects)
+	{
+		tab=dynamic_cast<PhysicalTable *>(obj);
+
+		if(tab->getInitialDataFormat()!=PhysicalTable::InsertDataFormat)
+		{
+			data_formats[tab]=tab->getInitialDataFormat();
+			tab->setInitialDataFormat(PhysicalTable::InsertDataFormat);
+		}
+	}
+}
+
+void ModelExportHelper::restoreInitialDataFormats(void)
+{
+	for(auto &itr : data_formats)
+		itr.first->setInitialDataFormat(itr.second);
+
+	data_formats.clear();
+}
+
 void ModelExportHelper::undoDBMSExport(DatabaseModel *db_model, Connection &conn, bool use_tmp_names)
 {
 	QString drop_cmd=QString("DROP %1 %2;");
@@ -1147,6 +1247,9 @@ void ModelExportHelper::exportToDBMS(void)
 			{
 				abortExport(e);
 			}
+
+			//The catalog results cached for the server are discarded since its databases were changed
+			Catalog::invalidateResultsCache(*connection);
 		}
 		resetExportParams();
 	}
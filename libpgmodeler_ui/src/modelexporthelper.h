@@ -85,6 +85,9 @@ class ModelExportHelper: public QObject {
 		//! \brief Stores the current state of ALTER command generation for table columns/constraints
 		map<PhysicalTable *, bool> alter_cmds_status;
 
+		//! \brief Stores the initial data format of the tables which data is generated as COPY commands
+		map<PhysicalTable *, unsigned> data_formats;
+
 		//! \brief Stores the original object names before the call of generateRandomObjectNames()
 		map<BaseObject *, QString> orig_obj_names;
 
@@ -104,6 +107,13 @@ class ModelExportHelper: public QObject {
 		//! \brief Retores the previous ALTER command generation state for table columns/constraints
 		void restoreGenAtlerCmdsStatus(void);
 
+		/*! \brief Forces the initial data of the tables to be generated as INSERT commands since COPY ... FROM stdin
+		 * blocks can't be executed through the export connection. The original formats are saved to be restored later */
+		void saveInitialDataFormats(DatabaseModel *db_model);
+
+		//! \brief Restores the initial data formats changed by saveInitialDataFormats()
+		void restoreInitialDataFormats(void);
+
 		//! \brief Revert the dbms export process, removing the created database, roles and tablespaces
 		void undoDBMSExport(DatabaseModel *db_model, Connection &conn, bool use_tmp_names);
 
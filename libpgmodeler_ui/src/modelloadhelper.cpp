@@ -0,0 +1,82 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modelloadhelper.h"
+
+ModelLoadHelper::ModelLoadHelper(void)
+{
+	db_model=nullptr;
+	model_thread=nullptr;
+}
+
+void ModelLoadHelper::setLoadParams(DatabaseModel *model, const QString &filename)
+{
+	if(!model)
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	this->db_model=model;
+	this->filename=filename;
+	model_thread=model->thread();
+}
+
+void ModelLoadHelper::moveObjectsToModelThread(void)
+{
+	vector<ObjectType> types={ ObjectType::Schema, ObjectType::Table, ObjectType::ForeignTable, ObjectType::View,
+														 ObjectType::Textbox, ObjectType::Relationship, ObjectType::BaseRelationship };
+	BaseGraphicObject *graph_obj=nullptr;
+	BaseRelationship *rel=nullptr;
+	Textbox *label=nullptr;
+
+	for(auto &type : types)
+	{
+		for(auto &obj : *db_model->getObjectList(type))
+		{
+			graph_obj=dynamic_cast<BaseGraphicObject *>(obj);
+
+			//Objects created prior the loading (e.g. system objects) already belong to the model's thread
+			if(graph_obj->thread()==QThread::currentThread())
+				graph_obj->moveToThread(model_thread);
+
+			rel=dynamic_cast<BaseRelationship *>(obj);
+			if(!rel) continue;
+
+			for(unsigned i=BaseRelationship::SrcCardLabel; i <= BaseRelationship::RelNameLabel; i++)
+			{
+				label=rel->getLabel(i);
+
+				if(label && label->thread()==QThread::currentThread())
+					label->moveToThread(model_thread);
+			}
+		}
+	}
+}
+
+void ModelLoadHelper::loadModel(void)
+{
+	try
+	{
+		db_model->loadModel(filename);
+		moveObjectsToModelThread();
+		emit s_loadFinished();
+	}
+	catch(Exception &e)
+	{
+		moveObjectsToModelThread();
+		emit s_loadAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
+	}
+}
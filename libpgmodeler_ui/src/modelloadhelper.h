@@ -0,0 +1,67 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class ModelLoadHelper
+\brief Implements the loading of a database model file in a separated thread. Only the parsing and
+the objects creation are done by this class, the graphical representation of the objects must be
+created by the model widget in the main thread after the loading finishes.
+*/
+
+#ifndef MODEL_LOAD_HELPER_H
+#define MODEL_LOAD_HELPER_H
+
+#include <QThread>
+#include "databasemodel.h"
+
+class ModelLoadHelper: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Model in which the objects are loaded
+		DatabaseModel *db_model;
+
+		//! \brief File being loaded
+		QString filename;
+
+		//! \brief Thread that owns the model. The graphical objects created while loading are moved to it
+		QThread *model_thread;
+
+		//! \brief Moves the graphical objects created by the loading thread to the model's thread
+		void moveObjectsToModelThread(void);
+
+	public:
+		ModelLoadHelper(void);
+
+		/*! \brief Configures the model and the file to be loaded. This method must be called in the thread
+		 * that owns the model (usually the main thread) before moving the helper to the loading thread */
+		void setLoadParams(DatabaseModel *model, const QString &filename);
+
+	public slots:
+		void loadModel(void);
+
+	signals:
+		//! \brief This signal is emitted when the model is completely loaded
+		void s_loadFinished(void);
+
+		//! \brief This signal is emitted when the loading is aborted due to an error
+		void s_loadAborted(Exception e);
+};
+
+#endif
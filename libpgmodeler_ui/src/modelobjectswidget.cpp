@@ -19,12 +19,14 @@
 #include "modelobjectswidget.h"
 #include "databaseimportform.h"
 #include "pgmodeleruins.h"
+#include "stallwatchdog.h"
 
 ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) : QWidget(parent)
 {
 	setupUi(this);
 	model_wgt=nullptr;
 	db_model=nullptr;
+	list_outdated=false;
 	setModel(db_model);
 
 	title_wgt->setVisible(!simplified_view);
@@ -79,6 +81,11 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 	connect(by_id_chk, SIGNAL(toggled(bool)), this, SLOT(filterObjects()));
 }
 
+ModelObjectsWidget::~ModelObjectsWidget(void)
+{
+	clearViewStates();
+}
+
 bool ModelObjectsWidget::eventFilter(QObject *object, QEvent *event)
 {
 	if(event->type() == QEvent::FocusOut &&
@@ -357,6 +364,9 @@ void ModelObjectsWidget::setObjectVisible(QListWidgetItem *item)
 	//Set the visibility of the object type
 	setObjectVisible(obj_type, item->checkState()==Qt::Checked);
 
+	//The stored views of the other models don't reflect the new visibility settings anymore
+	clearViewStates();
+
 	//Updates the entire objects view (list and tree) to reflect the modification
 	updateObjectsView();
 }
@@ -376,6 +386,7 @@ void ModelObjectsWidget::setAllObjectsVisible(bool value)
 		item->setCheckState((checked ? Qt::Checked : Qt::Unchecked));
 	}
 
+	clearViewStates();
 	updateObjectsView();
 }
 
@@ -387,6 +398,15 @@ void ModelObjectsWidget::changeObjectsView(void)
 		tree_view_tb->setChecked(sender()==tree_view_tb);
 		list_view_tb->setChecked(sender()==list_view_tb);
 		by_id_chk->setEnabled(sender()==tree_view_tb);
+
+		//The object list is rebuilt only when it's about to be displayed
+		if(list_view_tb->isChecked() && list_outdated)
+		{
+			updateObjectsList();
+
+			if(!filter_edt->text().isEmpty())
+				filterObjects();
+		}
 	}
 	else if(sender()==options_tb)
 	{
@@ -438,6 +458,8 @@ void ModelObjectsWidget::filterObjects(void)
 
 void ModelObjectsWidget::updateObjectsView(void)
 {
+  StallMarker stall_marker(__PRETTY_FUNCTION__);
+
   updateDatabaseTree();
   updateObjectsList();
 
@@ -463,6 +485,7 @@ void ModelObjectsWidget::updateObjectsList(void)
 	}
 
 	ObjectFinderWidget::updateObjectTable(objectslist_tbw, objects);
+	list_outdated=false;
 }
 
 void ModelObjectsWidget::updateSchemaTree(QTreeWidgetItem *root)
@@ -831,6 +854,27 @@ void ModelObjectsWidget::close(void)
 
 void ModelObjectsWidget::setModel(ModelWidget *model_wgt)
 {
+	/* When switching between models the tree items of the previous model are detached and stored
+	 * so switching back to it only reattaches them instead of rebuilding the whole tree */
+	if(!simplified_view && this->model_wgt!=model_wgt)
+	{
+		if(this->model_wgt)
+			storeViewState();
+
+		this->model_wgt=model_wgt;
+
+		if(model_wgt && views_states.count(model_wgt))
+		{
+			this->db_model=model_wgt->db_model;
+
+			if(restoreViewState())
+			{
+				enableControls(true);
+				return;
+			}
+		}
+	}
+
 	this->model_wgt=model_wgt;
 
 	if(model_wgt)
@@ -841,11 +885,14 @@ void ModelObjectsWidget::setModel(ModelWidget *model_wgt)
 
 void ModelObjectsWidget::setModel(DatabaseModel *db_model)
 {
-	bool enable = (db_model!=nullptr);
-
 	this->db_model=db_model;
-	content_wgt->setEnabled(enable);
 	updateObjectsView();
+	enableControls(db_model!=nullptr);
+}
+
+void ModelObjectsWidget::enableControls(bool enable)
+{
+	content_wgt->setEnabled(enable);
 	visaoobjetos_stw->setEnabled(true);
 	expand_all_tb->setEnabled(enable && tree_view_tb->isChecked());
 	collapse_all_tb->setEnabled(enable && tree_view_tb->isChecked());
@@ -940,6 +987,112 @@ void ModelObjectsWidget::resizeEvent(QResizeEvent *)
 	objectstree_tw->header()->setDefaultSectionSize(objectstree_tw->width());
 }
 
+void ModelObjectsWidget::storeViewState(void)
+{
+	ViewState &state=views_states[model_wgt];
+	QTreeWidgetItemIterator itr(objectstree_tw);
+
+	qDeleteAll(state.items);
+	state.items.clear();
+	state.expanded_items.clear();
+
+	//The expansion state is kept by the tree widget so it needs to be saved before detaching the items
+	while(*itr)
+	{
+		if((*itr)->isExpanded())
+			state.expanded_items.push_back(*itr);
+
+		++itr;
+	}
+
+	state.filter=filter_edt->text();
+	state.filter_by_id=by_id_chk->isChecked();
+	state.scroll_pos=objectstree_tw->verticalScrollBar()->value();
+	state.op_count=model_wgt->op_list->getCurrentSize();
+	state.op_index=model_wgt->op_list->getCurrentIndex();
+	state.objs_changes=model_wgt->getObjectsChangesCount();
+
+	objectstree_tw->blockSignals(true);
+	objectstree_tw->clearSelection();
+	state.items=objectstree_tw->invisibleRootItem()->takeChildren();
+	objectstree_tw->blockSignals(false);
+}
+
+bool ModelObjectsWidget::restoreViewState(void)
+{
+	auto itr=views_states.find(model_wgt);
+
+	if(itr==views_states.end())
+		return(false);
+
+	ViewState &state=itr->second;
+
+	//The model was changed in the meantime (e.g. objects cut from it and pasted in another model)
+	if(state.op_count!=model_wgt->op_list->getCurrentSize() ||
+		 state.op_index!=model_wgt->op_list->getCurrentIndex() ||
+		 state.objs_changes!=model_wgt->getObjectsChangesCount())
+	{
+		qDeleteAll(state.items);
+		views_states.erase(itr);
+		return(false);
+	}
+
+	objectstree_tw->setUpdatesEnabled(false);
+	objectstree_tw->blockSignals(true);
+	objectstree_tw->clear();
+	objectstree_tw->insertTopLevelItems(0, state.items);
+
+	for(auto &item : state.expanded_items)
+		item->setExpanded(true);
+
+	objectstree_tw->blockSignals(false);
+
+	filter_edt->blockSignals(true);
+	by_id_chk->blockSignals(true);
+	filter_edt->setText(state.filter);
+	by_id_chk->setChecked(state.filter_by_id);
+	filter_edt->blockSignals(false);
+	by_id_chk->blockSignals(false);
+
+	//The object list is rebuilt only if it's being displayed, otherwise it'll be updated when the list view is activated
+	list_outdated=true;
+
+	if(list_view_tb->isChecked())
+		updateObjectsList();
+
+	if(!state.filter.isEmpty())
+		filterObjects();
+
+	objectstree_tw->setUpdatesEnabled(true);
+	objectstree_tw->verticalScrollBar()->setValue(state.scroll_pos);
+
+	//The items now belong to the tree widget again
+	views_states.erase(itr);
+	return(true);
+}
+
+void ModelObjectsWidget::removeViewState(ModelWidget *model_wgt)
+{
+	if(model_wgt==this->model_wgt)
+		setModel(static_cast<ModelWidget *>(nullptr));
+
+	auto itr=views_states.find(model_wgt);
+
+	if(itr!=views_states.end())
+	{
+		qDeleteAll(itr->second.items);
+		views_states.erase(itr);
+	}
+}
+
+void ModelObjectsWidget::clearViewStates(void)
+{
+	for(auto &itr : views_states)
+		qDeleteAll(itr.second.items);
+
+	views_states.clear();
+}
+
 void ModelObjectsWidget::saveTreeState(bool value)
 {
 	save_tree_state=(!simplified_view && value);
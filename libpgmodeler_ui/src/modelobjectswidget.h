@@ -65,6 +65,36 @@ class ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget {
 		//! \brief Stores which object types are visible on the view
 		map<ObjectType, bool> visible_objs_map;
 
+		/*! \brief Stores the state of the views of a model that is not the current one. The tree items are
+		 * detached from the tree widget and kept alive so switching back to the model only reattaches them */
+		struct ViewState {
+			QList<QTreeWidgetItem *> items;
+			vector<QTreeWidgetItem *> expanded_items;
+			QString filter;
+			bool filter_by_id;
+			int scroll_pos, op_index;
+			unsigned op_count, objs_changes;
+		};
+
+		//! \brief Stores the views state of each model already shown in the widget
+		map<ModelWidget *, ViewState> views_states;
+
+		/*! \brief Indicates that the object list is out of date with the current model.
+		 * The list is rebuilt only when it becomes visible (see changeObjectsView()) */
+		bool list_outdated;
+
+		//! \brief Detaches the tree items of the current model storing them in views_states
+		void storeViewState(void);
+
+		/*! \brief Reattaches the tree items stored for the current model restoring the item expansion,
+		 * filter and scroll position. The stored state is discarded afterwards. If the model was changed
+		 * while it wasn't the current one the stored items are destroyed and false is returned, in that case
+		 * the tree must be rebuilt since the items may reference objects that don't exist anymore */
+		bool restoreViewState(void);
+
+		//! \brief Enables the widget's controls according to the availability of a database model
+		void enableControls(bool enable);
+
 		//! \brief Updates only a schema tree starting from the 'root' item
 		void updateSchemaTree(QTreeWidgetItem *root);
 
@@ -100,12 +130,20 @@ class ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget {
 
 	public:
 		ModelObjectsWidget(bool simplified_view=false, QWidget * parent = nullptr);
+		~ModelObjectsWidget(void);
 
 		BaseObject *getSelectedObject(void);
 
 		//! \brief Enables the object creation in simplified view by exposing the popup menu "New [object]"
 		void enableObjectCreation(bool value);
 
+		/*! \brief Discards the views state stored for the model. If the model is the current one the views
+		 * are cleared. This method must be called before destroying a model previously assigned to the widget */
+		void removeViewState(ModelWidget *model_wgt);
+
+		//! \brief Discards the views state of all models forcing their views to be rebuilt when they are assigned again
+		void clearViewStates(void);
+
 	protected:
 		//! \brief Saves the currently expanded items on the specified vector
 		void saveTreeState(vector<BaseObject *> &tree_items);
@@ -18,6 +18,7 @@
 
 #include "modeloverviewwidget.h"
 #include "modelwidget.h"
+#include "stallwatchdog.h"
 
 ModelOverviewWidget::ModelOverviewWidget(QWidget *parent) : QWidget(parent, Qt::WindowCloseButtonHint | Qt::Tool)
 {
@@ -73,7 +74,20 @@ void ModelOverviewWidget::show(ModelWidget *model)
 
 		this->resizeOverview();
 		this->updateZoomFactor(this->model->getCurrentZoom());
-		this->updateOverview(true);
+
+		auto itr=overview_pixmaps.find(this->model);
+
+		if(itr!=overview_pixmaps.end() &&
+			 itr->second.op_count==this->model->op_list->getCurrentSize() &&
+			 itr->second.op_index==this->model->op_list->getCurrentIndex() &&
+			 itr->second.objs_changes==this->model->getObjectsChangesCount())
+		{
+			frame->setEnabled(true);
+			label->setPixmap(itr->second.pixmap);
+			label->resize(curr_size.toSize());
+		}
+		else
+			this->updateOverview(true);
 
 		this->move(this->model->geometry().right() - this->width(),
 							 this->model->geometry().bottom() - this->height());
@@ -88,6 +102,9 @@ void ModelOverviewWidget::show(ModelWidget *model)
 void ModelOverviewWidget::closeEvent(QCloseEvent *event)
 {
 	model=nullptr;
+
+	//While hidden the overview doesn't follow the models' changes so the stored images become invalid
+	overview_pixmaps.clear();
 	emit s_overviewVisible(false);
 	QWidget::closeEvent(event);
 }
@@ -123,6 +140,8 @@ void ModelOverviewWidget::updateOverview(void)
 
 void ModelOverviewWidget::updateOverview(bool force_update)
 {
+	StallMarker stall_marker(__PRETTY_FUNCTION__);
+
 	if(this->model && (this->isVisible() || force_update))
 	{
 		QPixmap pix;
@@ -137,6 +156,7 @@ void ModelOverviewWidget::updateOverview(bool force_update)
 
 		if(!p.isActive())
 		{
+			overview_pixmaps.erase(this->model);
 			label->setPixmap(QPixmap());
 			label->setText(trUtf8("Failed to generate the overview image.\nThe requested size %1 x %2 was too big and there was not enough memory to allocate!")
 										 .arg(pixmap_size.width()).arg(pixmap_size.height()));
@@ -150,8 +170,14 @@ void ModelOverviewWidget::updateOverview(bool force_update)
 			p.setRenderHints(QPainter::TextAntialiasing, false);
 			this->model->scene->render(&p, pix.rect(), scene_rect.toRect());
 
+			OverviewState &state=overview_pixmaps[this->model];
+
 			//Resizes the pixmap to the previous configured QSize
-			label->setPixmap(pix.scaled(curr_size.toSize(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
+			state.pixmap=pix.scaled(curr_size.toSize(), Qt::KeepAspectRatio, Qt::SmoothTransformation);
+			state.op_count=this->model->op_list->getCurrentSize();
+			state.op_index=this->model->op_list->getCurrentIndex();
+			state.objs_changes=this->model->getObjectsChangesCount();
+			label->setPixmap(state.pixmap);
 		}
 
 		label->resize(curr_size.toSize());
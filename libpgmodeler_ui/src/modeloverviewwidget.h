@@ -53,6 +53,20 @@ class ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidget {
 
 		QSize pixmap_size;
 
+		/*! \brief Stores the last overview image rendered for a model as well the values used to detect if
+		 * the model was changed after the image was rendered */
+		struct OverviewState {
+			QPixmap pixmap;
+			int op_index;
+			unsigned op_count, objs_changes;
+		};
+
+		/*! \brief Stores the last overview image rendered for each model. Since the overview tracks all the changes
+		 * of the current model while visible, the stored images are reused when switching between models
+		 * instead of rendering the whole scene again, unless the model was changed in the meantime.
+		 * The images are discarded when the overview is closed */
+		map<ModelWidget *, OverviewState> overview_pixmaps;
+
 		//! \brief Resize factor applied to overview widgets (default: 20% of the scene original size)
 		static constexpr double ResizeFactor=0.20;
 
@@ -0,0 +1,309 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modelprinthelper.h"
+#include <QElapsedTimer>
+
+ModelPrintHelper::ModelPrintHelper(void)
+{
+	scene=nullptr;
+	printer=nullptr;
+	h_page_cnt=v_page_cnt=next_page=0;
+	print_grid=print_page_nums=print_canceled=snapshots_finished=false;
+}
+
+vector<QRectF> ModelPrintHelper::getPagesForPrinting(ObjectsScene *scene, QPrinter *printer, QRectF &margins, unsigned &h_page_cnt, unsigned &v_page_cnt)
+{
+	QPrinter::PaperSize paper_size_id;
+	QPrinter::Orientation orient;
+	QSizeF paper_size, custom_p_size;
+
+	if(!scene || !printer)
+		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	//Get the page size based on the printer settings
+	ObjectsScene::getPaperConfiguration(paper_size_id, orient, margins, custom_p_size);
+	paper_size=printer->paperSize(QPrinter::Point);
+
+	if(paper_size_id!=QPrinter::Custom)
+		paper_size-=margins.size();
+
+	return(scene->getPagesForPrinting(paper_size, margins.size(), h_page_cnt, v_page_cnt));
+}
+
+void ModelPrintHelper::setPrintParams(ObjectsScene *scene, QPrinter *printer, bool print_grid, bool print_page_nums)
+{
+	unsigned first_page=0, last_page=0;
+
+	try
+	{
+		pages=getPagesForPrinting(scene, printer, margins, h_page_cnt, v_page_cnt);
+		last_page=pages.size();
+
+		//Limiting the pages to the range selected by the user (page numbers start at 1)
+		if(printer->printRange()==QPrinter::PageRange && printer->fromPage() > 0)
+		{
+			first_page=static_cast<unsigned>(printer->fromPage()) - 1;
+
+			if(printer->toPage() > 0)
+				last_page=std::min(last_page, static_cast<unsigned>(printer->toPage()));
+		}
+
+		page_ids.clear();
+		for(unsigned page=first_page; page < last_page; page++)
+			page_ids.push_back(page);
+
+		this->scene=scene;
+		this->printer=printer;
+		this->print_grid=print_grid;
+		this->print_page_nums=print_page_nums;
+		page_size=printer->pageRect().size();
+		next_page=0;
+		print_canceled=false;
+		snapshots_finished=page_ids.empty();
+		snapshots.clear();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+unsigned ModelPrintHelper::getPageCount(void)
+{
+	return(page_ids.size());
+}
+
+bool ModelPrintHelper::takeSnapshots(void)
+{
+	bool show_grid, align_objs, show_delims, canceled;
+	PageSnapshot snapshot;
+	QPainter painter;
+	int pending=0;
+
+	snapshots_mtx.lock();
+	pending=snapshots.size();
+	canceled=print_canceled;
+	snapshots_mtx.unlock();
+
+	if(canceled || next_page >= page_ids.size())
+		return(true);
+
+	if(pending >= MaxPendingPages)
+		return(false);
+
+	/* The grid options are changed only while the pages are recorded so the
+	 * other scenes are drawn with the user's options in the meantime */
+	show_grid = ObjectsScene::isShowGrid();
+	align_objs = ObjectsScene::isAlignObjectsToGrid();
+	show_delims = ObjectsScene::isShowPageDelimiters();
+	ObjectsScene::setGridOptions(print_grid, align_objs, false);
+	scene->clearSelection();
+
+	while(pending < MaxPendingPages && next_page < page_ids.size())
+	{
+		snapshot.page_id=page_ids[next_page];
+		snapshot.h_page_id=(h_page_cnt > 0 ? snapshot.page_id % h_page_cnt : 0);
+		snapshot.v_page_id=(h_page_cnt > 0 ? snapshot.page_id / h_page_cnt : 0);
+		snapshot.picture=QPicture();
+
+		painter.begin(&snapshot.picture);
+		painter.setRenderHint(QPainter::Antialiasing);
+		scene->render(&painter, QRectF(QPointF(0, 0), page_size), pages[snapshot.page_id]);
+		painter.end();
+		next_page++;
+
+		snapshots_mtx.lock();
+		snapshots.enqueue(snapshot);
+		pending=snapshots.size();
+		snapshots_finished=(next_page >= page_ids.size());
+		snapshots_cond.wakeAll();
+		snapshots_mtx.unlock();
+	}
+
+	ObjectsScene::setGridOptions(show_grid, align_objs, show_delims);
+
+	return(next_page >= page_ids.size());
+}
+
+void ModelPrintHelper::cancelPrinting(void)
+{
+	snapshots_mtx.lock();
+	print_canceled=true;
+	snapshots_cond.wakeAll();
+	snapshots_mtx.unlock();
+}
+
+void ModelPrintHelper::printPages(void)
+{
+	QElapsedTimer print_timer, page_timer;
+	PageSnapshot snapshot;
+	QPainter painter;
+	unsigned count=0, page_cnt=page_ids.size();
+	bool has_page=false, canceled=false;
+
+	try
+	{
+		print_timer.start();
+
+		if(!painter.begin(printer))
+			throw Exception(trUtf8("Could not start the printing! Make sure that the selected printer is available or the output file is writable."),
+											ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		painter.setRenderHint(QPainter::Antialiasing);
+
+		while(true)
+		{
+			//Waiting for the next recorded page
+			snapshots_mtx.lock();
+
+			while(snapshots.isEmpty() && !print_canceled && !snapshots_finished)
+				snapshots_cond.wait(&snapshots_mtx);
+
+			canceled=print_canceled;
+			has_page=(!canceled && !snapshots.isEmpty());
+
+			if(has_page)
+				snapshot=snapshots.dequeue();
+
+			snapshots_mtx.unlock();
+
+			if(!has_page)
+				break;
+
+			emit s_snapshotsRequested();
+			page_timer.start();
+
+			if(count > 0)
+				printer->newPage();
+
+			painter.drawPicture(0, 0, snapshot.picture);
+			drawPageDecorations(painter, snapshot);
+			count++;
+
+			emit s_progressUpdated((count/static_cast<double>(page_cnt)) * 100,
+														 trUtf8("Page <strong>%1</strong> printed in <strong>%2 ms</strong> (%3 of %4)...")
+														 .arg(snapshot.page_id + 1).arg(page_timer.elapsed()).arg(count).arg(page_cnt));
+		}
+
+		if(canceled)
+		{
+			printer->abort();
+			painter.end();
+			emit s_printingCanceled();
+		}
+		else
+		{
+			painter.end();
+			emit s_printingFinished(count, print_timer.elapsed());
+		}
+	}
+	catch(Exception &e)
+	{
+		if(painter.isActive())
+			painter.end();
+
+		emit s_printingAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
+	}
+}
+
+void ModelPrintHelper::drawPageDecorations(QPainter &painter, const PageSnapshot &snapshot)
+{
+	unsigned h_pg_id=snapshot.h_page_id, v_pg_id=snapshot.v_page_id;
+	QPen pen;
+	QPointF top_left, top_right, bottom_left, bottom_right,
+			h_top_mid, h_bottom_mid, v_left_mid, v_right_mid, dx, dy, dx1, dy1;
+
+	pen.setColor(QColor(120,120,120));
+	pen.setWidthF(1.0);
+
+	//Calculates the auxiliary points to draw the page delimiter lines
+	top_left.setX(0); top_left.setY(0);
+	top_right.setX(page_size.width()); top_right.setY(0);
+
+	bottom_left.setX(0); bottom_left.setY(page_size.height());
+	bottom_right.setX(top_right.x()); bottom_right.setY(bottom_left.y());
+
+	h_top_mid.setX(page_size.width()/2); h_top_mid.setY(0);
+	h_bottom_mid.setX(h_top_mid.x()); h_bottom_mid.setY(bottom_right.y());
+
+	v_left_mid.setX(top_left.x()); v_left_mid.setY(page_size.height()/2);
+	v_right_mid.setX(top_right.x()); v_right_mid.setY(v_left_mid.y());
+
+	dx.setX(margins.left());
+	dx1.setX(margins.width());
+	dy.setY(margins.top());
+	dy1.setY(margins.height());
+
+	//Print the current page number is this option is marked
+	if(print_page_nums)
+	{
+		painter.setPen(QColor(120,120,120));
+		painter.drawText(-margins.left(), -margins.top(), QString("%1").arg(snapshot.page_id + 1));
+	}
+
+	//Print the guide lines at corners of the page
+	painter.setPen(pen);
+	if(h_pg_id==0 && v_pg_id==0)
+	{
+		painter.drawLine(top_left, top_left + dx);
+		painter.drawLine(top_left, top_left + dy);
+	}
+
+	if(h_pg_id==h_page_cnt-1 && v_pg_id==0)
+	{
+		painter.drawLine(top_right, top_right - dx1);
+		painter.drawLine(top_right, top_right + dy);
+	}
+
+	if(h_pg_id==0 && v_pg_id==v_page_cnt-1)
+	{
+		painter.drawLine(bottom_left, bottom_left + dx);
+		painter.drawLine(bottom_left, bottom_left - dy1);
+	}
+
+	if(h_pg_id==h_page_cnt-1 && v_pg_id==v_page_cnt-1)
+	{
+		painter.drawLine(bottom_right, bottom_right - dx1);
+		painter.drawLine(bottom_right, bottom_right - dy1);
+	}
+
+	if(h_pg_id >=1 && h_pg_id < h_page_cnt-1 && v_pg_id==0)
+	{
+		painter.drawLine(h_top_mid, h_top_mid - dx1);
+		painter.drawLine(h_top_mid, h_top_mid + dx);
+	}
+
+	if(h_pg_id >=1 && h_pg_id < h_page_cnt-1 && v_pg_id==v_page_cnt-1)
+	{
+		painter.drawLine(h_bottom_mid, h_bottom_mid - dx1);
+		painter.drawLine(h_bottom_mid, h_bottom_mid + dx);
+	}
+
+	if(v_pg_id >=1 && v_pg_id < v_page_cnt-1 && h_pg_id==0)
+	{
+		painter.drawLine(v_left_mid, v_left_mid - dy1);
+		painter.drawLine(v_left_mid, v_left_mid + dy);
+	}
+
+	if(v_pg_id >=1 && v_pg_id < v_page_cnt-1 && h_pg_id==h_page_cnt-1)
+	{
+		painter.drawLine(v_right_mid, v_right_mid - dy1);
+		painter.drawLine(v_right_mid, v_right_mid + dy);
+	}
+}
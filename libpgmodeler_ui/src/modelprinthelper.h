@@ -0,0 +1,127 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class ModelPrintHelper
+\brief Implements the printing of database models in a separated thread. The pages are recorded from the scene
+(as QPicture snapshots) in the main thread and only the writing of the pages on the printer is done by this class.
+The amount of recorded pages waiting to be printed is limited so the document is streamed to the output instead
+of being entirely built in memory.
+*/
+
+#ifndef MODEL_PRINT_HELPER_H
+#define MODEL_PRINT_HELPER_H
+
+#include "objectsscene.h"
+#include <QPicture>
+#include <QQueue>
+#include <QMutex>
+#include <QWaitCondition>
+
+class ModelPrintHelper: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Maximum amount of recorded pages waiting to be printed
+		static constexpr int MaxPendingPages=4;
+
+		//! \brief Stores the painting commands of a page and its position in the grid of pages
+		struct PageSnapshot {
+			unsigned page_id, h_page_id, v_page_id;
+			QPicture picture;
+		};
+
+		//! \brief Scene from which the pages are recorded
+		ObjectsScene *scene;
+
+		QPrinter *printer;
+
+		//! \brief Rectangles of all pages of the scene (see ObjectsScene::getPagesForPrinting)
+		vector<QRectF> pages;
+
+		//! \brief Indexes of the pages in the vector above that will be printed (page range)
+		vector<unsigned> page_ids;
+
+		//! \brief Pages recorded and not yet printed
+		QQueue<PageSnapshot> snapshots;
+
+		QMutex snapshots_mtx;
+
+		QWaitCondition snapshots_cond;
+
+		QRectF margins;
+
+		QSize page_size;
+
+		unsigned h_page_cnt, v_page_cnt,
+
+		//! \brief Index (in page_ids) of the next page to be recorded
+		next_page;
+
+		bool print_grid, print_page_nums,
+
+		//! \brief Flags shared between the threads (accessed only while holding snapshots_mtx)
+		print_canceled, snapshots_finished;
+
+		//! \brief Draws the page number and the guide lines at the corners of the page
+		void drawPageDecorations(QPainter &painter, const PageSnapshot &snapshot);
+
+	public:
+		ModelPrintHelper(void);
+
+		/*! \brief Returns the rectangles of the pages needed to print the whole scene using the printer's paper settings.
+		 * The margins as well as the horizontal and vertical page counts are returned in the respective parameters */
+		static vector<QRectF> getPagesForPrinting(ObjectsScene *scene, QPrinter *printer, QRectF &margins, unsigned &h_page_cnt, unsigned &v_page_cnt);
+
+		/*! \brief Configures the printing of the scene. If a page range is set on the printer only those pages are printed.
+		 * This method must be called only while the thread that runs printPages() is stopped */
+		void setPrintParams(ObjectsScene *scene, QPrinter *printer, bool print_grid, bool print_page_nums);
+
+		//! \brief Returns the amount of pages to be printed
+		unsigned getPageCount(void);
+
+		/*! \brief Records the next pages while there are free slots in the pending pages queue. This method must be called
+		 * from the main thread since it renders the scene. Returns true when all pages were recorded */
+		bool takeSnapshots(void);
+
+	public slots:
+		//! \brief Prints the recorded pages as they are made available by takeSnapshots()
+		void printPages(void);
+
+		//! \brief Cancels the printing. This method can be called from any thread
+		void cancelPrinting(void);
+
+	signals:
+		//! \brief This signal is emitted after each printed page
+		void s_progressUpdated(int progress, QString msg);
+
+		//! \brief This signal is emitted every time a recorded page is consumed so more pages can be recorded
+		void s_snapshotsRequested(void);
+
+		//! \brief This signal is emitted when all pages are printed with the amount of pages and the time spent (in ms)
+		void s_printingFinished(int count, qint64 elapsed);
+
+		//! \brief This signal is emitted when the user cancels the printing
+		void s_printingCanceled(void);
+
+		//! \brief This signal is emitted when an error happens while printing the pages
+		void s_printingAborted(Exception e);
+};
+
+#endif
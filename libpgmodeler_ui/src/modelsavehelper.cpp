@@ -0,0 +1,69 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modelsavehelper.h"
+#include <QElapsedTimer>
+
+ModelSaveHelper::ModelSaveHelper(void)
+{
+
+}
+
+void ModelSaveHelper::addSnapshot(const QString &filename, const attribs_map &attribs, const map<QString, QStringList> &obj_defs)
+{
+	filenames.push_back(filename);
+	snapshots_attribs.push_back(attribs);
+	snapshots_defs.push_back(obj_defs);
+}
+
+bool ModelSaveHelper::hasSnapshots(void)
+{
+	return(!filenames.isEmpty());
+}
+
+void ModelSaveHelper::clearSnapshots(void)
+{
+	filenames.clear();
+	snapshots_attribs.clear();
+	snapshots_defs.clear();
+}
+
+void ModelSaveHelper::saveSnapshots(void)
+{
+	QElapsedTimer timer;
+	int count=filenames.size();
+
+	try
+	{
+		timer.start();
+
+		for(int i=0; i < count; i++)
+		{
+			DatabaseModel::saveSnapshot(filenames[i], snapshots_attribs[i], snapshots_defs[i]);
+			emit s_progressUpdated(((i + 1)/static_cast<double>(count)) * 100);
+		}
+
+		clearSnapshots();
+		emit s_savingFinished(count, timer.elapsed());
+	}
+	catch(Exception &e)
+	{
+		clearSnapshots();
+		emit s_savingAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
+	}
+}
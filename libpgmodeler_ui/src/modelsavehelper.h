@@ -0,0 +1,72 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class ModelSaveHelper
+\brief Implements the saving of database models snapshots (see DatabaseModel::getXMLSnapshot()) in a separated thread.
+The snapshots are taken in the main thread and only the code assembling and the disk writing are done by this class.
+*/
+
+#ifndef MODEL_SAVE_HELPER_H
+#define MODEL_SAVE_HELPER_H
+
+#include "databasemodel.h"
+
+class ModelSaveHelper: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Files in which the snapshots will be saved
+		QStringList filenames;
+
+		//! \brief Attributes of the snapshots (one per file)
+		vector<attribs_map> snapshots_attribs;
+
+		//! \brief Objects definitions of the snapshots (one per file)
+		vector<map<QString, QStringList>> snapshots_defs;
+
+	public:
+		ModelSaveHelper(void);
+
+		/*! \brief Adds a snapshot to be saved in the specified file. This method must be called only
+		 * while the thread that runs saveSnapshots() is stopped */
+		void addSnapshot(const QString &filename, const attribs_map &attribs, const map<QString, QStringList> &obj_defs);
+
+		//! \brief Returns if there are snapshots pending to be saved
+		bool hasSnapshots(void);
+
+		//! \brief Discards the snapshots pending to be saved
+		void clearSnapshots(void);
+
+	public slots:
+		//! \brief Saves all the pending snapshots. The snapshots are discarded after the saving even in case of errors
+		void saveSnapshots(void);
+
+	signals:
+		//! \brief This signal is emitted after each saved snapshot
+		void s_progressUpdated(int progress);
+
+		//! \brief This signal is emitted when all the snapshots are saved with the amount of files written and the time spent (in ms)
+		void s_savingFinished(int count, qint64 elapsed);
+
+		//! \brief This signal is emitted when an error happens while saving the snapshots
+		void s_savingAborted(Exception e);
+};
+
+#endif
@@ -18,13 +18,14 @@
 
 #include "modelsdiffhelper.h"
 #include <QThread>
+#include <QThreadPool>
 #include "pgmodelerns.h"
 
 const vector<QString> ModelsDiffHelper::TableObjsIgnoredAttribs = { Attributes::Alias };
 
 const vector<QString> ModelsDiffHelper::ObjectsIgnoredAttribs = {
 	Attributes::MaxObjCount, Attributes::Protected, Attributes::SqlDisabled,
-	Attributes::RectVisible, Attributes::FillColor, Attributes::FadedOut,
+	Attributes::RectVisible, Attributes::FillColor, Attributes::FadedOut, Attributes::Collapsed,
 	Attributes::CollapseMode,	Attributes::AttribsPage, Attributes::ExtAttribsPage,
 	Attributes::Pagination,	Attributes::Alias };
 
@@ -36,6 +37,8 @@ ModelsDiffHelper::ModelsDiffHelper(void)
 {
 	diff_canceled=false;
 	pgsql_version=PgSqlVersions::DefaulVersion;
+	max_threads=0;
+	defer_code_gen=true;
 	source_model=imported_model=nullptr;
 	resetDiffCounter();
 
@@ -72,6 +75,16 @@ void ModelsDiffHelper::setPgSQLVersion(const QString pgsql_ver)
 	this->pgsql_version=pgsql_ver;
 }
 
+void ModelsDiffHelper::setMaxThreadCount(int count)
+{
+	max_threads=(count < 0 ? 0 : count);
+}
+
+void ModelsDiffHelper::setDeferredCodeGeneration(bool value)
+{
+	defer_code_gen=value;
+}
+
 void ModelsDiffHelper::resetDiffCounter(void)
 {  
 	diffs_counter[ObjectsDiffInfo::AlterObject]=0;
@@ -607,7 +620,7 @@ bool ModelsDiffHelper::isDiffInfoExists(unsigned diff_type, BaseObject *object,
 	bool found_diff=false;
 	ObjectsDiffInfo aux_diff(diff_type, object, old_object);
 
-	for(ObjectsDiffInfo diff : diff_infos)
+	for(auto &diff : diff_infos)
 	{
 		if((exact_match && diff==aux_diff) ||
 				(!exact_match &&
@@ -633,7 +646,7 @@ void ModelsDiffHelper::processDiffInfos(void)
 	map<unsigned, QString>::reverse_iterator ritr, ritr_end;
 	attribs_map attribs;
 	QString alter_def, no_inherit_def, inherit_def, set_perms,
-			unset_perms, col_drop_def, curr_pgsql_ver = BaseObject::getPgSQLVersion();
+			unset_perms, col_drop_def;
 	SchemaParser schparser;
 	Type *type=nullptr;
 	vector<Type *> types;
@@ -642,11 +655,32 @@ void ModelsDiffHelper::processDiffInfos(void)
 	PhysicalTable *parent_tab=nullptr;
 	bool skip_obj=false;
 	QStringList sch_names;
+	vector<CodeRequest> code_reqs;
+
+	/* Registers the generation of the CREATE command of an object which is postponed
+	 * until all diff infos are processed so it can be done concurrently (see processCodeRequests()) */
+	auto request_code=[&code_reqs, this](BaseObject *obj, map<unsigned, QString> &buffer){
+		//Without deferring, the code is generated right away as the diff infos are processed
+		if(!defer_code_gen)
+		{
+			buffer[obj->getObjectId()]=getCodeDefinition(obj, false);
+			return;
+		}
+
+		if(buffer.count(obj->getObjectId())!=0)
+			return;
+
+		bool parallel=(!TableObject::isTableObject(obj->getObjectType()) && !dynamic_cast<BaseRelationship *>(obj));
+
+		buffer[obj->getObjectId()]=QString();
+		code_reqs.push_back({ obj, &buffer, parallel, QString(), Exception(), false });
+	};
 
 	try
 	{
-		//Overriding the global PostgreSQL version so the diff code can match the destination server version
-		BaseObject::setPgSQLVersion(pgsql_version);
+		/* Overriding the PostgreSQL version only for the diff thread so the diff code can match the destination
+		 * server version without affecting the code generated by other threads (e.g. the source code preview) */
+		BaseObject::setThreadPgSQLVersion(pgsql_version);
 
 		if(!diff_infos.empty())
 			emit s_progressUpdated(0, trUtf8("Processing diff infos..."));
@@ -656,7 +690,7 @@ void ModelsDiffHelper::processDiffInfos(void)
 			sch_names.push_back(schema->getName(true));
 
 		//Separating the base types
-		for(ObjectsDiffInfo diff : diff_infos)
+		for(auto &diff : diff_infos)
 		{
 			type=dynamic_cast<Type *>(diff.getObject());
 
@@ -667,7 +701,7 @@ void ModelsDiffHelper::processDiffInfos(void)
 			}
 		}
 
-		for(ObjectsDiffInfo diff : diff_infos)
+		for(auto &diff : diff_infos)
 		{
 			diff_type=diff.getDiffType();
 			object=diff.getObject();
@@ -756,13 +790,13 @@ void ModelsDiffHelper::processDiffInfos(void)
 					if(object->getObjectType()==ObjectType::Constraint)
 					{
 						if(dynamic_cast<Constraint *>(object)->getConstraintType()==ConstraintType::ForeignKey)
-							create_fks[object->getObjectId()]=getCodeDefinition(object, false);
+							request_code(object, create_fks);
 						else
-							create_constrs[object->getObjectId()]=getCodeDefinition(object, false);
+							request_code(object, create_constrs);
 					}
 					else
 					{
-						create_objs[object->getObjectId()]=getCodeDefinition(object, false);
+						request_code(object, create_objs);
 
 						if(obj_type==ObjectType::Schema)
 							sch_names.push_back(object->getName(true));
@@ -796,12 +830,12 @@ void ModelsDiffHelper::processDiffInfos(void)
 							if(obj->getObjectType()==ObjectType::Constraint)
 							{
 								if(dynamic_cast<Constraint *>(obj)->getConstraintType()==ConstraintType::ForeignKey)
-									create_fks[obj->getObjectId()]=getCodeDefinition(obj, false);
+									request_code(obj, create_fks);
 								else
-									create_constrs[obj->getObjectId()]=getCodeDefinition(obj, false);
+									request_code(obj, create_constrs);
 							}
 							else
-								create_objs[obj->getObjectId()]=getCodeDefinition(obj, false);
+								request_code(obj, create_objs);
 						}
 					}
 
@@ -841,6 +875,9 @@ void ModelsDiffHelper::processDiffInfos(void)
 			}
 		}
 
+		//Generating the postponed CREATE commands (this must be done before restoring the base types' function parameters)
+		processCodeRequests(code_reqs);
+
 		//Creating the shell types declaration right below on the DDL that creates their schemas
 		for(Type *type : types)
 		{
@@ -935,12 +972,12 @@ void ModelsDiffHelper::processDiffInfos(void)
 		else
 			emit s_progressUpdated(100, trUtf8("Preparing diff code..."));
 
-		//Restoring the global PostgreSQL version
-		BaseObject::setPgSQLVersion(curr_pgsql_ver);
+		//Removing the diff thread's PostgreSQL version override
+		BaseObject::setThreadPgSQLVersion(QString());
 	}
 	catch(Exception &e)
 	{
-		BaseObject::setPgSQLVersion(curr_pgsql_ver);
+		BaseObject::setThreadPgSQLVersion(QString());
 
 		for(Type *type : types)
 			type->convertFunctionParameters(true);
@@ -949,6 +986,96 @@ void ModelsDiffHelper::processDiffInfos(void)
 	}
 }
 
+void ModelsDiffHelper::processCodeRequests(vector<CodeRequest> &requests)
+{
+	QThreadPool pool;
+	atomic<unsigned> next_req(0);
+	int par_count=0, worker_count=0;
+
+	/* Table children and relationships are handled first, serially, since their code generation
+	 * temporarily changes the state of the parent/related tables which may be handled in parallel */
+	for(auto &req : requests)
+	{
+		if(req.parallel)
+		{
+			par_count++;
+			continue;
+		}
+
+		try
+		{
+			req.code=getCodeDefinition(req.object, false);
+		}
+		catch(Exception &e)
+		{
+			req.error=e;
+			req.failed=true;
+		}
+	}
+
+	/* The current thread works as well, so the number of workers started is the maximum (or ideal)
+	 * thread count minus one, being limited to the number of parallel requests */
+	worker_count=std::min(max_threads > 0 ? max_threads : QThread::idealThreadCount(), par_count) - 1;
+
+	if(worker_count > 0)
+	{
+		pool.setMaxThreadCount(worker_count);
+
+		for(int i=0; i < worker_count; i++)
+			pool.start(new CodeRequestWorker(this, &requests, &next_req));
+	}
+
+	generateRequestedCode(requests, next_req);
+	pool.waitForDone();
+
+	//Storing the code in the proper buffers (indexed by object id) in the requests order so the output is deterministic
+	for(auto &req : requests)
+	{
+		if(req.failed)
+			throw Exception(req.error.getErrorMessage(),req.error.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&req.error);
+
+		(*req.buffer)[req.object->getObjectId()]=req.code;
+	}
+}
+
+void ModelsDiffHelper::generateRequestedCode(vector<CodeRequest> &requests, atomic<unsigned> &next_req)
+{
+	unsigned idx=0;
+
+	while((idx=next_req++) < requests.size())
+	{
+		CodeRequest &req=requests[idx];
+
+		if(!req.parallel)
+			continue;
+
+		try
+		{
+			req.code=getCodeDefinition(req.object, false);
+		}
+		catch(Exception &e)
+		{
+			req.error=e;
+			req.failed=true;
+		}
+	}
+}
+
+ModelsDiffHelper::CodeRequestWorker::CodeRequestWorker(ModelsDiffHelper *diff_helper, vector<CodeRequest> *requests, atomic<unsigned> *next_req)
+{
+	this->diff_helper=diff_helper;
+	this->requests=requests;
+	this->next_req=next_req;
+}
+
+void ModelsDiffHelper::CodeRequestWorker::run(void)
+{
+	//The pool threads must generate the code using the same PostgreSQL version as the diff thread
+	BaseObject::setThreadPgSQLVersion(diff_helper->pgsql_version);
+	diff_helper->generateRequestedCode(*requests, *next_req);
+	BaseObject::setThreadPgSQLVersion(QString());
+}
+
 QString ModelsDiffHelper::getCodeDefinition(BaseObject *object, bool drop_cmd)
 {
 	try
@@ -975,10 +1102,21 @@ QString ModelsDiffHelper::getCodeDefinition(BaseObject *object, bool drop_cmd)
 		}
 		else
 		{
+			PhysicalTable *table=dynamic_cast<PhysicalTable *>(object);
+			unsigned data_fmt=(table ? table->getInitialDataFormat() : PhysicalTable::InsertDataFormat);
+
+			/* The diff code is usually applied through a connection where COPY ... FROM stdin
+			 * blocks can't be executed so the initial data is always generated as INSERT commands */
+			if(data_fmt!=PhysicalTable::InsertDataFormat)
+				table->setInitialDataFormat(PhysicalTable::InsertDataFormat);
+
 			if(drop_cmd)
 				cmd=object->getDropDefinition(diff_opts[OptCascadeMode]);
 			else
 				cmd=object->getCodeDefinition(SchemaParser::SqlDefinition);
+
+			if(data_fmt!=PhysicalTable::InsertDataFormat)
+				table->setInitialDataFormat(data_fmt);
 		}
 
 		return(cmd);
@@ -26,6 +26,8 @@
 #define MODELS_DIFF_HELPER_H
 
 #include <QObject>
+#include <QRunnable>
+#include <atomic>
 #include "databasemodel.h"
 #include "objectsdiffinfo.h"
 
@@ -57,6 +59,14 @@ class ModelsDiffHelper: public QObject {
 		//! \brief Stores the count of objects to be dropped, changed or created
 		unsigned diffs_counter[4];
 
+		/*! \brief Maximum amount of threads (including the diff thread) used to generate the CREATE commands.
+		 * Zero means QThread::idealThreadCount() (see processCodeRequests()) */
+		int max_threads;
+
+		/*! \brief Indicates that the CREATE commands are generated after processing all diff infos (the default) so
+		 * they can be generated concurrently. When false, they're generated inline in the diff infos order */
+		bool defer_code_gen;
+
 		//! \brief Reference model from which all changes are generated
 		DatabaseModel *source_model,
 
@@ -69,6 +79,36 @@ class ModelsDiffHelper: public QObject {
 		//! \brief Stores all temporary objects created during the diff process
 		vector<BaseObject *> tmp_objects;
 
+		//! \brief Describes a pending CREATE command generation for an object (see processDiffInfos())
+		struct CodeRequest {
+			BaseObject *object;
+
+			//! \brief The commands buffer (indexed by object id) in which the generated code is stored
+			map<unsigned, QString> *buffer;
+
+			/*! \brief Indicates that the code can be generated concurrently to the other requests. This is false
+			 * for table children and relationships since their code touches the parent/related tables */
+			bool parallel;
+
+			QString code;
+
+			//! \brief Stores the error raised during the code generation (if failed is true)
+			Exception error;
+			bool failed;
+		};
+
+		//! \brief Generates the code of parallel requests in a thread pool grabbing the next pending one through a shared counter
+		class CodeRequestWorker: public QRunnable {
+			private:
+				ModelsDiffHelper *diff_helper;
+				vector<CodeRequest> *requests;
+				atomic<unsigned> *next_req;
+
+			public:
+				CodeRequestWorker(ModelsDiffHelper *diff_helper, vector<CodeRequest> *requests, atomic<unsigned> *next_req);
+				void run(void);
+		};
+
 		/*! note The parameter diff_type in any methods below is one of the values in
 		ObjectsDiffInfo::CREATE_OBJECT|ALTER_OBJECT|DROP_OBJECT */
 
@@ -102,6 +142,14 @@ class ModelsDiffHelper: public QObject {
 		will be generated otherwise a CREATE is generated. */
 		QString getCodeDefinition(BaseObject *object, bool drop_cmd);
 
+		//! \brief Generates the code of the parallel requests which indexes are taken from next_req until all of them are handled
+		void generateRequestedCode(vector<CodeRequest> &requests, atomic<unsigned> &next_req);
+
+		/*! \brief Generates the code of all requests storing each one in its buffer by object id. The serial requests are handled first
+		 * in the current thread and the parallel ones are split between the current thread and a pool of workers, all of them generating
+		 * the code under the diff's PostgreSQL version. The first error in the requests order is raised after all of them are handled */
+		void processCodeRequests(vector<CodeRequest> &requests);
+
 		//! \brief Destroy the temporary objects and clears the diff info list
 		void destroyTempObjects(void);
 
@@ -158,6 +206,15 @@ class ModelsDiffHelper: public QObject {
 		//! \brief Configures the PostgreSQL version used in the diff generation
 		void setPgSQLVersion(const QString pgsql_ver);
 
+		/*! \brief Configures the maximum amount of threads used to generate the CREATE commands. One forces the serial generation
+		 * and zero uses the ideal thread count of the system. The generated diff is the same whatever is the amount of threads */
+		void setMaxThreadCount(int count);
+
+		/*! \brief Enables/disables the deferred (and possibly concurrent) generation of the CREATE commands. When disabled the
+		 * commands are generated in the same order the diff infos are processed, interleaved with the DROP and ALTER ones, which is
+		 * the reference ordering the deferred generation must reproduce. This is mainly used to validate the deferred generation */
+		void setDeferredCodeGeneration(bool value);
+
 		//! \brief Returns the count of diff infos of the specified diff_type
 		unsigned getDiffTypeCount(unsigned diff_type);
 
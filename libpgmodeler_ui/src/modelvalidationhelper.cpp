@@ -68,68 +68,13 @@ void  ModelValidationHelper::resolveConflict(ValidationInfo &info)
 	try
 	{
 		vector<BaseObject *> refs=info.getReferences();
-		BaseObject *obj=nullptr;
 
-		//Resolving broken references by swaping the object ids
+		//Resolving broken references by moving the referrer objects (and their dependents) after the referenced ones
 		if(info.getValidationType()==ValidationInfo::BrokenReference ||
 			 info.getValidationType()==ValidationInfo::SpObjBrokenReference)
 		{
-			BaseObject *info_obj=info.getObject(), *aux_obj=nullptr;
-			unsigned obj_id=info_obj->getObjectId();
-
-			if(info.getValidationType()==ValidationInfo::BrokenReference)
-			{
-				//Search for the object with the minor id
-				while(!refs.empty() && !valid_canceled)
-				{
-					//For commom broken reference, check if the object id is greater than the reference id
-					if(obj_id > refs.back()->getObjectId())
-					{
-						obj=refs.back();
-					}
-
-					//Swap the id of the validation object and the found object (minor id)
-					if(obj)
-					{
-						TableObject *tab_obj=dynamic_cast<TableObject *>(obj);
-
-						if(!tab_obj)
-						{
-							BaseObject::swapObjectsIds(info_obj, obj, true);
-							aux_obj=info_obj;
-							emit s_objectIdChanged(obj);
-						}
-						else if(tab_obj && tab_obj->getParentTable()==info_obj)
-						{
-							BaseObject::updateObjectId(tab_obj);
-							emit s_objectIdChanged(tab_obj);
-						}
-					}
-
-					if(aux_obj && BaseTable::isBaseTable(aux_obj->getObjectType()))
-					{
-						vector<BaseRelationship *> base_rels=db_model->getRelationships(dynamic_cast<BaseTable *>(aux_obj));
-						for(auto &rel : base_rels)
-						{
-							if(rel->getObjectId() < aux_obj->getObjectId())
-							{
-								BaseObject::updateObjectId(rel);
-								emit s_objectIdChanged(rel);
-							}
-						}
-					}
-
-					refs.pop_back();
-					obj=nullptr;
-					obj_id=info_obj->getObjectId();
-				}
-			}
-			else
-			{
-				BaseObject::updateObjectId(info_obj);
-			}
-
-			emit s_objectIdChanged(info_obj);
+			vector<ValidationInfo> infos={ info };
+			renumberObjects(infos);
 		}
 		//Resolving no unique name by renaming the constraints/indexes
 		else if(info.getValidationType()==ValidationInfo::NoUniqueName)
@@ -211,6 +156,235 @@ bool ModelValidationHelper::isValidationCanceled(void)
 	return(valid_canceled);
 }
 
+QStringList ModelValidationHelper::getRenumberingReport(void)
+{
+	return(renum_report);
+}
+
+vector<BaseObject *> ModelValidationHelper::getCreationDependents(BaseObject *object, map<BaseObject *, vector<BaseObject *>> &rel_spec_objs)
+{
+	vector<BaseObject *> refs, deps;
+	vector<BaseObject *>::iterator end;
+	BaseObject *dep=nullptr;
+	TableObject *tab_obj=nullptr;
+	Constraint *constr=nullptr;
+	Relationship *rel=nullptr;
+	BaseTable *base_tab=dynamic_cast<BaseTable *>(object);
+
+	db_model->getObjectReferences(object, refs, false, true);
+
+	for(auto &ref : refs)
+	{
+		tab_obj=dynamic_cast<TableObject *>(ref);
+		constr=dynamic_cast<Constraint *>(ref);
+
+		//Foreign keys are always created at the end of the code so they never break the creation order
+		if(constr && constr->getConstraintType()==ConstraintType::ForeignKey)
+			continue;
+
+		//Columns and constraints are created together with their parent tables
+		if(constr || (tab_obj && tab_obj->getObjectType()==ObjectType::Column))
+			dep=tab_obj->getParentTable();
+		else
+			dep=ref;
+
+		deps.push_back(dep);
+	}
+
+	if(base_tab)
+	{
+		for(auto &base_rel : db_model->getRelationships(base_tab))
+		{
+			deps.push_back(base_rel);
+			rel=dynamic_cast<Relationship *>(base_rel);
+
+			//The reference table of generalization/dependency/partitioning must be created before the receiver
+			if(rel && rel->getReferenceTable()==object &&
+				 (rel->getRelationshipType()==Relationship::RelationshipGen ||
+					rel->getRelationshipType()==Relationship::RelationshipDep ||
+					rel->getRelationshipType()==Relationship::RelationshipPart))
+				deps.push_back(rel->getReceiverTable());
+		}
+	}
+	else if(object->getObjectType()==ObjectType::Relationship && rel_spec_objs.count(object))
+		deps.insert(deps.end(), rel_spec_objs[object].begin(), rel_spec_objs[object].end());
+
+	deps.erase(std::remove_if(deps.begin(), deps.end(), [&](BaseObject *obj){
+								 return(!obj || obj==object || obj->isSystemObject());
+							 }), deps.end());
+
+	std::sort(deps.begin(), deps.end());
+	end=std::unique(deps.begin(), deps.end());
+	deps.erase(end, deps.end());
+
+	return(deps);
+}
+
+void ModelValidationHelper::renumberObjects(vector<ValidationInfo> &infos)
+{
+	map<BaseObject *, vector<BaseObject *>> deps, rel_spec_objs;
+	map<BaseObject *, int> in_degree;
+	map<unsigned, BaseObject *> ready;
+	vector<BaseObject *> pending, sorted;
+	vector<TableObject *> *tab_objs=nullptr;
+	vector<Column *> ref_cols;
+	BaseObject *object=nullptr;
+	PhysicalTable *table=nullptr;
+	Constraint *constr=nullptr;
+	unsigned old_id=0;
+
+	//Collecting the objects that must be created after the ones they reference
+	for(auto &info : infos)
+	{
+		if(info.getValidationType()==ValidationInfo::BrokenReference)
+			pending.insert(pending.end(), info.references.begin(), info.references.end());
+		else if(info.getValidationType()==ValidationInfo::SpObjBrokenReference)
+			pending.push_back(info.object);
+	}
+
+	if(pending.empty())
+		return;
+
+	auto map_rel_columns=[&](BaseObject *spec_obj, const vector<Column *> &cols) {
+		vector<BaseObject *> *objs=nullptr;
+
+		for(auto &col : cols)
+		{
+			if(!col || !col->isAddedByRelationship())
+				continue;
+
+			objs=&rel_spec_objs[col->getParentRelationship()];
+
+			if(std::find(objs->begin(), objs->end(), spec_obj)==objs->end())
+				objs->push_back(spec_obj);
+		}
+	};
+
+	/* Mapping each relationship to the special objects (constraints, triggers, indexes, views and generic sql)
+	 * that reference the columns it generates, since those objects must be created after the relationship */
+	for(auto &obj_type : { ObjectType::Table, ObjectType::ForeignTable, ObjectType::View, ObjectType::GenericSql })
+	{
+		for(auto &obj : *db_model->getObjectList(obj_type))
+		{
+			if(obj_type==ObjectType::View)
+				map_rel_columns(obj, dynamic_cast<View *>(obj)->getRelationshipAddedColumns());
+			else if(obj_type==ObjectType::GenericSql)
+			{
+				ref_cols.clear();
+
+				for(auto &ref_obj : dynamic_cast<GenericSQL *>(obj)->getReferencedObjects())
+					ref_cols.push_back(dynamic_cast<Column *>(ref_obj));
+
+				map_rel_columns(obj, ref_cols);
+			}
+			else
+			{
+				table=dynamic_cast<PhysicalTable *>(obj);
+
+				for(auto &tab_obj_type : { ObjectType::Constraint, ObjectType::Trigger, ObjectType::Index })
+				{
+					tab_objs=table->getObjectList(tab_obj_type);
+					if(!tab_objs) continue;
+
+					for(auto &tab_obj : *tab_objs)
+					{
+						if(tab_obj->isAddedByRelationship())
+							continue;
+
+						if(tab_obj_type==ObjectType::Constraint)
+						{
+							constr=dynamic_cast<Constraint *>(tab_obj);
+
+							if(constr->getConstraintType()!=ConstraintType::PrimaryKey)
+								map_rel_columns(tab_obj, constr->getRelationshipAddedColumns());
+						}
+						else if(tab_obj_type==ObjectType::Trigger)
+							map_rel_columns(tab_obj, dynamic_cast<Trigger *>(tab_obj)->getRelationshipAddedColumns());
+						else
+							map_rel_columns(tab_obj, dynamic_cast<Index *>(tab_obj)->getRelationshipAddedColumns());
+					}
+				}
+			}
+		}
+	}
+
+	/* Computing the closure of the objects to be renumbered: the ones breaking references plus everything
+	 * that transitively must be created after them. Objects out of this set keep their ids since the new
+	 * ids are always greater than the current ones */
+	while(!pending.empty() && !valid_canceled)
+	{
+		object=pending.back();
+		pending.pop_back();
+
+		if(!object || object->isSystemObject() || deps.count(object))
+			continue;
+
+		deps[object]=getCreationDependents(object, rel_spec_objs);
+		in_degree[object]=0;
+		pending.insert(pending.end(), deps[object].begin(), deps[object].end());
+	}
+
+	if(valid_canceled)
+		return;
+
+	for(auto &itr : deps)
+	{
+		for(auto &dep : itr.second)
+			in_degree[dep]++;
+	}
+
+	for(auto &itr : in_degree)
+	{
+		if(itr.second==0)
+			ready[itr.first->getObjectId()]=itr.first;
+	}
+
+	/* Sorting the objects topologically. Ties are resolved by the current ids so the relative
+	 * creation order of independent objects is preserved */
+	while(sorted.size() < deps.size())
+	{
+		/* If there're no objects free of dependencies a cycle was found. In that case the
+		 * object with the smallest id is forced into the list in order to break the cycle */
+		if(ready.empty())
+		{
+			object=nullptr;
+
+			for(auto &itr : in_degree)
+			{
+				if(itr.second > 0 && (!object || itr.first->getObjectId() < object->getObjectId()))
+					object=itr.first;
+			}
+
+			in_degree[object]=0;
+			ready[object->getObjectId()]=object;
+		}
+
+		object=ready.begin()->second;
+		ready.erase(ready.begin());
+		in_degree[object]=-1;
+		sorted.push_back(object);
+
+		for(auto &dep : deps[object])
+		{
+			if(in_degree[dep] > 0 && --in_degree[dep]==0)
+				ready[dep->getObjectId()]=dep;
+		}
+	}
+
+	//Applying the new ids only after the whole assignment is computed
+	for(auto &obj : sorted)
+	{
+		old_id=obj->getObjectId();
+		BaseObject::updateObjectId(obj);
+		renum_report.push_back(QString("%1 (%2): %3 -> %4")
+													 .arg(obj->getSignature().remove('"'))
+													 .arg(obj->getTypeName())
+													 .arg(old_id)
+													 .arg(obj->getObjectId()));
+		emit s_objectIdChanged(obj);
+	}
+}
+
 unsigned ModelValidationHelper::getWarningCount(void)
 {
 	return(warn_count);
@@ -240,6 +414,7 @@ void ModelValidationHelper::setValidationParams(DatabaseModel *model, Connection
 	valid_canceled=false;
 	val_infos.clear();
 	inv_rels.clear();
+	renum_report.clear();
 	this->db_model=model;
 	this->conn=conn;
 	this->pgsql_ver=pgsql_ver;
@@ -633,9 +808,16 @@ void ModelValidationHelper::applyFixes(void)
 	if(fix_mode)
 	{
 		bool validate_rels=false, found_broken_rels=false;
+		unsigned val_type;
+
+		renum_report.clear();
 
 		while(!val_infos.empty() && !valid_canceled && !found_broken_rels)
 		{
+			/* All the broken references are fixed at once by a single renumbering pass so
+			 * the next validation cycle doesn't detect them again */
+			renumberObjects(val_infos);
+
 			for(unsigned i=0; i < val_infos.size() && !valid_canceled; i++)
 			{
 				if(!validate_rels)
@@ -649,7 +831,11 @@ void ModelValidationHelper::applyFixes(void)
 				if(!found_broken_rels)
 					found_broken_rels=(val_infos[i].getValidationType()==ValidationInfo::BrokenRelConfig);
 
-				if(!valid_canceled)
+				val_type=val_infos[i].getValidationType();
+
+				if(!valid_canceled &&
+					 val_type!=ValidationInfo::BrokenReference &&
+					 val_type!=ValidationInfo::SpObjBrokenReference)
 					resolveConflict(val_infos[i]);
 			}
 
@@ -70,8 +70,24 @@ class ModelValidationHelper: public QObject {
 		//! \brief Stores the analyzed relationship marked as invalidated
 		vector<BaseObject *> inv_rels;
 
+		/*! \brief Stores a human readable entry for each object renumbered by the last fix run
+		in the form "name (type): old id -> new id" */
+		QStringList renum_report;
+
 		void generateValidationInfo(unsigned val_type, BaseObject *object, vector<BaseObject *> refs);
 
+		/*! \brief Returns the objects that must be created after the provided one. Referrer columns and constraints
+		are replaced by their parent tables (foreign keys are ignored since they are always created at the end of the code)
+		and the generalization/dependency/partitioning receiver tables and the table's relationships are included as well.
+		The rel_spec_objs map relates a relationship to the special objects referencing the columns it generates */
+		vector<BaseObject *> getCreationDependents(BaseObject *object, map<BaseObject *, vector<BaseObject *>> &rel_spec_objs);
+
+		/*! \brief Fixes all the broken references (BrokenReference and SpObjBrokenReference) in the provided infos at once.
+		The objects that must be created after the referenced ones, as well as everything that transitively depends on them,
+		are sorted topologically and receive new ascending ids in that order. The whole assignment is computed before any id
+		is touched so the model is never left in an intermediate state. The renumbered objects are stored in the report */
+		void renumberObjects(vector<ValidationInfo> &infos);
+
 	public:
 		ModelValidationHelper(void);
 		~ModelValidationHelper(void);
@@ -97,6 +113,9 @@ class ModelValidationHelper: public QObject {
 
 		bool isValidationCanceled(void);
 
+		//! \brief Returns the list of objects renumbered during the last fix run
+		QStringList getRenumberingReport(void);
+
 	private slots:
 		void redirectExportProgress(int prog, QString msg, ObjectType obj_type, QString cmd, bool is_code_gen);
 		void captureThreadError(Exception e);
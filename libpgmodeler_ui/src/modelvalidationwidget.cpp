@@ -127,6 +127,7 @@ void ModelValidationWidget::createThread(void)
 		connect(validation_thread, SIGNAL(started(void)), validation_helper, SLOT(validateModel(void)));
 		connect(validation_thread, SIGNAL(started(void)), validation_helper, SLOT(applyFixes(void)));
 		connect(validation_thread, SIGNAL(finished(void)), this, SLOT(updateGraphicalObjects(void)));
+		connect(validation_thread, SIGNAL(finished(void)), this, SLOT(showRenumberingReport(void)));
 		connect(validation_thread, SIGNAL(finished(void)), this, SLOT(destroyThread(void)));
 
 		connect(validation_helper, SIGNAL(s_validationInfoGenerated(ValidationInfo)), this, SLOT(updateValidation(ValidationInfo)), Qt::QueuedConnection);
@@ -618,6 +619,24 @@ void ModelValidationWidget::updateGraphicalObjects(void)
 	}
 }
 
+void ModelValidationWidget::showRenumberingReport(void)
+{
+	QStringList report=validation_helper->getRenumberingReport();
+	QTreeWidgetItem *item=nullptr;
+
+	if(report.isEmpty() || validation_helper->isInFixMode())
+		return;
+
+	item=PgModelerUiNs::createOutputTreeItem(output_trw, trUtf8("<strong>%1</strong> object(s) had their ids renumbered in order to fix the creation order.").arg(report.size()),
+																					 QPixmap(PgModelerUiNs::getIconPath("msgbox_info")), nullptr, false, true);
+
+	for(auto &entry : report)
+		PgModelerUiNs::createOutputTreeItem(output_trw, entry, QPixmap(), item, false);
+
+	item->setExpanded(false);
+	clear_btn->setEnabled(true);
+}
+
 void ModelValidationWidget::editConnections(void)
 {
 	if(connections_cmb->currentIndex()==connections_cmb->count()-1)
@@ -95,6 +95,9 @@ class ModelValidationWidget: public QWidget, public Ui::ModelValidationWidget {
 		void validateRelationships(void);
 		void destroyThread(bool force=false);
 		void updateGraphicalObjects(void);
+
+		//! \brief Lists the objects renumbered by the validator while applying fixes
+		void showRenumberingReport(void);
 		void editConnections(void);
 		void handleSQLValidationStarted(void);
 		void swapObjectsIds(void);
@@ -18,6 +18,7 @@
 
 #include "baseform.h"
 #include "modelwidget.h"
+#include "modelprinthelper.h"
 #include "sourcecodewidget.h"
 #include "databasewidget.h"
 #include "schemawidget.h"
@@ -54,6 +55,7 @@
 #include "eventtriggerwidget.h"
 #include "pgmodeleruins.h"
 #include "swapobjectsidswidget.h"
+#include "memoryusagewidget.h"
 #include "genericsqlwidget.h"
 #include "policywidget.h"
 #include "tabledatawidget.h"
@@ -93,6 +95,7 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 																																		 ObjectType::BaseRelationship});
 
 	current_zoom=1;
+	objs_changes=0;
 	modified=panning_mode=false;
 	new_obj_type=ObjectType::BaseObject;
 
@@ -139,6 +142,9 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	protected_model_frm->setLayout(grid);
 	protected_model_frm->adjustSize();
 
+	load_thread=nullptr;
+	load_helper=nullptr;
+
 	db_model=new DatabaseModel(this);
 	xmlparser=db_model->getXMLParser();
 	op_list=new OperationList(db_model);
@@ -207,6 +213,8 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	zoom_info_lbl->adjustSize();
 	zoom_info_lbl->setVisible(false);
 	zoom_info_timer.setInterval(3000);
+	bundles_timer.setSingleShot(true);
+	bundles_timer.setInterval(0);
 
 	action_edit_data=new QAction(QIcon(PgModelerUiNs::getIconPath("editdata")), trUtf8("Edit data"), this);
 
@@ -333,6 +341,13 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	toggle_sch_rects_menu.addAction(action_hide_schemas_rects);
 	action_schemas_rects->setMenu(&toggle_sch_rects_menu);
 
+	action_schemas_collapse=new QAction(QIcon(PgModelerUiNs::getIconPath("collapse")), trUtf8("Schemas contents"), this);
+	action_collapse_schemas=new QAction(trUtf8("Collapse"), this);
+	action_expand_schemas=new QAction(trUtf8("Expand"), this);
+	toggle_sch_collapse_menu.addAction(action_collapse_schemas);
+	toggle_sch_collapse_menu.addAction(action_expand_schemas);
+	action_schemas_collapse->setMenu(&toggle_sch_collapse_menu);
+
 	action_fade=new QAction(QIcon(PgModelerUiNs::getIconPath("fade")), trUtf8("Fade in/out"), this);
 	action_fade_in=new QAction(QIcon(PgModelerUiNs::getIconPath("fadein")), trUtf8("Fade in"), this);
 	action_fade_out=new QAction(QIcon(PgModelerUiNs::getIconPath("fadeout")), trUtf8("Fade out"), this);
@@ -354,6 +369,10 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	action_edit_creation_order->setToolTip(trUtf8("Edit the objects creation order by swapping their ids"));
 	connect(action_edit_creation_order, SIGNAL(triggered(bool)), this, SLOT(swapObjectsIds()));
 
+	action_memory_usage=new QAction(QIcon(PgModelerUiNs::getIconPath("msgbox_info")), trUtf8("Memory usage"), this);
+	action_memory_usage->setToolTip(trUtf8("Show the estimated memory usage of the model"));
+	connect(action_memory_usage, SIGNAL(triggered(bool)), this, SLOT(showMemoryUsage()));
+
 	action=new QAction(QIcon(PgModelerUiNs::getIconPath("breakline_90dv")), trUtf8("90° (vertical)"), this);
 	connect(action, SIGNAL(triggered(bool)), this, SLOT(breakRelationshipLine(void)));
 	action->setData(QVariant::fromValue<unsigned>(BreakVertNinetyDegrees));
@@ -483,6 +502,9 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	connect(action_no_collapse_attribs, SIGNAL(triggered(bool)), this, SLOT(setCollapseMode()));
 	connect(action_show_schemas_rects, SIGNAL(triggered(bool)), this, SLOT(toggleSchemasRectangles()));
 	connect(action_hide_schemas_rects, SIGNAL(triggered(bool)), this, SLOT(toggleSchemasRectangles()));
+	connect(action_collapse_schemas, SIGNAL(triggered(bool)), this, SLOT(toggleSchemasCollapse()));
+	connect(action_expand_schemas, SIGNAL(triggered(bool)), this, SLOT(toggleSchemasCollapse()));
+	connect(&bundles_timer, &QTimer::timeout, [&](){ updateRelationshipBundles(); });
 	connect(db_model, SIGNAL(s_objectAdded(BaseObject*)), this, SLOT(handleObjectAddition(BaseObject *)));
 	connect(db_model, SIGNAL(s_objectRemoved(BaseObject*)), this, SLOT(handleObjectRemoval(BaseObject *)));
 	connect(scene, SIGNAL(s_objectsMoved(bool)), this, SLOT(handleObjectsMovement(bool)));
@@ -523,6 +545,10 @@ ModelWidget::~ModelWidget(void)
 		cutted_objects.clear();
 	}
 
+	//The model can't be destroyed while a thread is creating objects on it
+	if(load_thread)
+		destroyLoadThread();
+
 	popup_menu.clear();
 	new_object_menu.clear();
 	quick_actions_menu.clear();
@@ -531,6 +557,10 @@ ModelWidget::~ModelWidget(void)
 	tags_menu.clear();
 	break_rel_menu.clear();
 
+	bundles_timer.stop();
+	qDeleteAll(rel_bundles);
+	rel_bundles.clear();
+
 	delete(viewport);
 	delete(scene);
 	delete(op_list);
@@ -795,7 +825,16 @@ void ModelWidget::handleObjectAddition(BaseObject *object)
 {
 	BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(object);
 
-	if(graph_obj)
+	objs_changes++;
+
+	/* Tables, views and relationships attached to collapsed schemas have no graphical representation,
+	 * they are represented by the schema box and by the relationship bundles */
+	if(graph_obj && SchemaView::isObjectCollapsed(graph_obj))
+	{
+		bundles_timer.start();
+		this->modified=true;
+	}
+	else if(graph_obj)
 	{
 		ObjectType obj_type=graph_obj->getObjectType();
 		QGraphicsItem *item=nullptr;
@@ -915,6 +954,8 @@ void ModelWidget::handleObjectRemoval(BaseObject *object)
 {
 	BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(object);
 
+	objs_changes++;
+
 	if(graph_obj)
 	{
 		scene->removeItem(dynamic_cast<QGraphicsItem *>(graph_obj->getOverlyingObject()));
@@ -923,6 +964,11 @@ void ModelWidget::handleObjectRemoval(BaseObject *object)
 		if(graph_obj->getSchema() &&
 				(graph_obj->getObjectType()==ObjectType::Table || graph_obj->getObjectType()==ObjectType::View))
 			dynamic_cast<Schema *>(graph_obj->getSchema())->setModified(true);
+
+		//The bundles may reference the removed object (or the relationships connected to it)
+		if(!rel_bundles.empty() &&
+			 (BaseTable::isBaseTable(graph_obj->getObjectType()) || dynamic_cast<BaseRelationship *>(graph_obj)))
+			bundles_timer.start();
 	}
 
 	this->modified=true;
@@ -940,9 +986,9 @@ void ModelWidget::handleObjectsMovement(bool end_moviment)
 {
 	vector<BaseObject *>::iterator itr, itr_end;
 	vector<BaseObject *> reg_tables;
-	QList<BaseObjectView *> tables;
 	BaseGraphicObject *obj=nullptr;
 	Schema *schema=nullptr;
+	SchemaView *sch_view=nullptr;
 
 	itr=selected_objects.begin();
 	itr_end=selected_objects.end();
@@ -966,22 +1012,31 @@ void ModelWidget::handleObjectsMovement(bool end_moviment)
 					op_list->registerObject(obj, Operation::ObjectMoved);
 				else if(schema)
 				{
-					//For schemas, when they are moved, the original position of tables are registered instead of the position of schema itself
-					tables=dynamic_cast<SchemaView *>(schema->getOverlyingObject())->getChildren();
-					for(auto &tab : tables)
+					sch_view=dynamic_cast<SchemaView *>(schema->getOverlyingObject());
+					if(!sch_view) continue;
+
+					/* For schemas, when they are moved, the original position of tables are registered instead of the position of schema itself.
+					 * The children objects are retrieved from the model since tables of collapsed schemas have no graphical representation */
+					for(auto &tab : sch_view->getChildrenObjects())
 					{
-						op_list->registerObject(tab->getUnderlyingObject(), Operation::ObjectMoved);
+						op_list->registerObject(tab, Operation::ObjectMoved);
 
 						//Registers the table on a auxiliary list to avoid multiple registration on operation history
-						reg_tables.push_back(tab->getUnderlyingObject());
+						reg_tables.push_back(tab);
 					}
+
+					/* The custom points of the relationships between the children of a collapsed schema
+					 * are translated directly in the model so they need to be registered as well */
+					for(auto &rel : sch_view->getInnerRelationships())
+						op_list->registerObject(rel, Operation::ObjectModified);
 				}
 			}			
 		}
 	}
 	else
 	{
-		vector<Schema *> schemas;
+		vector<SchemaView *> sch_views;
+		BaseObjectView *obj_view=nullptr;
 
 		while(itr!=itr_end)
 		{
@@ -989,21 +1044,27 @@ void ModelWidget::handleObjectsMovement(bool end_moviment)
 			itr++;
 			if(!obj) continue;
 
-			if(BaseTable::isBaseTable(obj->getObjectType()))
+			obj_view=dynamic_cast<BaseObjectView *>(obj->getOverlyingObject());
+
+			if(BaseTable::isBaseTable(obj->getObjectType()) && obj_view)
 			{
-				Schema *schema=dynamic_cast<Schema *>(dynamic_cast<BaseTable *>(obj)->getSchema());
+				schema=dynamic_cast<Schema *>(dynamic_cast<BaseTable *>(obj)->getSchema());
+				sch_view=dynamic_cast<SchemaView *>(schema->getOverlyingObject());
+				if(!sch_view) continue;
 
-				//Update the schema if this isn't done yet
-				if(std::find(schemas.begin(),schemas.end(),schema)==schemas.end())
-				{
-					schema->setModified(true);
+				/* Only the geometry of the moved table is updated in the schema box. The schema's children
+				 * are fetched again only when objects are added, removed or moved to another schema */
+				sch_view->updateChildGeometry(obj_view);
 
-					//Insert the updated schema to a list to avoid a second (unnecessary) update
-					schemas.push_back(schema);
-				}
+				//Insert the updated schema to a list to avoid a second (unnecessary) refresh
+				if(std::find(sch_views.begin(), sch_views.end(), sch_view)==sch_views.end())
+					sch_views.push_back(sch_view);
 			}
 		}
 
+		for(auto &view : sch_views)
+			view->refreshBox();
+
 		op_list->finishOperationChain();
 		this->modified=true;
 
@@ -1094,9 +1155,10 @@ void ModelWidget::configureObjectSelection(void)
 				BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(selected_objects[0]);
 				BaseObjectView *object=dynamic_cast<BaseObjectView *>(graph_obj->getOverlyingObject());
 
-				scene->showRelationshipLine(true,
-																		QPointF(object->scenePos().x() + object->boundingRect().width()/2,
-																						object->scenePos().y() + object->boundingRect().height()/2));
+				if(object)
+					scene->showRelationshipLine(true,
+																			QPointF(object->scenePos().x() + object->boundingRect().width()/2,
+																							object->scenePos().y() + object->boundingRect().height()/2));
 			}
 			//If the user has selected object that are not tables, cancel the operation
 			else if(!PhysicalTable::isPhysicalTable(obj_type1) || (!PhysicalTable::isPhysicalTable(obj_type2) && obj_type2 != ObjectType::BaseObject))
@@ -1405,20 +1467,8 @@ void ModelWidget::loadModel(const QString &filename)
 
 		db_model->loadModel(filename);
 		this->filename=filename;
-		this->adjustSceneSize();
-		this->updateObjectsOpacity();
-
-		scene->blockSignals(true);
-
-		for(auto &layer : db_model->getLayers())
-			scene->addLayer(layer);
-
-		scene->setActiveLayers(db_model->getActiveLayers());
-		scene->blockSignals(false);
-
+		configureLoadedModel();
 		task_prog_wgt.close();
-		protected_model_frm->setVisible(db_model->isProtected());
-		this->modified=false;
 	}
 	catch(Exception &e)
 	{
@@ -1428,6 +1478,104 @@ void ModelWidget::loadModel(const QString &filename)
 	}
 }
 
+void ModelWidget::configureLoadedModel(void)
+{
+	this->adjustSceneSize();
+	this->updateObjectsOpacity();
+
+	scene->blockSignals(true);
+
+	for(auto &layer : db_model->getLayers())
+		scene->addLayer(layer);
+
+	scene->setActiveLayers(db_model->getActiveLayers());
+	scene->blockSignals(false);
+
+	this->updateRelationshipBundles();
+	protected_model_frm->setVisible(db_model->isProtected());
+	this->modified=false;
+}
+
+void ModelWidget::loadModelInBackground(const QString &filename)
+{
+	if(load_thread)
+		return;
+
+	load_thread=new QThread;
+	load_helper=new ModelLoadHelper;
+	load_helper->setLoadParams(db_model, filename);
+	load_helper->moveToThread(load_thread);
+
+	connect(load_thread, SIGNAL(started(void)), load_helper, SLOT(loadModel(void)));
+	connect(load_helper, SIGNAL(s_loadFinished(void)), this, SLOT(finishModelLoading(void)), Qt::QueuedConnection);
+	connect(load_helper, SIGNAL(s_loadAborted(Exception)), this, SLOT(abortModelLoading(Exception)), Qt::QueuedConnection);
+
+	/* The signals of the model are blocked while loading since the graphical objects
+	 * can only be created in the main thread. They are created all at once in finishModelLoading() */
+	db_model->blockSignals(true);
+	this->filename=filename;
+	load_thread->start();
+}
+
+bool ModelWidget::isLoadingModel(void)
+{
+	return(load_thread!=nullptr);
+}
+
+void ModelWidget::destroyLoadThread(void)
+{
+	load_thread->quit();
+	load_thread->wait();
+	delete(load_thread);
+	delete(load_helper);
+	load_thread=nullptr;
+	load_helper=nullptr;
+	db_model->blockSignals(false);
+}
+
+void ModelWidget::finishModelLoading(void)
+{
+	vector<ObjectType> types={ ObjectType::Schema, ObjectType::Table, ObjectType::ForeignTable, ObjectType::View,
+														 ObjectType::Textbox, ObjectType::Relationship, ObjectType::BaseRelationship };
+	BaseGraphicObject *graph_obj=nullptr;
+
+	destroyLoadThread();
+
+	try
+	{
+		/* Creating the graphical objects in the same order they would be created during a regular loading
+		 * (schemas, tables and then relationships) skipping the ones already on the scene (system objects) */
+		for(auto &type : types)
+		{
+			for(auto &obj : *db_model->getObjectList(type))
+			{
+				graph_obj=dynamic_cast<BaseGraphicObject *>(obj);
+
+				if(!graph_obj->getOverlyingObject())
+					handleObjectAddition(graph_obj);
+			}
+		}
+
+		//Forcing the update of the schemas rectangles and relationships labels
+		db_model->setObjectsModified();
+		configureLoadedModel();
+		emit s_modelLoaded();
+	}
+	catch(Exception &e)
+	{
+		this->filename.clear();
+		emit s_modelLoadAborted(Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
+	}
+}
+
+void ModelWidget::abortModelLoading(Exception e)
+{
+	destroyLoadThread();
+	this->filename.clear();
+	this->modified=false;
+	emit s_modelLoadAborted(e);
+}
+
 void ModelWidget::adjustSceneSize(void)
 {
 	QRectF scene_rect, objs_rect;
@@ -1455,147 +1603,73 @@ void ModelWidget::adjustSceneSize(void)
 
 void ModelWidget::printModel(QPrinter *printer, bool print_grid, bool print_page_nums)
 {
-	if(printer)
-	{
-		bool show_grid, align_objs, show_delims;
-		unsigned page_cnt, page, h_page_cnt, v_page_cnt, h_pg_id, v_pg_id;
-		vector<QRectF> pages;
-		QRectF margins;
-		QPrinter::PaperSize paper_size_id;
-		QPrinter::Orientation orient;
-		QSizeF paper_size, custom_p_size;
-		QSize page_size;
-		QPen pen;
-		QFont font;
-		QPointF top_left, top_right, bottom_left, bottom_right,
-				h_top_mid, h_bottom_mid, v_left_mid, v_right_mid, dx, dy, dx1, dy1;
-
-		//Make a backup of the current grid options
-		show_grid = ObjectsScene::isShowGrid();
-		align_objs = ObjectsScene::isAlignObjectsToGrid();
-		show_delims = ObjectsScene::isShowPageDelimiters();
-
-		//Reconfigure the grid options based upon the passed settings
-		ObjectsScene::setGridOptions(print_grid, align_objs, false);
-
-		scene->update();
-		scene->clearSelection();
-
-		//Get the page size based on the printer settings
-		ObjectsScene::getPaperConfiguration(paper_size_id, orient, margins, custom_p_size);
-		paper_size=printer->paperSize(QPrinter::Point);
-
-		if(paper_size_id!=QPrinter::Custom)
-			paper_size-=margins.size();
-
-		//Get the pages rect for printing
-		pages=scene->getPagesForPrinting(paper_size, margins.size(), h_page_cnt, v_page_cnt);
-		page_size=printer->pageRect().size();
-
-		//Creates a painter to draw the model directly on the printer
-		QPainter painter(printer);
-		painter.setRenderHint(QPainter::Antialiasing);
-		font.setPointSizeF(7.5);
-		pen.setColor(QColor(120,120,120));
-		pen.setWidthF(1.0);
-
-		//Calculates the auxiliary points to draw the page delimiter lines
-		top_left.setX(0); top_left.setY(0);
-		top_right.setX(page_size.width()); top_right.setY(0);
-
-		bottom_left.setX(0); bottom_left.setY(page_size.height());
-		bottom_right.setX(top_right.x()); bottom_right.setY(bottom_left.y());
-
-		h_top_mid.setX(page_size.width()/2); h_top_mid.setY(0);
-		h_bottom_mid.setX(h_top_mid.x()); h_bottom_mid.setY(bottom_right.y());
-
-		v_left_mid.setX(top_left.x()); v_left_mid.setY(page_size.height()/2);
-		v_right_mid.setX(top_right.x()); v_right_mid.setY(v_left_mid.y());
-
-		dx.setX(margins.left());
-		dx1.setX(margins.width());
-		dy.setY(margins.top());
-		dy1.setY(margins.height());
-
-		page_cnt=pages.size();
-		for(page=0, h_pg_id=0, v_pg_id=0; page < page_cnt; page++)
-		{
-			//Render the current page on the printer
-			scene->render(&painter, QRect(), pages[page]);
-
-			//Print the current page number is this option is marked
-			if(print_page_nums)
-			{
-				painter.setPen(QColor(120,120,120));
-				painter.drawText(-margins.left(), -margins.top(), QString("%1").arg(page+1));
-			}
-
-			//Print the guide lines at corners of the page
-			painter.setPen(pen);
-			if(h_pg_id==0 && v_pg_id==0)
-			{
-				painter.drawLine(top_left, top_left + dx);
-				painter.drawLine(top_left, top_left + dy);
-			}
-
-			if(h_pg_id==h_page_cnt-1 && v_pg_id==0)
-			{
-				painter.drawLine(top_right, top_right - dx1);
-				painter.drawLine(top_right, top_right + dy);
-			}
-
-			if(h_pg_id==0 && v_pg_id==v_page_cnt-1)
-			{
-				painter.drawLine(bottom_left, bottom_left + dx);
-				painter.drawLine(bottom_left, bottom_left - dy1);
-			}
-
-			if(h_pg_id==h_page_cnt-1 && v_pg_id==v_page_cnt-1)
-			{
-				painter.drawLine(bottom_right, bottom_right - dx1);
-				painter.drawLine(bottom_right, bottom_right - dy1);
-			}
+	if(!printer)
+		return;
 
-			if(h_pg_id >=1 && h_pg_id < h_page_cnt-1 && v_pg_id==0)
-			{
-				painter.drawLine(h_top_mid, h_top_mid - dx1);
-				painter.drawLine(h_top_mid, h_top_mid + dx);
-			}
+	ModelPrintHelper print_hlp;
+	QThread print_thread;
+	QEventLoop event_loop;
+	QProgressDialog progress_dlg(this);
+	Exception error;
+	bool aborted=false;
 
-			if(h_pg_id >=1 && h_pg_id < h_page_cnt-1 && v_pg_id==v_page_cnt-1)
-			{
-				painter.drawLine(h_bottom_mid, h_bottom_mid - dx1);
-				painter.drawLine(h_bottom_mid, h_bottom_mid + dx);
-			}
+	try
+	{
+		print_hlp.setPrintParams(scene, printer, print_grid, print_page_nums);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
 
-			if(v_pg_id >=1 && v_pg_id < v_page_cnt-1 && h_pg_id==0)
-			{
-				painter.drawLine(v_left_mid, v_left_mid - dy1);
-				painter.drawLine(v_left_mid, v_left_mid + dy);
-			}
+	/* The progress dialog is modal so the model can't be changed while its pages are recorded
+	 * (see ModelPrintHelper::takeSnapshots) which keeps the printed pages consistent */
+	progress_dlg.setWindowTitle(trUtf8("Database model printing"));
+	progress_dlg.setLabelText(trUtf8("Printing <strong>%1</strong> page(s)...").arg(print_hlp.getPageCount()));
+	progress_dlg.setWindowModality(Qt::ApplicationModal);
+	progress_dlg.setRange(0, 100);
+	progress_dlg.setMinimumDuration(0);
+	progress_dlg.setAutoClose(false);
+	progress_dlg.setAutoReset(false);
+
+	print_hlp.moveToThread(&print_thread);
+
+	/* The thread is finished directly by the helper and the local event loop is
+	 * stopped as soon as the thread finishes, whatever the printing result */
+	connect(&print_thread, SIGNAL(started()), &print_hlp, SLOT(printPages()));
+	connect(&print_hlp, SIGNAL(s_printingFinished(int,qint64)), &print_thread, SLOT(quit()), Qt::DirectConnection);
+	connect(&print_hlp, SIGNAL(s_printingCanceled()), &print_thread, SLOT(quit()), Qt::DirectConnection);
+	connect(&print_hlp, SIGNAL(s_printingAborted(Exception)), &print_thread, SLOT(quit()), Qt::DirectConnection);
+	connect(&print_thread, SIGNAL(finished()), &event_loop, SLOT(quit()), Qt::QueuedConnection);
+
+	connect(&print_hlp, &ModelPrintHelper::s_printingAborted, [&error, &aborted](Exception e){
+		error=e;
+		aborted=true;
+	});
 
-			if(v_pg_id >=1 && v_pg_id < v_page_cnt-1 && h_pg_id==h_page_cnt-1)
-			{
-				painter.drawLine(v_right_mid, v_right_mid - dy1);
-				painter.drawLine(v_right_mid, v_right_mid + dy);
-			}
+	//The progress dialog is used as context so the queued calls are discarded when it's destroyed
+	connect(&print_hlp, &ModelPrintHelper::s_snapshotsRequested, &progress_dlg, [&print_hlp](){
+		print_hlp.takeSnapshots();
+	});
 
-			h_pg_id++;
+	connect(&print_hlp, &ModelPrintHelper::s_progressUpdated, &progress_dlg, [&progress_dlg](int progress, QString msg){
+		progress_dlg.setValue(progress);
+		progress_dlg.setLabelText(msg);
+	});
 
-			if(h_pg_id==h_page_cnt)
-			{
-				h_pg_id=0;
-				v_pg_id++;
-			}
+	connect(&progress_dlg, &QProgressDialog::canceled, [&print_hlp](){
+		print_hlp.cancelPrinting();
+	});
 
-			if(page < page_cnt-1)
-				printer->newPage();
-		}
+	progress_dlg.show();
+	print_thread.start();
+	print_hlp.takeSnapshots();
+	event_loop.exec();
+	print_thread.wait();
+	progress_dlg.close();
 
-		//Restore the grid option backup
-		ObjectsScene::setGridOptions(show_grid, align_objs, show_delims);
-		scene->update();
-	}
+	if(aborted)
+		throw Exception(error.getErrorMessage(), error.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &error);
 }
 
 void ModelWidget::updateRenderHints(void)
@@ -1916,6 +1990,14 @@ void ModelWidget::showObjectForm(ObjectType obj_type, BaseObject *object, BaseOb
 
 		if(res==QDialog::Accepted)
 		{
+			BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(object);
+
+			/* Tables/views moved to a collapsed schema via editing form lose their graphical representation
+			 * and the ones moved out of a collapsed schema need to have it recreated */
+			if(graph_obj && BaseTable::isBaseTable(graph_obj->getObjectType()) &&
+				 SchemaView::isObjectCollapsed(graph_obj)==(graph_obj->getOverlyingObject()!=nullptr))
+				updateCollapsedSchemas();
+
 			this->modified=true;
 			this->db_model->setInvalidated(true);
 			emit s_objectManipulated();
@@ -2006,8 +2088,11 @@ void ModelWidget::moveToSchema(void)
 	QAction *act=dynamic_cast<QAction *>(sender());
 	Schema *schema=dynamic_cast<Schema *>(reinterpret_cast<BaseObject *>(act->data().value<void *>()));
 	BaseGraphicObject *obj_graph=nullptr;
+	BaseObjectView *obj_view=nullptr;
+	Schema *src_schema=nullptr;
 	vector<BaseObject *> ref_objs;
 	int op_id=-1, op_curr_idx=op_list->getCurrentIndex();
+	bool upd_collapsed=schema->isCollapsed();
 
 	try
 	{
@@ -2022,6 +2107,11 @@ void ModelWidget::moveToSchema(void)
 			{
 				op_id=op_list->registerObject(obj, Operation::ObjectModified, -1);
 
+				src_schema=dynamic_cast<Schema *>(obj->getSchema());
+
+				if(src_schema && src_schema->isCollapsed())
+					upd_collapsed=true;
+
 				obj->setSchema(schema);
 				obj_graph=dynamic_cast<BaseGraphicObject *>(obj);
 
@@ -2035,7 +2125,14 @@ void ModelWidget::moveToSchema(void)
 					{
 						p.setX(dst_schema->pos().x());
 						p.setY(dst_schema->pos().y() + dst_schema->boundingRect().height() + BaseObjectView::VertSpacing);
-						dynamic_cast<BaseObjectView *>(obj_graph->getOverlyingObject())->setPos(p);
+						obj_view=dynamic_cast<BaseObjectView *>(obj_graph->getOverlyingObject());
+
+						/* Objects coming from a collapsed schema have no graphical representation
+						 * so only their positions are changed, the views are created further */
+						if(obj_view)
+							obj_view->setPos(p);
+						else
+							obj_graph->setPosition(p);
 					}
 				}
 
@@ -2048,6 +2145,12 @@ void ModelWidget::moveToSchema(void)
 		}
 
 		op_list->finishOperationChain();
+
+		/* Objects moved to a collapsed schema lose their graphical representation and
+		 * the ones moved out of a collapsed schema need to have it recreated */
+		if(upd_collapsed)
+			updateCollapsedSchemas();
+
 		db_model->setObjectsModified();
 		this->setModified(true);
 
@@ -2070,12 +2173,18 @@ void ModelWidget::moveToLayer(void)
 {
 	QAction *act = dynamic_cast<QAction *>(sender());
 	BaseGraphicObject *graph_obj = nullptr;
+	BaseObjectView *obj_view = nullptr;
 	unsigned layer_id = act->data().toUInt();
 
 	for(auto &obj : selected_objects)
 	{
 		graph_obj = dynamic_cast<BaseGraphicObject *>(obj);
-		graph_obj->setLayer(layer_id);
+		obj_view = dynamic_cast<BaseObjectView *>(graph_obj->getOverlyingObject());
+
+		if(obj_view)
+			obj_view->setLayer(layer_id);
+		else
+			graph_obj->setLayer(layer_id);
 	}
 
 	QApplication::setOverrideCursor(Qt::WaitCursor);
@@ -2208,8 +2317,10 @@ void ModelWidget::selectSchemaChildren(void)
 
 	scene->clearSelection();
 
-	dynamic_cast<SchemaView *>(
-				dynamic_cast<BaseObjectView *>(schema->getOverlyingObject()))->selectChildren();
+	SchemaView *sch_view=dynamic_cast<SchemaView *>(schema->getOverlyingObject());
+
+	if(sch_view)
+		sch_view->selectChildren();
 }
 
 void ModelWidget::selectTaggedTables(void)
@@ -2229,7 +2340,10 @@ void ModelWidget::selectTaggedTables(void)
 	for(auto object : objects)
 	{
 		obj_view = dynamic_cast<BaseObjectView *>(dynamic_cast<BaseGraphicObject *>(object)->getOverlyingObject());
-		obj_view->setSelected(true);
+
+		//Tables of collapsed schemas can't be selected
+		if(obj_view)
+			obj_view->setSelected(true);
 	}
 }
 
@@ -2459,6 +2573,7 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 	vector<Exception> errors;
 	unsigned pos=0;
 	TaskProgressWidget task_prog_wgt(this);
+	UniqueNameAllocator name_alloc;
 
 	task_prog_wgt.setWindowTitle(trUtf8("Pasting objects..."));
 	task_prog_wgt.show();
@@ -2475,272 +2590,279 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 		sel_view=dynamic_cast<View *>(selected_objects[0]);
 	}
 
-	while(itr!=itr_end)
+	/* When the copied objects belong to this model they are cloned directly which is way faster
+	 * than the XML code generation and parsing needed to paste objects from other models */
+	if(!sel_table && !sel_view && db_model->canCloneObjects(copied_objects, duplicate_mode))
+		pasteClonedObjects(duplicate_mode, task_prog_wgt, errors);
+	else
 	{
-		object=(*itr);
-		obj_type=object->getObjectType();
-		tab_obj=dynamic_cast<TableObject *>(object);
-		itr++;
-		pos++;
-		task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
-									 trUtf8("Validating object: `%1' (%2)").arg(object->getName())
-									 .arg(object->getTypeName()),
-									 enum_cast(object->getObjectType()));
-
-		if(!tab_obj || ((sel_table || sel_view) && tab_obj))
+		while(itr!=itr_end)
 		{
-			/* The first validation is to check if the object to be pasted does not conflict
-			with any other object of the same type on the model */
-
-			if(obj_type==ObjectType::Function)
-				dynamic_cast<Function *>(object)->createSignature(true);
-			else if(tab_obj)
-				aux_name=tab_obj->getName(true);
-			else
-				aux_name=object->getSignature();
+			object=(*itr);
+			obj_type=object->getObjectType();
+			tab_obj=dynamic_cast<TableObject *>(object);
+			itr++;
+			pos++;
+			task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
+										 trUtf8("Validating object: `%1' (%2)").arg(object->getName())
+										 .arg(object->getTypeName()),
+										 enum_cast(object->getObjectType()));
 
-			if(!tab_obj)
-				//Try to find the object on the model
-				aux_object=db_model->getObject(aux_name, obj_type);
-			else
+			if(!tab_obj || ((sel_table || sel_view) && tab_obj))
 			{
-				if(sel_view && (obj_type==ObjectType::Trigger || obj_type==ObjectType::Rule || obj_type==ObjectType::Index))
-					aux_object=sel_view->getObject(aux_name, obj_type);
-				else if(sel_table)
-					aux_object=sel_table->getObject(aux_name, obj_type);
-			}
+				/* The first validation is to check if the object to be pasted does not conflict
+				with any other object of the same type on the model */
 
-			/* The second validation is to check, when the object is found on the model, if the XML code of the found object
-			 and the object to be pasted are different. When the XML defintion are the same the object isn't pasted because
-			 the found object can be used as substitute of the object to be pasted. This operation is not applied to graphical
-			 objects because they are ALWAYS pasted on the model. The only exception is that the below code is executed when the
-			 found object is the same as the copied object (this means that user is copying and pasting the object at the same database) */
-			if(tab_obj ||
-					(aux_object &&
-					 (dynamic_cast<BaseGraphicObject *>(object) ||
-						(aux_object->getDatabase()==object->getDatabase()) ||
-						(aux_object->getCodeDefinition(SchemaParser::SchemaParser::XmlDefinition) !=
-						 object->getCodeDefinition(SchemaParser::SchemaParser::XmlDefinition)))))
-			{
-				//Resolving name conflicts
-				if(obj_type!=ObjectType::Cast)
-				{
-					func=nullptr; oper=nullptr;
+				if(obj_type==ObjectType::Function)
+					dynamic_cast<Function *>(object)->createSignature(true);
+				else if(tab_obj)
+					aux_name=tab_obj->getName(true);
+				else
+					aux_name=object->getSignature();
 
-					//Store the orignal object name on a map
-					orig_obj_names[object]=object->getName();
+				if(!tab_obj)
+					//Try to find the object on the model
+					aux_object=db_model->getObject(aux_name, obj_type);
+				else
+				{
+					if(sel_view && (obj_type==ObjectType::Trigger || obj_type==ObjectType::Rule || obj_type==ObjectType::Index))
+						aux_object=sel_view->getObject(aux_name, obj_type);
+					else if(sel_table)
+						aux_object=sel_table->getObject(aux_name, obj_type);
+				}
 
-					/* For each object type as follow configures the name and the suffix and store them on the
-						'copy_obj_name' variable. This string is used to check if there are objects with the same name
-						on model. While the 'copy_obj_name' conflicts with other objects (of same type) this validation is made */
-					if(obj_type==ObjectType::Function)
-					{
-						func=dynamic_cast<Function *>(object);
-						func->setName(PgModelerNs::generateUniqueName(func, (*db_model->getObjectList(ObjectType::Function)), false, QString("_cp")));
-						copy_obj_name=func->getName();
-						func->setName(orig_obj_names[object]);
-					}
-					else if(obj_type==ObjectType::Operator)
-					{
-						oper=dynamic_cast<Operator *>(object);
-						oper->setName(PgModelerNs::generateUniqueName(oper, (*db_model->getObjectList(ObjectType::Operator))));
-						copy_obj_name=oper->getName();
-						oper->setName(orig_obj_names[object]);
-					}
-					else
+				/* The second validation is to check, when the object is found on the model, if the XML code of the found object
+				 and the object to be pasted are different. When the XML defintion are the same the object isn't pasted because
+				 the found object can be used as substitute of the object to be pasted. This operation is not applied to graphical
+				 objects because they are ALWAYS pasted on the model. The only exception is that the below code is executed when the
+				 found object is the same as the copied object (this means that user is copying and pasting the object at the same database) */
+				if(tab_obj ||
+						(aux_object &&
+						 (dynamic_cast<BaseGraphicObject *>(object) ||
+							(aux_object->getDatabase()==object->getDatabase()) ||
+							(aux_object->getCodeDefinition(SchemaParser::SchemaParser::XmlDefinition) !=
+							 object->getCodeDefinition(SchemaParser::SchemaParser::XmlDefinition)))))
+				{
+					//Resolving name conflicts
+					if(obj_type!=ObjectType::Cast)
 					{
-						if(tab_obj)
+						func=nullptr; oper=nullptr;
+
+						//Store the orignal object name on a map
+						orig_obj_names[object]=object->getName();
+
+						/* For each object type as follow configures the name and the suffix and store them on the
+							'copy_obj_name' variable. This string is used to check if there are objects with the same name
+							on model. While the 'copy_obj_name' conflicts with other objects (of same type) this validation is made */
+						if(obj_type==ObjectType::Function)
 						{
-							if(sel_table)
-								tab_obj->setName(PgModelerNs::generateUniqueName(tab_obj, (*sel_table->getObjectList(tab_obj->getObjectType())), false, QString("_cp"), true));
-							else
-								tab_obj->setName(PgModelerNs::generateUniqueName(tab_obj, (*sel_view->getObjectList(tab_obj->getObjectType())), false, QString("_cp"), true));
+							func=dynamic_cast<Function *>(object);
+							func->setName(PgModelerNs::generateUniqueName(func, (*db_model->getObjectList(ObjectType::Function)), false, QString("_cp")));
+							copy_obj_name=func->getName();
+							func->setName(orig_obj_names[object]);
+						}
+						else if(obj_type==ObjectType::Operator)
+						{
+							oper=dynamic_cast<Operator *>(object);
+							oper->setName(PgModelerNs::generateUniqueName(oper, (*db_model->getObjectList(ObjectType::Operator))));
+							copy_obj_name=oper->getName();
+							oper->setName(orig_obj_names[object]);
 						}
 						else
-							object->setName(PgModelerNs::generateUniqueName(object, (*db_model->getObjectList(object->getObjectType())), false, QString("_cp"), true));
+						{
+							if(tab_obj)
+							{
+								if(sel_table)
+									tab_obj->setName(PgModelerNs::generateUniqueName(tab_obj, (*sel_table->getObjectList(tab_obj->getObjectType())), false, QString("_cp"), true));
+								else
+									tab_obj->setName(PgModelerNs::generateUniqueName(tab_obj, (*sel_view->getObjectList(tab_obj->getObjectType())), false, QString("_cp"), true));
+							}
+							else
+								object->setName(name_alloc.allocateName(object, db_model, *db_model->getObjectList(object->getObjectType()), QString("_cp"), true));
 
-						copy_obj_name=object->getName();
-						object->setName(orig_obj_names[object]);
-					}
+							copy_obj_name=object->getName();
+							object->setName(orig_obj_names[object]);
+						}
 
-					//Sets the new object name concatenating the suffix to the original name
-					object->setName(copy_obj_name);
+						//Sets the new object name concatenating the suffix to the original name
+						object->setName(copy_obj_name);
+					}
 				}
 			}
 		}
-	}
 
-	/* The third step is get the XML code definition of the copied objects, is
-	with the xml code that the copied object are created and inserted on the model */
-	itr=copied_objects.begin();
-	itr_end=copied_objects.end();
-	pos=0;
-	while(itr!=itr_end)
-	{
-		object=(*itr);
-		object->setCodeInvalidated(true);
-
-		tab_obj=dynamic_cast<TableObject *>(object);
-		itr++;
+		/* The third step is get the XML code definition of the copied objects, is
+		with the xml code that the copied object are created and inserted on the model */
+		itr=copied_objects.begin();
+		itr_end=copied_objects.end();
+		pos=0;
+		while(itr!=itr_end)
+		{
+			object=(*itr);
+			object->setCodeInvalidated(true);
 
-		pos++;
-		task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
-									 trUtf8("Generating XML for: `%1' (%2)").arg(object->getName())
-									 .arg(object->getTypeName()),
-									 enum_cast(object->getObjectType()));
+			tab_obj=dynamic_cast<TableObject *>(object);
+			itr++;
 
-		if(!tab_obj)
-		{
-			aux_table =  dynamic_cast<Table *>(object);;
+			pos++;
+			task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
+										 trUtf8("Generating XML for: `%1' (%2)").arg(object->getName())
+										 .arg(object->getTypeName()),
+										 enum_cast(object->getObjectType()));
 
-			//Stores the XML definition on a xml buffer map
-			if(duplicate_mode && aux_table)
+			if(!tab_obj)
 			{
-				xml_objs[object] = aux_table->__getCodeDefinition(SchemaParser::XmlDefinition, true);
-			  object->setCodeInvalidated(true);
+				aux_table =  dynamic_cast<Table *>(object);;
+
+				//Stores the XML definition on a xml buffer map
+				if(duplicate_mode && aux_table)
+				{
+					xml_objs[object] = aux_table->__getCodeDefinition(SchemaParser::XmlDefinition, true);
+				  object->setCodeInvalidated(true);
+				}
+				else
+					xml_objs[object]=object->getCodeDefinition(SchemaParser::XmlDefinition);
 			}
-			else
-				xml_objs[object]=object->getCodeDefinition(SchemaParser::XmlDefinition);
-		}
 
-		//Store the original parent table of the object
-		else if(tab_obj && (sel_table || sel_view))
-		{
-			if(sel_table)
-				parent=sel_table;
-			else
-				parent=sel_view;
-
-			/* Only generates the XML for a table object when the selected receiver object
-			 * is a table or is a view and the current object is a trigger, index, or rule (because
-			 * view's only accepts this two types) */
-			if(sel_table ||
-					(sel_view && (tab_obj->getObjectType()==ObjectType::Trigger ||
-									tab_obj->getObjectType()==ObjectType::Rule ||
-									tab_obj->getObjectType()==ObjectType::Index)))
+			//Store the original parent table of the object
+			else if(tab_obj && (sel_table || sel_view))
 			{
-				//Backups the original parent table
-				orig_parent_tab=tab_obj->getParentTable();
+				if(sel_table)
+					parent=sel_table;
+				else
+					parent=sel_view;
+
+				/* Only generates the XML for a table object when the selected receiver object
+				 * is a table or is a view and the current object is a trigger, index, or rule (because
+				 * view's only accepts this two types) */
+				if(sel_table ||
+						(sel_view && (tab_obj->getObjectType()==ObjectType::Trigger ||
+										tab_obj->getObjectType()==ObjectType::Rule ||
+										tab_obj->getObjectType()==ObjectType::Index)))
+				{
+					//Backups the original parent table
+					orig_parent_tab=tab_obj->getParentTable();
 
-				constr = dynamic_cast<Constraint *>(tab_obj);
+					constr = dynamic_cast<Constraint *>(tab_obj);
+
+					//Set the parent table as the selected table/view
+					tab_obj->setParentTable(parent);
 
-				//Set the parent table as the selected table/view
-				tab_obj->setParentTable(parent);
+					//Generates the XML code with the new parent table
+					if(constr)
+					{
+						xml_objs[object]=constr->getCodeDefinition(SchemaParser::XmlDefinition, duplicate_mode);
+					  tab_obj->setCodeInvalidated(true);
+					}
+					else
+						xml_objs[object]=object->getCodeDefinition(SchemaParser::XmlDefinition);
 
+					//Restore the original parent table
+					tab_obj->setParentTable(orig_parent_tab);
+				}
+			}
+			else if(tab_obj)
+			{
 				//Generates the XML code with the new parent table
+				constr = dynamic_cast<Constraint *>(tab_obj);
+
 				if(constr)
 				{
 					xml_objs[object]=constr->getCodeDefinition(SchemaParser::XmlDefinition, duplicate_mode);
 				  tab_obj->setCodeInvalidated(true);
 				}
 				else
-					xml_objs[object]=object->getCodeDefinition(SchemaParser::XmlDefinition);
-
-				//Restore the original parent table
-				tab_obj->setParentTable(orig_parent_tab);
+					xml_objs[object]=tab_obj->getCodeDefinition(SchemaParser::XmlDefinition);
 			}
 		}
-		else if(tab_obj)
-		{
-			//Generates the XML code with the new parent table
-			constr = dynamic_cast<Constraint *>(tab_obj);
 
-			if(constr)
-			{
-				xml_objs[object]=constr->getCodeDefinition(SchemaParser::XmlDefinition, duplicate_mode);
-			  tab_obj->setCodeInvalidated(true);
-			}
-			else
-				xml_objs[object]=tab_obj->getCodeDefinition(SchemaParser::XmlDefinition);
-		}
-	}
-
-	//The fourth step is the restoration of original names of the copied objects
-	itr=copied_objects.begin();
-	itr_end=copied_objects.end();
-
-	while(itr!=itr_end)
-	{
-		object = (*itr);
-		obj_type = object->getObjectType();
-		itr++;
+		//The fourth step is the restoration of original names of the copied objects
+		itr=copied_objects.begin();
+		itr_end=copied_objects.end();
 
-		if(orig_obj_names[object].count() && obj_type!=ObjectType::Cast)
-			object->setName(orig_obj_names[object]);
-	}
+		while(itr!=itr_end)
+		{
+			object = (*itr);
+			obj_type = object->getObjectType();
+			itr++;
 
-	//The last step is create the object from the stored xmls
-	itr=copied_objects.begin();
-	itr_end=copied_objects.end();
-	pos=0;
+			if(orig_obj_names[object].count() && obj_type!=ObjectType::Cast)
+				object->setName(orig_obj_names[object]);
+		}
 
-	op_list->startOperationChain();
+		//The last step is create the object from the stored xmls
+		itr=copied_objects.begin();
+		itr_end=copied_objects.end();
+		pos=0;
 
-	while(itr!=itr_end)
-	{
-		object = *itr;
-		itr++;
+		op_list->startOperationChain();
 
-		if(xml_objs.count(object))
+		while(itr!=itr_end)
 		{
-			xmlparser->restartParser();
-			xmlparser->loadXMLBuffer(xml_objs[object]);
+			object = *itr;
+			itr++;
 
-			try
+			if(xml_objs.count(object))
 			{
-				pos++;
-				task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
-											 trUtf8("Pasting object: `%1' (%2)").arg(object->getName())
-											 .arg(object->getTypeName()),
-											 enum_cast(object->getObjectType()));
-
-				//Creates the object from the XML
-				object=db_model->createObject(BaseObject::getObjectType(xmlparser->getElementName()));
-				tab_obj=dynamic_cast<TableObject *>(object);
-				constr=dynamic_cast<Constraint *>(tab_obj);
-
-				/* Once created, the object is added on the model, except for relationships and table objects
-				 * because they are inserted automatically */
-				if(object && !tab_obj && !dynamic_cast<Relationship *>(object))
-				{
-					if(db_model->getObjectIndex(object->getSignature(), object->getObjectType()) >= 0)
-						object->setName(PgModelerNs::generateUniqueName(object, *db_model->getObjectList(object->getObjectType()), false, QString("_cp")));
+				xmlparser->restartParser();
+				xmlparser->loadXMLBuffer(xml_objs[object]);
 
-					db_model->addObject(object);
-				}
-
-				//Special case for table objects
-				if(tab_obj)
+				try
 				{
-					if(sel_table && tab_obj->getObjectType()==ObjectType::Column)
+					pos++;
+					task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
+												 trUtf8("Pasting object: `%1' (%2)").arg(object->getName())
+												 .arg(object->getTypeName()),
+												 enum_cast(object->getObjectType()));
+
+					//Creates the object from the XML
+					object=db_model->createObject(BaseObject::getObjectType(xmlparser->getElementName()));
+					tab_obj=dynamic_cast<TableObject *>(object);
+					constr=dynamic_cast<Constraint *>(tab_obj);
+
+					/* Once created, the object is added on the model, except for relationships and table objects
+					 * because they are inserted automatically */
+					if(object && !tab_obj && !dynamic_cast<Relationship *>(object))
 					{
-						sel_table->addObject(tab_obj);
-						sel_table->setModified(true);
+						if(db_model->getObjectIndex(object->getSignature(), object->getObjectType()) >= 0)
+							object->setName(PgModelerNs::generateUniqueName(object, *db_model->getObjectList(object->getObjectType()), false, QString("_cp")));
+
+						db_model->addObject(object);
 					}
-					else if(constr && duplicate_mode &&
-							constr->getConstraintType() == ConstraintType::PrimaryKey &&
-							constr->getParentTable()->getObjectIndex(constr) < 0)
+
+					//Special case for table objects
+					if(tab_obj)
 					{
-					  constr->getParentTable()->addObject(constr);
-					  constr->getParentTable()->setModified(true);
-					}
+						if(sel_table && tab_obj->getObjectType()==ObjectType::Column)
+						{
+							sel_table->addObject(tab_obj);
+							sel_table->setModified(true);
+						}
+						else if(constr && duplicate_mode &&
+								constr->getConstraintType() == ConstraintType::PrimaryKey &&
+								constr->getParentTable()->getObjectIndex(constr) < 0)
+						{
+						  constr->getParentTable()->addObject(constr);
+						  constr->getParentTable()->setModified(true);
+						}
 
-					//Updates the fk relationships if the constraint is a foreign-key
-					if(constr && constr->getConstraintType()==ConstraintType::ForeignKey)
-						db_model->updateTableFKRelationships(dynamic_cast<Table *>(tab_obj->getParentTable()));
+						//Updates the fk relationships if the constraint is a foreign-key
+						if(constr && constr->getConstraintType()==ConstraintType::ForeignKey)
+							db_model->updateTableFKRelationships(dynamic_cast<Table *>(tab_obj->getParentTable()));
 
-					op_list->registerObject(tab_obj, Operation::ObjectCreated, -1, tab_obj->getParentTable());
+						op_list->registerObject(tab_obj, Operation::ObjectCreated, -1, tab_obj->getParentTable());
+					}
+					else
+						op_list->registerObject(object, Operation::ObjectCreated);
+				}
+				catch(Exception &e)
+				{
+					errors.push_back(e);
 				}
-				else
-					op_list->registerObject(object, Operation::ObjectCreated);
-			}
-			catch(Exception &e)
-			{
-				errors.push_back(e);
 			}
 		}
+		op_list->finishOperationChain();
 	}
-	op_list->finishOperationChain();
 
 	//Validates the relationships to reflect any modification on the tables structures and not propagated columns
 	db_model->validateRelationships();
@@ -2789,6 +2911,105 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 	viewport->horizontalScrollBar()->setValue(db_model->getLastPosition().x());
 }
 
+void ModelWidget::pasteClonedObjects(bool duplicate_mode, TaskProgressWidget &task_prog_wgt, vector<Exception> &errors)
+{
+	vector<BaseObject *> clones, added_objs;
+	UniqueNameAllocator name_alloc;
+	TableObject *tab_obj=nullptr;
+	unsigned pos=0;
+
+	task_prog_wgt.updateProgress(0, trUtf8("Cloning objects..."), enum_cast(ObjectType::Database));
+
+	try
+	{
+		db_model->cloneObjects(copied_objects, clones, duplicate_mode);
+	}
+	catch(Exception &e)
+	{
+		errors.push_back(e);
+		return;
+	}
+
+	try
+	{
+		for(auto &clone : clones)
+		{
+			pos++;
+			task_prog_wgt.updateProgress((pos/static_cast<double>(clones.size()))*100,
+																	 trUtf8("Pasting object: `%1' (%2)").arg(clone->getName())
+																	 .arg(clone->getTypeName()),
+																	 enum_cast(clone->getObjectType()));
+
+			tab_obj=dynamic_cast<TableObject *>(clone);
+
+			//Foreign keys are attached to their tables only after all the cloned tables are in the model
+			if(tab_obj)
+			{
+				tab_obj->getParentTable()->addObject(tab_obj);
+				added_objs.push_back(tab_obj);
+				db_model->updateTableFKRelationships(dynamic_cast<Table *>(tab_obj->getParentTable()));
+			}
+			else
+			{
+				clone->setName(name_alloc.allocateName(clone, db_model, *db_model->getObjectList(clone->getObjectType()), QString("_cp"), true));
+				db_model->addObject(clone);
+				added_objs.push_back(clone);
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		/* Since the clones reference each other the paste is undone as a whole: the inserted clones are
+		 * removed in the reverse order and all of them are destroyed (tables destroy their attached children) */
+		try
+		{
+			for(auto itr=added_objs.rbegin(); itr!=added_objs.rend(); itr++)
+			{
+				tab_obj=dynamic_cast<TableObject *>(*itr);
+
+				if(tab_obj)
+				{
+					tab_obj->getParentTable()->removeObject(tab_obj);
+					db_model->updateTableFKRelationships(dynamic_cast<Table *>(tab_obj->getParentTable()));
+				}
+				else
+					db_model->removeObject(*itr);
+			}
+
+			for(auto &clone : clones)
+			{
+				if(TableObject::isTableObject(clone->getObjectType()))
+					delete(clone);
+			}
+
+			for(auto &clone : clones)
+			{
+				if(!TableObject::isTableObject(clone->getObjectType()))
+					delete(clone);
+			}
+		}
+		catch(Exception &)
+		{}
+
+		errors.push_back(e);
+		return;
+	}
+
+	op_list->startOperationChain();
+
+	for(auto &object : added_objs)
+	{
+		tab_obj=dynamic_cast<TableObject *>(object);
+
+		if(tab_obj)
+			op_list->registerObject(tab_obj, Operation::ObjectCreated, -1, tab_obj->getParentTable());
+		else
+			op_list->registerObject(object, Operation::ObjectCreated);
+	}
+
+	op_list->finishOperationChain();
+}
+
 void ModelWidget::duplicateObject(void)
 {
 	int op_id = -1;
@@ -2888,14 +3109,18 @@ void ModelWidget::removeObjects(bool cascade)
 	BaseTable *table=nullptr, *src_table=nullptr, *dst_table=nullptr;
 	BaseRelationship *rel=nullptr;
 	TableObject *tab_obj=nullptr;
-	ObjectType obj_type=ObjectType::BaseObject, parent_type=ObjectType::BaseObject;
-	BaseObject *object=nullptr, *aux_obj=nullptr;
+	ObjectType obj_type=ObjectType::BaseObject;
+	BaseObject *object=nullptr;
 	vector<BaseObject *> sel_objs, aux_sel_objs;
 
-	map<unsigned, tuple<BaseObject *, QString, ObjectType, QString, ObjectType>> objs_map;
-	map<unsigned, tuple<BaseObject *, QString, ObjectType, QString, ObjectType>>::reverse_iterator ritr, ritr_end;
+	map<unsigned, BaseObject *> objs_map;
+	map<unsigned, BaseObject *>::reverse_iterator ritr, ritr_end;
+	map<BaseTable *, bool> tables_in_model;
+	QSet<BaseObject *> removed_objs;
+	QSet<Table *> upd_fk_tables, upd_view_tables;
+	QSet<BaseTable *> modified_tables;
+	bool revalidate_rels=false;
 	QAction *obj_sender=dynamic_cast<QAction *>(sender());
-	QString obj_name, parent_name;
 	vector<Exception> errors;
 
 	if(obj_sender)
@@ -2944,40 +3169,29 @@ void ModelWidget::removeObjects(bool cascade)
 		{
 			try
 			{
-				//If in cascade mode, retrieve all references to the object (direct and indirect)
+				/* If in cascade mode, retrieve all references to the selected objects (direct and indirect)
+				 * computing the whole impact of the removal in a single traversal */
 				if(cascade)
 				{
 					vector<BaseObject *> refs;
 
-					for(BaseObject *sel_obj : sel_objs)
+					db_model->__getObjectReferences(sel_objs, refs);
+
+					for(BaseObject *ref_obj : refs)
 					{
-						refs.clear();
-						db_model->__getObjectReferences(sel_obj, refs);
+						obj_id=ref_obj->getObjectId();
+						tab_obj=dynamic_cast<TableObject *>(ref_obj);
 
-						for(BaseObject *ref_obj : refs)
+						//Store the base relationships in a auxiliary list to be processed ahead
+						if(ref_obj->getObjectType()==ObjectType::BaseRelationship)
 						{
-							obj_id=ref_obj->getObjectId();
-							tab_obj=dynamic_cast<TableObject *>(ref_obj);
-
-							//Store the base relationships in a auxiliary list to be processed ahead
-							if(ref_obj->getObjectType()==ObjectType::BaseRelationship)
-							{
-								aux_sel_objs.push_back(ref_obj);
-							}
-							//Insert the reference object to the list of objects to be removed
-							else if(objs_map.count(obj_id)==0 &&
-									(!tab_obj || (tab_obj && !tab_obj->isAddedByRelationship())))
-							{
-								parent_type=(tab_obj ? tab_obj->getParentTable()->getObjectType() : ObjectType::Database);
-								parent_name=(tab_obj ? tab_obj->getParentTable()->getName(true) : QString());
-								obj_name=(tab_obj ? tab_obj->getName() : ref_obj->getSignature());
-
-								objs_map[ref_obj->getObjectId()]=std::make_tuple(ref_obj,
-																				 obj_name,
-																				 ref_obj->getObjectType(),
-																				 parent_name,
-																				 parent_type);
-							}
+							aux_sel_objs.push_back(ref_obj);
+						}
+						//Insert the reference object to the list of objects to be removed
+						else if(objs_map.count(obj_id)==0 &&
+								(!tab_obj || (tab_obj && !tab_obj->isAddedByRelationship())))
+						{
+							objs_map[obj_id]=ref_obj;
 						}
 					}
 				}
@@ -3000,30 +3214,11 @@ void ModelWidget::removeObjects(bool cascade)
 							obj_id=tab_obj->getObjectId();
 
 							if(objs_map.count(obj_id)==0)
-							{
-								objs_map[tab_obj->getObjectId()]=std::make_tuple(tab_obj,
-																				 tab_obj->getName(true),
-																				 tab_obj->getObjectType(),
-																				 tab_obj->getParentTable()->getName(true),
-																				 ObjectType::Table);
-
-							}
+								objs_map[obj_id]=tab_obj;
 						}
 					}
 					else if(objs_map.count(obj_id)==0)
-					{
-						tab_obj=dynamic_cast<TableObject *>(object);
-						obj_name=(tab_obj ? object->getName(true) : object->getSignature());
-
-						parent_name=(tab_obj ? tab_obj->getParentTable()->getName(true) : QString());
-						parent_type=(tab_obj ? tab_obj->getParentTable()->getObjectType() : ObjectType::Database);
-
-						objs_map[object->getObjectId()]=std::make_tuple(object,
-																		obj_name,
-																		obj_type,
-																		parent_name,
-																		parent_type);
-					}
+						objs_map[obj_id]=object;
 				}
 
 				rel=nullptr;
@@ -3033,30 +3228,38 @@ void ModelWidget::removeObjects(bool cascade)
 				op_count=op_list->getCurrentSize();
 				op_list->startOperationChain();
 
+				/* The objects are removed from the newest to the oldest (the reverse creation order) so the objects
+				 * are always removed before the ones they depend on. The updates triggered by each removal
+				 * (fk relationships, views, relationships revalidation and redraws) are gathered and done once at the end */
 				do
 				{
-					object=std::get<0>(ritr->second);
-					obj_name=std::get<1>(ritr->second);
-					obj_type=std::get<2>(ritr->second);
-					parent_name=std::get<3>(ritr->second);
-					parent_type=std::get<4>(ritr->second);
+					object=ritr->second;
+					obj_type=object->getObjectType();
+					tab_obj=dynamic_cast<TableObject *>(object);
 					ritr++;
 
 					if(obj_type==ObjectType::BaseRelationship)
 						continue;
-					else if(parent_type!=ObjectType::Database)
+					else if(tab_obj)
 					{
-						/* If the parent table does not exist on the model of the object to be removed
-						 * does not exists in parent table, it'll not be processed */
-						table=dynamic_cast<BaseTable *>(db_model->getObject(parent_name, parent_type));
-						if(!table || (table && table->getObjectIndex(obj_name, obj_type) < 0))
+						/* If the parent table of the object was removed or the object does not exist
+						 * in parent table anymore, it'll not be processed */
+						table=dynamic_cast<BaseTable *>(tab_obj->getParentTable());
+
+						if(!table || removed_objs.contains(table))
+							continue;
+
+						if(tables_in_model.count(table)==0)
+							tables_in_model[table]=(db_model->getObjectIndex(table) >= 0);
+
+						if(!tables_in_model[table] || table->getObjectIndex(tab_obj) < 0)
 							continue;
 					}
 					else
 					{
 						//If the object does not exists on the model it'll not be processed.
-						aux_obj=db_model->getObject(obj_name, obj_type);
-						if(aux_obj!=object)
+						obj_idx=db_model->getObjectIndex(object);
+						if(obj_idx < 0)
 							continue;
 					}
 
@@ -3075,8 +3278,6 @@ void ModelWidget::removeObjects(bool cascade)
 					}
 					else
 					{
-						tab_obj=dynamic_cast<TableObject *>(object);
-
 						if(tab_obj)
 						{
 							if(tab_obj->isAddedByRelationship())
@@ -3087,8 +3288,7 @@ void ModelWidget::removeObjects(bool cascade)
 																ErrorCode::RemProtectedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 							}
 
-							table=dynamic_cast<BaseTable *>(tab_obj->getParentTable());
-							obj_idx=table->getObjectIndex(tab_obj->getName(true), obj_type);
+							obj_idx=table->getObjectIndex(tab_obj);
 
 							try
 							{
@@ -3099,6 +3299,7 @@ void ModelWidget::removeObjects(bool cascade)
 								//Register the removed object on the operation list
 								table->removeObject(obj_idx, obj_type);
 								op_list->registerObject(tab_obj, Operation::ObjectRemoved, obj_idx, table);
+								removed_objs.insert(tab_obj);
 
 								db_model->removePermissions(tab_obj);
 
@@ -3106,16 +3307,15 @@ void ModelWidget::removeObjects(bool cascade)
 
 								if(aux_table && obj_type==ObjectType::Constraint &&
 									 dynamic_cast<Constraint *>(tab_obj)->getConstraintType()==ConstraintType::ForeignKey)
-									db_model->updateTableFKRelationships(aux_table);
+									upd_fk_tables.insert(aux_table);
 
-								table->setModified(true);
-								dynamic_cast<Schema *>(table->getSchema())->setModified(true);
+								modified_tables.insert(table);
 
-								if(aux_table)
-									db_model->validateRelationships(tab_obj, aux_table);
+								if(aux_table && !revalidate_rels)
+									revalidate_rels=db_model->isRelationshipsRevalidationNeeded(tab_obj, aux_table);
 
-								if(obj_type == ObjectType::Column)
-									db_model->updateViewsReferencingTable(aux_table);
+								if(aux_table && obj_type == ObjectType::Column)
+									upd_view_tables.insert(aux_table);
 							}
 							catch(Exception &e)
 							{
@@ -3131,47 +3331,77 @@ void ModelWidget::removeObjects(bool cascade)
 						}
 						else
 						{
-							obj_idx=db_model->getObjectIndex(object);
+							if(obj_type==ObjectType::Relationship)
+							{
+								rel=dynamic_cast<BaseRelationship *>(object);
+								src_table=rel->getTable(BaseRelationship::SrcTable);
+								dst_table=rel->getTable(BaseRelationship::DstTable);
+							}
 
-							if(obj_idx >=0 )
+							try
 							{
-								if(obj_type==ObjectType::Relationship)
-								{
-									rel=dynamic_cast<BaseRelationship *>(object);
-									src_table=rel->getTable(BaseRelationship::SrcTable);
-									dst_table=rel->getTable(BaseRelationship::DstTable);
-								}
+								db_model->removeObject(object, obj_idx);
+								op_list->registerObject(object, Operation::ObjectRemoved, obj_idx);
+								removed_objs.insert(object);
+							}
+							catch(Exception &e)
+							{
+								if(cascade && (e.getErrorCode()==ErrorCode::RemInvalidatedObjects ||
+															 e.getErrorCode()==ErrorCode::RemDirectReference ||
+															 e.getErrorCode()==ErrorCode::RemInderectReference ||
+															 e.getErrorCode()==ErrorCode::RemProtectedObject ||
+															 e.getErrorCode()==ErrorCode::OprReservedObject))
+									errors.push_back(e);
+								else
+									throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+							}
 
-								try
-								{
-									db_model->removeObject(object, obj_idx);
-									op_list->registerObject(object, Operation::ObjectRemoved, obj_idx);
-								}
-								catch(Exception &e)
-								{
-									if(cascade && (e.getErrorCode()==ErrorCode::RemInvalidatedObjects ||
-																 e.getErrorCode()==ErrorCode::RemDirectReference ||
-																 e.getErrorCode()==ErrorCode::RemInderectReference ||
-																 e.getErrorCode()==ErrorCode::RemProtectedObject ||
-																 e.getErrorCode()==ErrorCode::OprReservedObject))
-										errors.push_back(e);
-									else
-										throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
-								}
+							if(rel)
+							{
+								modified_tables.insert(src_table);
+								modified_tables.insert(dst_table);
+								rel=nullptr;
+								dst_table=src_table=nullptr;
 
-								if(rel)
-								{
-									src_table->setModified(true);
-									dst_table->setModified(true);
-									rel=nullptr;
-									dst_table=src_table=nullptr;
-								}
+								//Removing a relationship may remove tables created by it so the tables checked so far need to be checked again
+								tables_in_model.clear();
 							}
 						}
 					}
 				}
 				while(ritr!=ritr_end);
 
+				//Running once the updates needed by the removed objects over the remaining ones
+				for(auto &tab : upd_fk_tables)
+				{
+					if(!removed_objs.contains(tab) && db_model->getObjectIndex(tab) >= 0)
+						db_model->updateTableFKRelationships(tab);
+				}
+
+				if(revalidate_rels)
+				{
+					db_model->storeSpecialObjectsXML();
+					db_model->disconnectRelationships();
+					db_model->validateRelationships();
+				}
+
+				for(auto &tab : upd_view_tables)
+				{
+					if(!removed_objs.contains(tab))
+						db_model->updateViewsReferencingTable(tab);
+				}
+
+				for(auto &tab : modified_tables)
+				{
+					if(removed_objs.contains(tab))
+						continue;
+
+					tab->setModified(true);
+
+					if(tab->getSchema())
+						dynamic_cast<Schema *>(tab->getSchema())->setModified(true);
+				}
+
 				op_list->finishOperationChain();
 				scene->clearSelection();
 				this->configurePopupMenu();
@@ -3767,6 +3997,180 @@ void ModelWidget::toggleSchemasRectangles(void)
 	this->setModified(true);
 }
 
+void ModelWidget::toggleSchemasCollapse(void)
+{
+	bool collapse = sender() == action_collapse_schemas;
+	vector<Schema *> schemas;
+
+	for(auto obj : selected_objects)
+	{
+		if(obj->getObjectType() == ObjectType::Schema)
+			schemas.push_back(dynamic_cast<Schema *>(obj));
+	}
+
+	QApplication::setOverrideCursor(Qt::WaitCursor);
+
+	//If there are no schemas selected all the schemas are collapsed/expanded
+	if(schemas.empty())
+		setAllSchemasCollapsed(collapse);
+	else
+		setSchemasCollapsed(schemas, collapse);
+
+	QApplication::restoreOverrideCursor();
+	this->setModified(true);
+}
+
+void ModelWidget::setAllSchemasCollapsed(bool value)
+{
+	vector<Schema *> schemas;
+
+	for(auto obj : *db_model->getObjectList(ObjectType::Schema))
+		schemas.push_back(dynamic_cast<Schema *>(obj));
+
+	setSchemasCollapsed(schemas, value);
+}
+
+void ModelWidget::setSchemasCollapsed(const vector<Schema *> &schemas, bool value)
+{
+	vector<Schema *> changed;
+	bool chain = false;
+
+	for(auto schema : schemas)
+	{
+		if(schema->isCollapsed() != value &&
+			 std::find(changed.begin(), changed.end(), schema) == changed.end())
+			changed.push_back(schema);
+	}
+
+	if(changed.empty())
+		return;
+
+	//The collapsed state is saved in the model file so its changes are registered in order to be undone
+	chain = changed.size() > 1 && !op_list->isOperationChainStarted();
+
+	if(chain)
+		op_list->startOperationChain();
+
+	for(auto schema : changed)
+	{
+		op_list->registerObject(schema, Operation::ObjectModified);
+		schema->setCollapsed(value);
+	}
+
+	if(chain)
+		op_list->finishOperationChain();
+
+	updateCollapsedSchemas();
+}
+
+void ModelWidget::expandObjectSchemas(BaseGraphicObject *object)
+{
+	BaseRelationship *rel = dynamic_cast<BaseRelationship *>(object);
+	vector<BaseObject *> tables;
+	vector<Schema *> schemas;
+
+	if(!object || !SchemaView::isObjectCollapsed(object))
+		return;
+
+	if(rel)
+		tables = { rel->getTable(BaseRelationship::SrcTable), rel->getTable(BaseRelationship::DstTable) };
+	else
+		tables = { object };
+
+	for(auto &tab : tables)
+		schemas.push_back(dynamic_cast<Schema *>(tab->getSchema()));
+
+	setSchemasCollapsed(schemas, false);
+	this->setModified(true);
+}
+
+void ModelWidget::updateCollapsedSchemas(void)
+{
+	vector<ObjectType> tab_types = { ObjectType::Table, ObjectType::ForeignTable, ObjectType::View },
+			rel_types = { ObjectType::Relationship, ObjectType::BaseRelationship };
+	BaseGraphicObject *graph_obj = nullptr;
+	QSet<Schema *> schemas;
+	bool collapsed = false;
+
+	//The selected objects may be released below
+	scene->clearSelection();
+
+	//The bundles reference the views that may be released so they're destroyed first
+	bundles_timer.stop();
+	qDeleteAll(rel_bundles);
+	rel_bundles.clear();
+
+	//Releasing the relationships attached to collapsed schemas before their tables
+	for(auto type : rel_types)
+	{
+		for(auto obj : *db_model->getObjectList(type))
+		{
+			graph_obj = dynamic_cast<BaseGraphicObject *>(obj);
+
+			if(graph_obj->getOverlyingObject() && SchemaView::isObjectCollapsed(graph_obj))
+				scene->destroyItem(dynamic_cast<BaseObjectView *>(graph_obj->getOverlyingObject()));
+		}
+	}
+
+	//Releasing the tables and views of collapsed schemas and recreating the ones of expanded schemas
+	for(auto type : tab_types)
+	{
+		for(auto obj : *db_model->getObjectList(type))
+		{
+			graph_obj = dynamic_cast<BaseGraphicObject *>(obj);
+			collapsed = SchemaView::isObjectCollapsed(graph_obj);
+
+			if(collapsed && graph_obj->getOverlyingObject())
+				scene->destroyItem(dynamic_cast<BaseObjectView *>(graph_obj->getOverlyingObject()));
+			else if(!collapsed && !graph_obj->getOverlyingObject())
+				handleObjectAddition(graph_obj);
+			else
+				continue;
+
+			schemas.insert(dynamic_cast<Schema *>(graph_obj->getSchema()));
+		}
+	}
+
+	//Recreating the relationships in which both tables are visible again
+	for(auto type : rel_types)
+	{
+		for(auto obj : *db_model->getObjectList(type))
+		{
+			graph_obj = dynamic_cast<BaseGraphicObject *>(obj);
+
+			if(!graph_obj->getOverlyingObject() && !SchemaView::isObjectCollapsed(graph_obj))
+				handleObjectAddition(graph_obj);
+		}
+	}
+
+	/* Collapsed and empty schemas are always updated since their boxes depend on the collapsing state
+	 * even when there are no children objects released/recreated */
+	for(auto obj : *db_model->getObjectList(ObjectType::Schema))
+	{
+		Schema *schema = dynamic_cast<Schema *>(obj);
+		SchemaView *sch_view = dynamic_cast<SchemaView *>(schema->getOverlyingObject());
+
+		if(schema->isCollapsed() || (sch_view && sch_view->getChildrenObjects().empty()))
+			schemas.insert(schema);
+	}
+
+	for(auto &schema : schemas)
+		schema->setModified(true);
+
+	updateRelationshipBundles();
+	this->modified = true;
+}
+
+void ModelWidget::updateRelationshipBundles(void)
+{
+	bundles_timer.stop();
+	qDeleteAll(rel_bundles);
+	rel_bundles = RelationshipBundleItem::createBundles(db_model);
+
+	for(auto &bundle : rel_bundles)
+		scene->addItem(bundle);
+}
+
 void ModelWidget::updateObjectsOpacity(void)
 {
 	vector<ObjectType> types = { ObjectType::Schema, ObjectType::Table, ObjectType::View,
@@ -3921,6 +4325,7 @@ void ModelWidget::configurePopupMenu(const vector<BaseObject *> &objects)
 
 					popup_menu.addAction(action_sel_sch_children);
 					action_sel_sch_children->setData(QVariant::fromValue<void *>(obj));
+					popup_menu.addAction(action_schemas_collapse);
 				}
 				else if(obj_type == ObjectType::Tag)
 				{
@@ -4037,7 +4442,10 @@ void ModelWidget::configurePopupMenu(const vector<BaseObject *> &objects)
 		}
 
 		if(objects.empty() || (objects.size() == 1 && objects[0]->getObjectType() == ObjectType::Database))
+		{
 			popup_menu.addAction(action_schemas_rects);
+			popup_menu.addAction(action_schemas_collapse);
+		}
 	}
 
 	if(!tab_obj &&
@@ -4208,6 +4616,11 @@ bool ModelWidget::isModified(void)
 	return(modified);
 }
 
+unsigned ModelWidget::getObjectsChangesCount(void)
+{
+	return(objs_changes);
+}
+
 DatabaseModel *ModelWidget::getDatabaseModel(void)
 {
 	return(db_model);
@@ -4262,11 +4675,17 @@ void ModelWidget::highlightObject(void)
 
 		if(graph_obj)
 		{
+			//Objects inside collapsed schemas need to be displayed before being highlighted
+			expandObjectSchemas(graph_obj);
+
 			BaseObjectView *obj_view=dynamic_cast<BaseObjectView *>(graph_obj->getOverlyingObject());
 
-			scene->clearSelection();
-			obj_view->setSelected(true);
-			viewport->centerOn(obj_view);
+			if(obj_view)
+			{
+				scene->clearSelection();
+				obj_view->setSelected(true);
+				viewport->centerOn(obj_view);
+			}
 		}
 	}
 }
@@ -4414,7 +4833,8 @@ void ModelWidget::breakRelationshipLine(void)
 
 void ModelWidget::breakRelationshipLine(BaseRelationship *rel, unsigned break_type)
 {
-	if(!rel) return;
+	//Relationships attached to collapsed schemas have no line to be broken
+	if(!rel || !rel->getOverlyingObject()) return;
 
 	try
 	{
@@ -4506,6 +4926,8 @@ void ModelWidget::rearrangeSchemasInGrid(unsigned tabs_per_row, unsigned sch_per
 	unsigned sch_id=0, min_cnt = 0;
 	double x=origin.x(), y=origin.y(), max_y=-1, cy=0;
 
+	//The arrangement is based upon the objects geometry so all schemas contents must be displayed
+	setAllSchemasCollapsed(false);
 	objects=db_model->getObjectList(ObjectType::Schema);
 
 	/* If schemas per row or tables per row isn't specified
@@ -4653,6 +5075,20 @@ void ModelWidget::swapObjectsIds(void)
 	GeneralConfigWidget::saveWidgetGeometry(&parent_form, swap_ids_wgt->metaObject()->className());
 }
 
+void ModelWidget::showMemoryUsage(void)
+{
+	BaseForm parent_form(this);
+	MemoryUsageWidget *mem_usage_wgt=new MemoryUsageWidget;
+
+	mem_usage_wgt->setModelWidget(this);
+	mem_usage_wgt->setWindowTitle(trUtf8("Memory usage - %1").arg(db_model->getName()));
+	parent_form.setMainWidget(mem_usage_wgt);
+
+	GeneralConfigWidget::restoreWidgetGeometry(&parent_form, mem_usage_wgt->metaObject()->className());
+	parent_form.exec();
+	GeneralConfigWidget::saveWidgetGeometry(&parent_form, mem_usage_wgt->metaObject()->className());
+}
+
 void ModelWidget::jumpToTable(void)
 {
 	QAction *act = qobject_cast<QAction *>(sender());
@@ -4663,8 +5099,13 @@ void ModelWidget::jumpToTable(void)
 		return;
 
 	tab = reinterpret_cast<BaseTable *>(act->data().value<void *>());
+	expandObjectSchemas(tab);
 	scene->clearSelection();
 	tab_view = dynamic_cast<BaseTableView *>(tab->getOverlyingObject());
+
+	if(!tab_view)
+		return;
+
 	tab_view->setSelected(true);
 	viewport->centerOn(tab_view);
 }
@@ -4687,6 +5128,10 @@ void ModelWidget::updateModelLayers(void)
 	db_model->setLayers(layers);
 	db_model->setActiveLayers(scene->getActiveLayersIds());
 	modified = true;
+
+	//Updating the bundles visibility according to the visibility of the objects they connect
+	if(!rel_bundles.empty())
+		bundles_timer.start();
 }
 
 void ModelWidget::rearrangeTablesHierarchically(void)
@@ -4696,6 +5141,7 @@ void ModelWidget::rearrangeTablesHierarchically(void)
 	BaseTableView *tab_view = nullptr, *root = nullptr;
 	int num_rels = 0;
 
+	setAllSchemasCollapsed(false);
 	scene->clearSelection();
 
 	objects.assign(db_model->getObjectList(ObjectType::Table)->begin(), db_model->getObjectList(ObjectType::Table)->end());
@@ -5051,6 +5497,7 @@ void ModelWidget::rearrangeTablesInSchemas(void)
 
 
 	rand_num_engine.seed(rand_seed());
+	setAllSchemasCollapsed(false);
 
 	/* Rearraging tables inside schemas and determining the maximum width and height by summing
 	 * all schemas widths and heights. These values will be serve as the maximum
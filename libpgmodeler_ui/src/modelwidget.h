@@ -32,6 +32,9 @@
 #include "objectsscene.h"
 #include "taskprogresswidget.h"
 #include "newobjectoverlaywidget.h"
+#include "modelloadhelper.h"
+#include "uniquenameallocator.h"
+#include "relationshipbundleitem.h"
 
 class ModelWidget: public QWidget {
 	private:
@@ -44,6 +47,10 @@ class ModelWidget: public QWidget {
 		//! \brief Current zoom aplied to the scene
 		double current_zoom;
 
+		/*! \brief Counts the objects added to or removed from the database model. Used together with the operation list
+		 * size and index to detect changes made on a model that is not the current one (see getObjectsChangesCount()) */
+		unsigned objs_changes;
+
 		//! \brief Indicates if the model was modified by some operation
 		bool modified,
 
@@ -125,6 +132,8 @@ class ModelWidget: public QWidget {
 
 		toggle_sch_rects_menu,
 
+		toggle_sch_collapse_menu,
+
 		database_category_menu,
 
 		schema_category_menu;
@@ -156,7 +165,26 @@ class ModelWidget: public QWidget {
 		QFrame	*magnifier_frm;
 
 		//! \brief This timer controls the interval the zoom label is visible
-		QTimer zoom_info_timer;
+		QTimer zoom_info_timer,
+
+		/*! \brief Timer used to coalesce the several relationship bundles updates requested
+		 * when objects attached to collapsed schemas are added/removed in sequence */
+		bundles_timer;
+
+		//! \brief Stores the items that represent the relationships attached to collapsed schemas
+		vector<RelationshipBundleItem *> rel_bundles;
+
+		//! \brief Thread used to load the model file in background (see loadModelInBackground())
+		QThread *load_thread;
+
+		//! \brief Helper that loads the model file in the load_thread
+		ModelLoadHelper *load_helper;
+
+		//! \brief Configures the scene and the widget after the model being loaded from file
+		void configureLoadedModel(void);
+
+		//! \brief Waits the background loading thread to finish and destroys it
+		void destroyLoadThread(void);
 
 		//! \brief Opens a editing form for objects at database level
 		template<class Class, class WidgetClass>
@@ -252,10 +280,14 @@ class ModelWidget: public QWidget {
 		*action_collpase_all_attribs,
 		*action_no_collapse_attribs,
 		*action_edit_creation_order,
+		*action_memory_usage,
 		*action_jump_to_table,
 		*action_schemas_rects,
 		*action_show_schemas_rects,
 		*action_hide_schemas_rects,
+		*action_schemas_collapse,
+		*action_collapse_schemas,
+		*action_expand_schemas,
 		*action_edit_data,
 		*action_database_category,
 		*action_schema_category;
@@ -288,8 +320,29 @@ class ModelWidget: public QWidget {
 
 		void fadeObjects(const vector<BaseObject *> &objects, bool fade_in);
 
+		/*! \brief Pastes the copied objects by cloning them directly (see DatabaseModel::cloneObjects()) instead of
+		 * generating and parsing their XML code. Used by pasteObjects() when the copied objects belong to this model */
+		void pasteClonedObjects(bool duplicate_mode, TaskProgressWidget &task_prog_wgt, vector<Exception> &errors);
+
 		void setAllCollapseMode(CollapseMode mode);
 
+		//! \brief Collapses/expands all the schemas of the model
+		void setAllSchemasCollapsed(bool value);
+
+		/*! \brief Collapses/expands the provided schemas registering the ones that had the state changed
+		 * in the operation list and updating their graphical representation */
+		void setSchemasCollapsed(const vector<Schema *> &schemas, bool value);
+
+		/*! \brief Releases the graphical representation of the tables, views and relationships attached to collapsed
+		 * schemas and recreates the ones of the expanded schemas. The relationship bundles are updated as well */
+		void updateCollapsedSchemas(void);
+
+		//! \brief Expands the collapsed schemas in which the provided object (table, view or relationship) is placed so it can be displayed
+		void expandObjectSchemas(BaseGraphicObject *object);
+
+		//! \brief Recreates the items that represent the relationships attached to collapsed schemas
+		void updateRelationshipBundles(void);
+
 	public:
 		static constexpr double MinimumZoom=0.050000,
 		MaximumZoom=5.000001,
@@ -326,6 +379,9 @@ class ModelWidget: public QWidget {
 		//! \brief Returns if the model is modified or not
 		bool isModified(void);
 
+		//! \brief Returns the amount of objects added to or removed from the database model since its creation
+		unsigned getObjectsChangesCount(void);
+
 		//! \brief Returns the reference database model
 		DatabaseModel *getDatabaseModel(void);
 
@@ -385,6 +441,12 @@ class ModelWidget: public QWidget {
 		//! \brief Handles the signals that indicates the object removal on the reference database model
 		void handleObjectRemoval(BaseObject *object);
 
+		//! \brief Creates the graphical objects in the scene when the background loading finishes
+		void finishModelLoading(void);
+
+		//! \brief Cleans up the background loading when it is aborted due to an error
+		void abortModelLoading(Exception e);
+
 		//! \brief Handles the signals that indicates the object moviment on the scene
 		void handleObjectsMovement(bool end_moviment);
 
@@ -503,18 +565,34 @@ class ModelWidget: public QWidget {
 
 		void toggleSchemasRectangles(void);
 
+		//! \brief Collapses/expands the selected schemas (or all schemas if none is selected)
+		void toggleSchemasCollapse(void);
+
 		void swapObjectsIds(void);
 
+		//! \brief Shows the estimated memory usage of the model per subsystem and object type
+		void showMemoryUsage(void);
+
 		void jumpToTable(void);
 
 		void editTableData(void);
 
 		void updateModelLayers(void);
 
+		/*! \brief Loads the model file in a separated thread. Only the parsing and the objects creation run in that thread
+		 * while the graphical objects are created on the scene after the loading finishes. The signals of the database model
+		 * are blocked during the process and the model must not be accessed until s_modelLoaded() or s_modelLoadAborted() is emitted */
+		void loadModelInBackground(const QString &filename);
+
+		//! \brief Returns if the model is being loaded in background
+		bool isLoadingModel(void);
+
 	public slots:
 		void loadModel(const QString &filename);
 		void saveModel(const QString &filename);
 		void saveModel(void);
+		/*! \brief Prints the model in a separated thread (see ModelPrintHelper) while a progress dialog that allows to cancel
+		 * the printing is shown. If a page range is set on the printer only those pages are printed */
 		void printModel(QPrinter *printer, bool print_grid, bool print_page_nums);
 		void update(void);
 
@@ -538,6 +616,12 @@ class ModelWidget: public QWidget {
 		void s_sceneInteracted(const QPointF &mouse_pos);
 		void s_sceneInteracted(int obj_count, const QRectF &objs_rect);
 
+		//! \brief Signal emitted when the model is completely loaded in background and its objects are on the scene
+		void s_modelLoaded(void);
+
+		//! \brief Signal emitted when the model couldn't be loaded in background
+		void s_modelLoadAborted(Exception e);
+
 		friend class MainWindow;
 		friend class ModelExportForm;
 		friend class OperationListWidget;
@@ -33,6 +33,8 @@ ObjectFinderWidget::ObjectFinderWidget(QWidget *parent) : QWidget(parent)
 {
 	setupUi(this);
 
+	model_wgt=nullptr;
+	selected_obj=nullptr;
 	filter_frm->setVisible(false);
 	splitter->handle(1)->setEnabled(false);
 	updateObjectTypeList(obj_types_lst);
@@ -200,6 +202,18 @@ void ObjectFinderWidget::setModel(ModelWidget *model_wgt)
 {
 	bool enable=model_wgt!=nullptr;
 
+	if(this->model_wgt && this->model_wgt!=model_wgt && !found_objs.empty())
+	{
+		SearchState &state=search_states[this->model_wgt];
+
+		state.pattern=pattern_edt->text();
+		state.search_attr=result_attr;
+		state.found_objs=found_objs;
+		state.op_count=this->model_wgt->op_list->getCurrentSize();
+		state.op_index=this->model_wgt->op_list->getCurrentIndex();
+		state.objs_changes=this->model_wgt->getObjectsChangesCount();
+	}
+
 	clearResult();
 	this->model_wgt=model_wgt;
 	filter_btn->setEnabled(enable);
@@ -208,6 +222,39 @@ void ObjectFinderWidget::setModel(ModelWidget *model_wgt)
 	pattern_lbl->setEnabled(enable);
 	find_btn->setEnabled(enable);
 	result_tbw->setEnabled(enable);
+
+	auto itr=search_states.find(model_wgt);
+
+	if(itr!=search_states.end())
+	{
+		SearchState state=itr->second;
+
+		search_states.erase(itr);
+		pattern_edt->setText(state.pattern);
+
+		/* If the model was changed while it wasn't the current one the stored results may reference
+		 * objects that don't exist anymore so the search is executed again */
+		if(state.op_count==model_wgt->op_list->getCurrentSize() &&
+			 state.op_index==model_wgt->op_list->getCurrentIndex() &&
+			 state.objs_changes==model_wgt->getObjectsChangesCount())
+		{
+			found_objs=state.found_objs;
+			showResult(state.search_attr);
+		}
+		else
+		{
+			search_attrs_cmb->setCurrentIndex(search_attribs.indexOf(state.search_attr));
+			findObjects();
+		}
+	}
+}
+
+void ObjectFinderWidget::removeSearchState(ModelWidget *model_wgt)
+{
+	if(model_wgt==this->model_wgt)
+		setModel(nullptr);
+
+	search_states.erase(model_wgt);
 }
 
 void ObjectFinderWidget::clearResult(void)
@@ -231,7 +278,6 @@ void ObjectFinderWidget::findObjects(void)
 	{
 		vector<ObjectType> types;
 		QString search_attr = search_attribs.at(search_attrs_cmb->currentIndex());
-		QTableWidgetItem *item = result_tbw->horizontalHeaderItem(result_tbw->columnCount() - 1);
 
 		clearResult();
 
@@ -248,34 +294,43 @@ void ObjectFinderWidget::findObjects(void)
 																													exact_match_chk->isChecked(),
 																													search_attr);
 
-		//Show the found objects on the result table
-		updateObjectTable(result_tbw, found_objs, search_attr);
+		showResult(search_attr);
+		fadeObjects();
+	}
+}
 
-		//Rename the last column of the results grid wth the name of the field used to search objects
-		if(search_attr != Attributes::Name &&
-			 search_attr != Attributes::Schema &&
-			 search_attr != Attributes::Comment)
-			item->setText(search_attrs_cmb->currentText());
-		else
-			item->setText(trUtf8("Comment"));
+void ObjectFinderWidget::showResult(const QString &search_attr)
+{
+	QTableWidgetItem *item = result_tbw->horizontalHeaderItem(result_tbw->columnCount() - 1);
 
-		found_lbl->setVisible(true);
+	result_attr = search_attr;
 
-		//Show a message indicating the number of found objects
-		if(!found_objs.empty())
-		{
-			found_lbl->setText(trUtf8("Found <strong>%1</strong> object(s).").arg(found_objs.size()));
-			result_tbw->horizontalHeader()->setStretchLastSection(true);
-			result_tbw->resizeColumnsToContents();
-		}
-		else
-			found_lbl->setText(trUtf8("No objects found."));
+	//Show the found objects on the result table
+	updateObjectTable(result_tbw, found_objs, search_attr);
 
-		clear_res_btn->setEnabled(!found_objs.empty());
-		select_btn->setEnabled(!found_objs.empty());
-		fade_btn->setEnabled(!found_objs.empty());
-		fadeObjects();
+	//Rename the last column of the results grid wth the name of the field used to search objects
+	if(search_attr != Attributes::Name &&
+		 search_attr != Attributes::Schema &&
+		 search_attr != Attributes::Comment)
+		item->setText(search_attribs_i18n.at(search_attribs.indexOf(search_attr)));
+	else
+		item->setText(trUtf8("Comment"));
+
+	found_lbl->setVisible(true);
+
+	//Show a message indicating the number of found objects
+	if(!found_objs.empty())
+	{
+		found_lbl->setText(trUtf8("Found <strong>%1</strong> object(s).").arg(found_objs.size()));
+		result_tbw->horizontalHeader()->setStretchLastSection(true);
+		result_tbw->resizeColumnsToContents();
 	}
+	else
+		found_lbl->setText(trUtf8("No objects found."));
+
+	clear_res_btn->setEnabled(!found_objs.empty());
+	select_btn->setEnabled(!found_objs.empty());
+	fade_btn->setEnabled(!found_objs.empty());
 }
 
 void ObjectFinderWidget::selectObject(void)
@@ -296,6 +351,9 @@ void ObjectFinderWidget::selectObject(void)
 
 			if(graph_obj)
 			{
+				//Objects inside collapsed schemas are displayed before being focused
+				model_wgt->expandObjectSchemas(graph_obj);
+
 				BaseObjectView *obj=dynamic_cast<BaseObjectView *>(graph_obj->getOverlyingObject());
 
 				if(obj)
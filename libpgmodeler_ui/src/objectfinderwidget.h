@@ -44,6 +44,9 @@ class ObjectFinderWidget : public QWidget, public Ui::ObjectFinderWidget {
 
 		vector<BaseObject *> found_objs;
 
+		//! \brief Stores the attribute used in the search that generated the current result
+		QString result_attr;
+
 		QMenu select_menu, fade_menu;
 
 		//! \brief Reference model widget
@@ -52,6 +55,21 @@ class ObjectFinderWidget : public QWidget, public Ui::ObjectFinderWidget {
 		//! \brief Stores the selected object on the result list
 		BaseObject *selected_obj;
 
+		/*! \brief Stores the search pattern and results of a model that is not the current one as well
+		 * the values used to detect if the model was changed in the meantime */
+		struct SearchState {
+			QString pattern, search_attr;
+			vector<BaseObject *> found_objs;
+			int op_index;
+			unsigned op_count, objs_changes;
+		};
+
+		//! \brief Stores the last search of each model already shown in the widget
+		map<ModelWidget *, SearchState> search_states;
+
+		//! \brief Displays the objects in found_objs on the result table
+		void showResult(const QString &search_attr);
+
 		//! \brief Captures the ENTER press to execute search
 		bool eventFilter(QObject *object, QEvent *event);
 
@@ -69,9 +87,14 @@ class ObjectFinderWidget : public QWidget, public Ui::ObjectFinderWidget {
 		reference to the object on the first column */
 		static void updateObjectTable(QTableWidget *tab_wgt, vector<BaseObject *> &objects, const QString &search_attr = Attributes::Name);
 		
-		//! \brief Sets the database model to work on
+		/*! \brief Sets the database model to work on. The search results of the previous model are stored
+		 * and displayed again (without executing the search) when that model is set back */
 		void setModel(ModelWidget *model_wgt);
 
+		/*! \brief Discards the search results stored for the model. If the model is the current one the result
+		 * is cleared. This method must be called before destroying a model previously assigned to the widget */
+		void removeSearchState(ModelWidget *model_wgt);
+
 	signals:
 		void s_visibilityChanged(bool);
 		
@@ -19,10 +19,12 @@
 #include "operationlistwidget.h"
 #include "taskprogresswidget.h"
 #include "pgmodeleruins.h"
+#include "stallwatchdog.h"
 
 OperationListWidget::OperationListWidget(QWidget *parent) : QWidget(parent)
 {
 	setupUi(this);
+	model_wgt=nullptr;
 	setModel(nullptr);
 
 	operations_tw->headerItem()->setHidden(true);
@@ -33,6 +35,12 @@ OperationListWidget::OperationListWidget(QWidget *parent) : QWidget(parent)
 	connect(hide_tb, SIGNAL(clicked(bool)), this, SLOT(hide(void)));
 }
 
+OperationListWidget::~OperationListWidget(void)
+{
+	for(auto &itr : op_states)
+		qDeleteAll(itr.second.items);
+}
+
 void OperationListWidget::hide(void)
 {
 	QWidget::hide();
@@ -55,6 +63,8 @@ void OperationListWidget::selectItem(QTreeWidgetItem *item, int)
 
 void OperationListWidget::updateOperationList(void)
 {
+	StallMarker stall_marker(__PRETTY_FUNCTION__);
+
 	content_wgt->setEnabled(this->model_wgt!=nullptr);
 
 	if(!model_wgt)
@@ -149,17 +159,77 @@ void OperationListWidget::updateOperationList(void)
 
 void OperationListWidget::setModel(ModelWidget *model)
 {
+	if(this->model_wgt && this->model_wgt!=model)
+	{
+		//Detaching the items of the previous model so they can be reused when it becomes the current one again
+		OperationsState &state=op_states[this->model_wgt];
+
+		qDeleteAll(state.items);
+		state.op_count=this->model_wgt->op_list->getCurrentSize();
+		state.op_index=this->model_wgt->op_list->getCurrentIndex();
+		state.scroll_pos=operations_tw->verticalScrollBar()->value();
+		state.items=operations_tw->invisibleRootItem()->takeChildren();
+	}
+
 	operations_tw->clear();
 	this->model_wgt=model;
+
+	auto itr=op_states.find(model);
+
+	if(itr!=op_states.end())
+	{
+		OperationsState state=itr->second;
+
+		op_states.erase(itr);
+
+		//Reusing the stored items only if the model's operation list wasn't changed in the meantime
+		if(state.op_count==model->op_list->getCurrentSize() &&
+			 state.op_index==model->op_list->getCurrentIndex())
+		{
+			content_wgt->setEnabled(true);
+			op_count_lbl->setText(QString("%1").arg(state.op_count));
+			current_pos_lbl->setText(QString("%1").arg(state.op_index));
+			redo_tb->setEnabled(model->op_list->isRedoAvailable());
+			undo_tb->setEnabled(model->op_list->isUndoAvailable());
+			rem_operations_tb->setEnabled(state.op_count > 0);
+
+			operations_tw->setUpdatesEnabled(false);
+			operations_tw->insertTopLevelItems(0, state.items);
+			operations_tw->expandAll();
+			operations_tw->setUpdatesEnabled(true);
+			operations_tw->verticalScrollBar()->setValue(state.scroll_pos);
+
+			emit s_operationListUpdated();
+			return;
+		}
+
+		qDeleteAll(state.items);
+	}
+
 	updateOperationList();
 }
 
+void OperationListWidget::removeOperationsState(ModelWidget *model)
+{
+	if(model==this->model_wgt)
+		setModel(nullptr);
+
+	auto itr=op_states.find(model);
+
+	if(itr!=op_states.end())
+	{
+		qDeleteAll(itr->second.items);
+		op_states.erase(itr);
+	}
+}
+
 void OperationListWidget::undoOperation(void)
 {
 	try
 	{
 		QApplication::setOverrideCursor(Qt::WaitCursor);
 		model_wgt->op_list->undoOperation();
+		model_wgt->updateCollapsedSchemas();
 		notifyUpdateOnModel();
 		model_wgt->scene->clearSelection();
 		QApplication::restoreOverrideCursor();
@@ -185,6 +255,7 @@ void OperationListWidget::redoOperation(void)
 	{
 		QApplication::setOverrideCursor(Qt::WaitCursor);
 		model_wgt->op_list->redoOperation();
+		model_wgt->updateCollapsedSchemas();
 		notifyUpdateOnModel();
 		model_wgt->scene->clearSelection();
 		QApplication::restoreOverrideCursor();
@@ -36,11 +36,30 @@ class OperationListWidget: public QWidget, public Ui::OperationListWidget {
 
 		ModelWidget *model_wgt;
 
+		//! \brief Stores the operation items of a model that is not the current one
+		struct OperationsState {
+			QList<QTreeWidgetItem *> items;
+
+			/*! \brief Size and current index of the model's operation list when the items were stored.
+			 * These values are used to detect if the stored items are out of date */
+			unsigned op_count;
+			int op_index;
+			int scroll_pos;
+		};
+
+		//! \brief Stores the operation items of each model already shown in the widget
+		map<ModelWidget *, OperationsState> op_states;
+
 		//! \brief Updates the operation list and emits the signal s_operationListUpdated to the connected objects
 		void notifyUpdateOnModel(void);
 
 	public:
 		OperationListWidget(QWidget * parent = nullptr);
+		~OperationListWidget(void);
+
+		/*! \brief Discards the operation items stored for the model. If the model is the current one the list
+		 * is cleared. This method must be called before destroying a model previously assigned to the widget */
+		void removeOperationsState(ModelWidget *model);
 
 	public slots:
 		void updateOperationList(void);
@@ -17,9 +17,18 @@
 */
 
 #include "resultsetmodel.h"
+#include "globalattributes.h"
+#include <QDataStream>
+
+vector<ResultSetModel *> ResultSetModel::lru_models;
+qint64 ResultSetModel::mem_limit=ResultSetModel::DefaultMemoryLimit;
 
 ResultSetModel::ResultSetModel(ResultSet &res, Catalog &catalog, QObject *parent) : QAbstractTableModel(parent)
 {
+	mem_usage=0;
+	registered=false;
+	spill_file=nullptr;
+
 	try
 	{
 		Catalog aux_cat = catalog;
@@ -48,9 +57,9 @@ ResultSetModel::ResultSetModel(ResultSet &res, Catalog &catalog, QObject *parent
 				for(int col=0; col < col_count; col++)
 				{
 					if(res.isColumnBinaryFormat(col))
-						item_data.push_back(trUtf8("[binary data]"));
+						appendItem(trUtf8("[binary data]"));
 					else
-						item_data.push_back(res.getColumnValue(col));
+						appendItem(res.getColumnValue(col));
 				}
 			}
 			while(res.accessTuple(ResultSet::NextTuple));
@@ -76,6 +85,15 @@ ResultSetModel::ResultSetModel(ResultSet &res, Catalog &catalog, QObject *parent
 	}
 }
 
+ResultSetModel::~ResultSetModel(void)
+{
+	if(registered)
+		lru_models.erase(std::find(lru_models.begin(), lru_models.end(), this));
+
+	//The temporary file is automatically removed when destroyed
+	delete(spill_file);
+}
+
 int ResultSetModel::rowCount(const QModelIndex &) const
 {
 	return(row_count);
@@ -101,7 +119,13 @@ QVariant ResultSetModel::data(const QModelIndex &index, int role) const
 	if(index.row() < row_count && index.column() < col_count)
 	{
 		if(role == Qt::DisplayRole)
+		{
+			//Reloading the spilled data transparently when some view requests it
+			if(spill_file)
+				const_cast<ResultSetModel *>(this)->markAsUsed();
+
 			return(item_data.at(index.row() * col_count + index.column()));
+		}
 
 		if(role == Qt::TextAlignmentRole)
 			return(QVariant(Qt::AlignLeft | Qt::AlignVCenter));
@@ -141,6 +165,9 @@ void ResultSetModel::append(ResultSet &res)
 	{
 		if(res.isValid() && !res.isEmpty())
 		{
+			//Rows can only be appended to data held in memory
+			reloadData();
+
 			if(res.accessTuple(ResultSet::FirstTuple))
 			{
 				do
@@ -150,13 +177,13 @@ void ResultSetModel::append(ResultSet &res)
 						if(col < res.getColumnCount())
 						{
 							if(res.isColumnBinaryFormat(col))
-								item_data.push_back(trUtf8("[binary data]"));
+								appendItem(trUtf8("[binary data]"));
 							else
-								item_data.push_back(res.getColumnValue(col));
+								appendItem(res.getColumnValue(col));
 						}
 						else
 						{
-							item_data.push_back(QString());
+							appendItem(QString());
 						}
 					}
 				}
@@ -177,3 +204,136 @@ bool ResultSetModel::isEmpty(void)
 	return(row_count <= 0);
 }
 
+
+void ResultSetModel::appendItem(const QString &value)
+{
+	item_data.push_back(value);
+	mem_usage+=(value.size() * static_cast<qint64>(sizeof(QChar))) + ItemOverhead;
+}
+
+void ResultSetModel::spillData(void)
+{
+	if(spill_file || item_data.isEmpty())
+		return;
+
+	QTemporaryFile *file=new QTemporaryFile;
+	QDataStream stream;
+	bool success=false;
+
+	file->setFileTemplate(GlobalAttributes::TemporaryDir + GlobalAttributes::DirSeparator + QString("results_XXXXXX") + QString(".tmp"));
+
+	if(file->open())
+	{
+		stream.setDevice(file);
+		stream.setVersion(QDataStream::Qt_5_0);
+
+		for(auto &item : item_data)
+			stream << item.toUtf8();
+
+		success=(stream.status()==QDataStream::Ok && file->flush());
+		file->close();
+	}
+
+	//If the data could not be written to the file it's simply kept in memory
+	if(!success)
+	{
+		delete(file);
+		return;
+	}
+
+	spill_file=file;
+	item_data.clear();
+	emit s_dataSpilled(true);
+}
+
+void ResultSetModel::reloadData(void)
+{
+	if(!spill_file)
+		return;
+
+	QDataStream stream;
+	QByteArray buffer;
+	int item_count=row_count * col_count;
+
+	item_data.reserve(item_count);
+
+	if(spill_file->open())
+	{
+		stream.setDevice(spill_file);
+		stream.setVersion(QDataStream::Qt_5_0);
+
+		while(item_data.size() < item_count && !stream.atEnd())
+		{
+			stream >> buffer;
+			item_data.push_back(QString::fromUtf8(buffer));
+		}
+
+		spill_file->close();
+	}
+
+	/* In case of failure while reading the file the missing items are filled with empty
+	 * values in order to keep the model consistent with its row and column counts */
+	while(item_data.size() < item_count)
+		item_data.push_back(QString());
+
+	delete(spill_file);
+	spill_file=nullptr;
+	emit s_dataSpilled(false);
+}
+
+void ResultSetModel::applyMemoryLimit(void)
+{
+	qint64 total_usage=0;
+
+	for(auto &model : lru_models)
+	{
+		if(!model->spill_file)
+			total_usage+=model->mem_usage;
+	}
+
+	//Spilling the least recently used models first, the first one in the list is the model being used
+	for(auto itr=lru_models.rbegin(); itr!=lru_models.rend() - 1 && total_usage > mem_limit; itr++)
+	{
+		if(!(*itr)->spill_file)
+		{
+			(*itr)->spillData();
+
+			if((*itr)->spill_file)
+				total_usage-=(*itr)->mem_usage;
+		}
+	}
+}
+
+void ResultSetModel::markAsUsed(void)
+{
+	if(registered)
+		lru_models.erase(std::find(lru_models.begin(), lru_models.end(), this));
+
+	registered=true;
+	lru_models.insert(lru_models.begin(), this);
+	reloadData();
+	applyMemoryLimit();
+}
+
+qint64 ResultSetModel::getMemoryUsage(void)
+{
+	return(mem_usage);
+}
+
+bool ResultSetModel::isDataSpilled(void)
+{
+	return(spill_file!=nullptr);
+}
+
+void ResultSetModel::setMemoryLimit(qint64 limit)
+{
+	mem_limit=limit;
+
+	if(!lru_models.empty())
+		applyMemoryLimit();
+}
+
+qint64 ResultSetModel::getMemoryLimit(void)
+{
+	return(mem_limit);
+}
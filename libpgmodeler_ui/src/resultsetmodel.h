@@ -26,6 +26,7 @@
 #define RESULT_SET_MODEL_H
 
 #include <QAbstractTableModel>
+#include <QTemporaryFile>
 #include "resultset.h"
 #include "catalog.h"
 
@@ -33,14 +34,54 @@ class ResultSetModel: public QAbstractTableModel {
 	private:
 		Q_OBJECT
 
+		/*! \brief Models registered in the memory control (see markAsUsed()) ordered
+		 * from the most recently used to the least recently used one */
+		static vector<ResultSetModel *> lru_models;
+
+		//! \brief Maximum amount of memory (in bytes) that the items of all registered models can use together
+		static qint64 mem_limit;
+
 		int col_count, row_count;
 		QStringList item_data, header_data, tooltip_data;
 
+		//! \brief Estimated amount of memory (in bytes) used by the items data
+		qint64 mem_usage;
+
+		/*! \brief Indicates that the model is in the memory control list. Unregistered models can be
+		 * safely created and destroyed outside the main thread since they don't touch the list */
+		bool registered;
+
+		/*! \brief Temporary file that holds the items data while the model is spilled.
+		 * When this file is allocated the item_data list is empty */
+		QTemporaryFile *spill_file;
+
 		void insertColumn(int, const QModelIndex &){}
 		void insertRow(int, const QModelIndex &){}
 
+		//! \brief Appends a value to the items data updating the memory usage
+		void appendItem(const QString &value);
+
+		/*! \brief Writes the items data to a temporary file releasing their memory. Each row is written as a
+		 * sequence of UTF-8 encoded values prefixed by their length, which is the most compact form for text data */
+		void spillData(void);
+
+		//! \brief Reads back the items data previously written by spillData() destroying the temporary file
+		void reloadData(void);
+
+		/*! \brief Spills the least recently used models until the memory used by the registered
+		 * models fits the memory limit. The most recently used model is never spilled */
+		static void applyMemoryLimit(void);
+
 	public:
+		//! \brief Estimated overhead (in bytes) of each item stored in memory
+		static constexpr qint64 ItemOverhead=32;
+
+		//! \brief Default memory limit for all the registered models (512 MB)
+		static constexpr qint64 DefaultMemoryLimit=536870912;
+
 		ResultSetModel(ResultSet &res, Catalog &catalog, QObject *parent = 0);
+		~ResultSetModel(void);
+
 		virtual int rowCount(const QModelIndex & = QModelIndex()) const;
 		virtual int columnCount(const QModelIndex &) const;
 		virtual QModelIndex index(int row, int column, const QModelIndex &parent) const;
@@ -50,6 +91,26 @@ class ResultSetModel: public QAbstractTableModel {
 		virtual Qt::ItemFlags flags(const QModelIndex &) const;
 		void append(ResultSet &res);
 		bool isEmpty(void);
+
+		/*! \brief Registers the model in the memory control (if not registered yet) marking it as the most recently
+		 * used one. If the model's data was spilled it is reloaded and, if needed, other models are spilled to keep the
+		 * memory usage under the limit. This method must be called only from the main (GUI) thread */
+		void markAsUsed(void);
+
+		//! \brief Returns the estimated amount of memory used by the model's data (even if it's currently spilled)
+		qint64 getMemoryUsage(void);
+
+		//! \brief Returns if the model's data is currently stored in a temporary file
+		bool isDataSpilled(void);
+
+		//! \brief Defines the maximum amount of memory (in bytes) that the registered models can use together
+		static void setMemoryLimit(qint64 limit);
+
+		static qint64 getMemoryLimit(void);
+
+	signals:
+		//! \brief Signal emitted whenever the model's data is spilled to a temporary file (true) or reloaded (false)
+		void s_dataSpilled(bool spilled);
 };
 
 #endif
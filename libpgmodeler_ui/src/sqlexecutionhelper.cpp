@@ -17,10 +17,14 @@
 */
 
 #include "sqlexecutionhelper.h"
+#include <QElapsedTimer>
 
 SQLExecutionHelper::SQLExecutionHelper(void) : QObject(nullptr)
 {
 	cancelled = false;
+	run_as_script = false;
+	stop_on_error = true;
+	affected_rows = executed_stmts = failed_stmts = 0;
 	result_model = nullptr;
 }
 
@@ -34,6 +38,12 @@ void SQLExecutionHelper::setCommand(const QString &cmd)
 	command = cmd;
 }
 
+void SQLExecutionHelper::setExecutionOptions(bool run_as_script, bool stop_on_error)
+{
+	this->run_as_script = run_as_script;
+	this->stop_on_error = stop_on_error;
+}
+
 ResultSetModel *SQLExecutionHelper::getResultSetModel(void)
 {
 	return(result_model);
@@ -49,6 +59,85 @@ QStringList SQLExecutionHelper::getNotices(void)
 	return(notices);
 }
 
+bool SQLExecutionHelper::isScriptExecution(void)
+{
+	return(statements.size() > 1);
+}
+
+int SQLExecutionHelper::getStatementCount(void)
+{
+	return(statements.size());
+}
+
+int SQLExecutionHelper::getExecutedStatements(void)
+{
+	return(executed_stmts);
+}
+
+int SQLExecutionHelper::getFailedStatements(void)
+{
+	return(failed_stmts);
+}
+
+void SQLExecutionHelper::executeScript(Catalog &catalog)
+{
+	QElapsedTimer timer;
+	int rows = 0;
+
+	for(int idx = 0; idx < statements.size() && !cancelled; idx++)
+	{
+		ResultSet res;
+
+		timer.start();
+
+		try
+		{
+			connection.executeDMLCommand(statements[idx], res);
+			rows = res.getTupleCount();
+			executed_stmts++;
+
+			if(isDDLCommand(statements[idx]))
+				Catalog::invalidateResultsCache(connection);
+
+			if(!res.isEmpty())
+			{
+				delete(result_model);
+				result_model = new ResultSetModel(res, catalog);
+				affected_rows = rows;
+			}
+
+			emit s_statementExecuted(idx, stmt_lines[idx], rows, !res.isEmpty(), timer.elapsed(), connection.getNotices());
+		}
+		catch(Exception &e)
+		{
+			//There's no reason to proceed with the script when the connection is lost
+			if(e.getErrorCode() == ErrorCode::ConnectionTimeout ||
+				 e.getErrorCode() == ErrorCode::ConnectionBroken || !connection.isStablished())
+				throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+
+			failed_stmts++;
+			emit s_statementFailed(idx, stmt_lines[idx], timer.elapsed(), e.getErrorMessage());
+
+			if(stop_on_error)
+				break;
+		}
+	}
+}
+
+bool SQLExecutionHelper::isDDLCommand(const QString &cmd)
+{
+	QRegExp ddl_regexp(QString("(^|;)\\s*(CREATE|ALTER|DROP|COMMENT|GRANT|REVOKE|SECURITY\\s+LABEL|IMPORT\\s+FOREIGN|REASSIGN|DO)\\b"), Qt::CaseInsensitive),
+			block_comm_regexp(QString("/\\*.*\\*/"));
+	QString sql=cmd;
+
+	//Removing the comments so they don't hide the keywords at the start of the statements
+	block_comm_regexp.setMinimal(true);
+	sql.remove(block_comm_regexp);
+	sql.remove(QRegExp(QString("--[^\\n]*")));
+
+	return(ddl_regexp.indexIn(sql) >= 0);
+}
+
 void SQLExecutionHelper::executeCommand(void)
 {
 	try
@@ -60,6 +149,10 @@ void SQLExecutionHelper::executeCommand(void)
 		catalog.setConnection(aux_conn);
 		result_model = nullptr;
 		cancelled = false;
+		affected_rows = executed_stmts = failed_stmts = 0;
+		statements.clear();
+		stmt_lines.clear();
+		notices.clear();
 
 		if(!connection.isStablished())
 		{
@@ -70,16 +163,32 @@ void SQLExecutionHelper::executeCommand(void)
 			connection.setSQLExecutionTimout(3600);
 		}
 
-		connection.executeDMLCommand(command, res);
-		notices = connection.getNotices();
+		if(run_as_script)
+			statements = SQLScriptParser::splitStatements(command, &stmt_lines);
 
-		if(!res.isEmpty())
-			result_model = new ResultSetModel(res, catalog);
+		if(statements.size() > 1)
+		{
+			executeScript(catalog);
+			emit s_executionFinished(affected_rows);
+		}
+		else
+		{
+			connection.executeDMLCommand(command, res);
+			notices = connection.getNotices();
+
+			if(isDDLCommand(command))
+				Catalog::invalidateResultsCache(connection);
+
+			if(!res.isEmpty())
+				result_model = new ResultSetModel(res, catalog);
 
-		emit s_executionFinished(res.getTupleCount());
+			emit s_executionFinished(res.getTupleCount());
+		}
 	}
 	catch(Exception &e)
 	{
+		delete(result_model);
+		result_model = nullptr;
 		connection.close();
 		emit s_executionAborted(e);
 	}
@@ -27,8 +27,10 @@
 
 #include <QObject>
 #include <QTableWidget>
+#include <atomic>
 #include "connection.h"
 #include "resultsetmodel.h"
+#include "sqlscriptparser.h"
 
 class SQLExecutionHelper : public QObject {
 	private:
@@ -40,11 +42,38 @@ class SQLExecutionHelper : public QObject {
 
 		ResultSetModel *result_model;
 
-		bool cancelled;
+		//! \brief Indicates that the user requested the cancelling. This flag is checked between the statements of a script
+		std::atomic<bool> cancelled;
 
-		int affected_rows;
+		/*! \brief Indicates that the command must be split into statements which are executed one by one (see executeScript()).
+		 * When false the whole command is sent in a single call to the server */
+		bool run_as_script,
 
-		QStringList notices;
+		//! \brief Indicates that the script execution must be interrupted in the first statement that fails
+		stop_on_error;
+
+		int affected_rows,
+
+		//! \brief Amount of statements executed with success/failed in the last script execution
+		executed_stmts, failed_stmts;
+
+		QStringList notices,
+
+		//! \brief Statements of the command being executed as a script
+		statements;
+
+		//! \brief Line (in the command) where each statement of the script starts
+		QList<int> stmt_lines;
+
+		/*! \brief Executes each statement of the script reporting the outcome of each one through the signals
+		 * s_statementExecuted() and s_statementFailed(). Only the result set of the latest statement that returned
+		 * tuples is kept so the memory used doesn't grow with the amount of statements. A broken connection
+		 * interrupts the script raising the error */
+		void executeScript(Catalog &catalog);
+
+		/*! \brief Returns if the provided command has statements that may change the database structure (CREATE, ALTER, DROP, etc).
+		 * This is used to discard the catalog cached results of the server after running the command (see Catalog::invalidateResultsCache()) */
+		static bool isDDLCommand(const QString &cmd);
 
 	public:
 		SQLExecutionHelper(void);
@@ -53,6 +82,9 @@ class SQLExecutionHelper : public QObject {
 
 		void setCommand(const QString &cmd);
 
+		//! \brief Configures how the next command will be executed (see run_as_script and stop_on_error)
+		void setExecutionOptions(bool run_as_script, bool stop_on_error);
+
 		//! \brief Returns the result set model created in the execution. This object is not deleted after the execution.
 		ResultSetModel *getResultSetModel(void);
 
@@ -61,6 +93,18 @@ class SQLExecutionHelper : public QObject {
 		//! \brief Returns the notices generated by the execution
 		QStringList getNotices(void);
 
+		//! \brief Returns if the last command was executed as a script (split in more than one statement)
+		bool isScriptExecution(void);
+
+		//! \brief Returns the amount of statements in the last script executed
+		int getStatementCount(void);
+
+		//! \brief Returns the amount of statements executed with success in the last script execution
+		int getExecutedStatements(void);
+
+		//! \brief Returns the amount of statements that failed in the last script execution
+		int getFailedStatements(void);
+
 	public slots:
 		void executeCommand(void);
 		void cancelCommand(void);
@@ -68,6 +112,12 @@ class SQLExecutionHelper : public QObject {
 	signals:
 		void s_executionFinished(int rows_affected);
 		void s_executionAborted(Exception e);
+
+		//! \brief Signal emitted when a statement of a script is successfully executed
+		void s_statementExecuted(int stmt_idx, int line, int rows, bool has_results, qint64 exec_time, QStringList notices);
+
+		//! \brief Signal emitted when a statement of a script fails
+		void s_statementFailed(int stmt_idx, int line, qint64 exec_time, QString error);
 };
 
 #endif
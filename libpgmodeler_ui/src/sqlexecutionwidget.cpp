@@ -23,8 +23,10 @@
 #include "pgmodeleruins.h"
 #include "plaintextitemdelegate.h"
 #include "datamanipulationform.h"
+#include <QInputDialog>
 
 map<QString, QString> SQLExecutionWidget::cmd_history;
+map<QString, SQLHistoryStore *> SQLExecutionWidget::history_stores;
 
 int SQLExecutionWidget::cmd_history_max_len = 1000;
 const QString SQLExecutionWidget::ColumnNullValue = QString("␀");
@@ -95,6 +97,26 @@ SQLExecutionWidget::SQLExecutionWidget(QWidget * parent) : QWidget(parent)
 	file_menu.addAction(action_save_as);
 	file_tb->setMenu(&file_menu);
 
+	action_run_as_script=exec_menu.addAction(trUtf8("Run statements one by one"));
+	action_run_as_script->setToolTip(trUtf8("Splits the commands into statements which are executed and logged individually. "
+																					 "Each statement runs in its own transaction so the ones executed before a failing statement are kept"));
+	action_run_as_script->setCheckable(true);
+
+	/* The statement by statement execution is disabled by default since the whole command sent in a single call
+	 * runs in an implicit transaction, so a failing script doesn't leave partial changes in the database */
+	action_run_as_script->setChecked(false);
+
+	action_stop_on_error=exec_menu.addAction(trUtf8("Stop on error"));
+	action_stop_on_error->setCheckable(true);
+	action_stop_on_error->setChecked(true);
+	action_stop_on_error->setEnabled(false);
+
+	exec_menu.setToolTipsVisible(true);
+	run_sql_tb->setMenu(&exec_menu);
+	run_sql_tb->setPopupMode(QToolButton::MenuButtonPopup);
+
+	connect(action_run_as_script, SIGNAL(toggled(bool)), action_stop_on_error, SLOT(setEnabled(bool)));
+
 	filter_wgt->setVisible(false);
 
 	connect(columns_cmb, SIGNAL(currentIndexChanged(int)), this, SLOT(filterResults()));
@@ -162,6 +184,8 @@ SQLExecutionWidget::SQLExecutionWidget(QWidget * parent) : QWidget(parent)
 	connect(&sql_exec_hlp, SIGNAL(s_executionFinished(int)), this, SLOT(finishExecution(int)));
 	connect(&sql_exec_hlp, SIGNAL(s_executionAborted(Exception)), &sql_exec_thread, SLOT(quit()));
 	connect(&sql_exec_hlp, SIGNAL(s_executionAborted(Exception)), this, SLOT(handleExecutionAborted(Exception)));
+	connect(&sql_exec_hlp, SIGNAL(s_statementExecuted(int,int,int,bool,qint64,QStringList)), this, SLOT(logStatementExecuted(int,int,int,bool,qint64,QStringList)));
+	connect(&sql_exec_hlp, SIGNAL(s_statementFailed(int,int,qint64,QString)), this, SLOT(logStatementFailed(int,int,qint64,QString)));
 	connect(stop_tb, SIGNAL(clicked(bool)), &sql_exec_hlp, SLOT(cancelCommand()), Qt::DirectConnection);
 }
 
@@ -174,6 +198,8 @@ SQLExecutionWidget::~SQLExecutionWidget(void)
 		sql_exec_thread.wait();
 	}
 
+	//Avoids notifying the memory info change during the destruction
+	this->blockSignals(true);
 	destroyResultModel();
 }
 
@@ -194,11 +220,12 @@ bool SQLExecutionWidget::eventFilter(QObject *object, QEvent *event)
 	}
 	else if(event->type() == QEvent::Show && object == output_tbw->widget(2))
 	{
-		if(cmd_history_txt->toPlainText().count(QChar('\n')) !=
-			 cmd_history[sql_cmd_conn.getConnectionId(true,true)].count(QChar('\n')))
+		QString &history=getSQLHistory(sql_cmd_conn.getConnectionId(true,true));
+
+		if(cmd_history_txt->toPlainText().count(QChar('\n')) != history.count(QChar('\n')))
 		{
 			cmd_history_txt->clear();
-			cmd_history_txt->appendPlainText(cmd_history[sql_cmd_conn.getConnectionId(true,true)]);
+			cmd_history_txt->appendPlainText(history);
 			cmd_history_txt->updateLineNumbers();
 		}
 
@@ -235,6 +262,13 @@ void SQLExecutionWidget::enableCommandButtons(void)
 
 void SQLExecutionWidget::showEvent(QShowEvent *)
 {
+	ResultSetModel *res_model = dynamic_cast<ResultSetModel *>(results_tbw->model());
+
+	/* Marking the results as recently used so they are reloaded (if spilled) and
+	 * the results of other tabs are spilled first when the memory limit is reached */
+	if(res_model)
+		res_model->markAsUsed();
+
 	sql_cmd_txt->setFocus();
 }
 
@@ -365,7 +399,10 @@ void SQLExecutionWidget::handleExecutionAborted(Exception e)
 	QString time_str=QString("[%1]:").arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz")));
 
 	switchToExecutionMode(false);
-	msgoutput_lst->clear();
+
+	//The log of the statements executed so far is kept when running scripts
+	if(!sql_exec_hlp.isScriptExecution())
+		msgoutput_lst->clear();
 
 	PgModelerUiNs::createOutputListItem(msgoutput_lst,
 										PgModelerUiNs::formatMessage(QString("%1 %2").arg(time_str).arg(e.getErrorMessage())),
@@ -390,13 +427,24 @@ void SQLExecutionWidget::handleExecutionAborted(Exception e)
 	output_tbw->setCurrentIndex(1);
 	output_tbw->setTabEnabled(0, false);
 
-	addToSQLHistory(sql_cmd_txt->toPlainText(), 0, e.getErrorMessage());
+	addToSQLHistory(sql_cmd_txt->toPlainText(), 0, e.getErrorMessage(), QDateTime::currentDateTime().toMSecsSinceEpoch() - start_exec);
 }
 
 void SQLExecutionWidget::finishExecution(int rows_affected)
 {
 	if(sql_exec_hlp.isCancelled())
+	{
 		destroyResultModel();
+
+		if(sql_exec_hlp.isScriptExecution())
+		{
+			addScriptLogItem(trUtf8("[%1]: Script execution cancelled by the user. Statements executed: <strong>%2</strong> of <strong>%3</strong>.")
+											 .arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz")))
+											 .arg(sql_exec_hlp.getExecutedStatements()).arg(sql_exec_hlp.getStatementCount()),
+											 QString("msgbox_alerta"), true);
+			output_tbw->setTabText(1, trUtf8("Messages (%1)").arg(msgoutput_lst->count()));
+		}
+	}
 	else
 	{
 		bool empty = false;
@@ -411,6 +459,12 @@ void SQLExecutionWidget::finishExecution(int rows_affected)
 
 		destroyResultModel();
 
+		if(res_model)
+		{
+			connect(res_model, SIGNAL(s_dataSpilled(bool)), this, SLOT(updateResultsMemoryInfo()));
+			res_model->markAsUsed();
+		}
+
 		results_tbw->setModel(res_model);
 		results_tbw->resizeColumnsToContents();
 		results_tbw->setUpdatesEnabled(true);
@@ -428,7 +482,9 @@ void SQLExecutionWidget::finishExecution(int rows_affected)
 
 		columns_cmb->blockSignals(false);
 
-		addToSQLHistory(sql_cmd_txt->toPlainText(), rows_affected);
+		addToSQLHistory(sql_cmd_txt->toPlainText(), rows_affected,
+										sql_exec_hlp.getFailedStatements() > 0 ? trUtf8("%1 statement(s) failed").arg(sql_exec_hlp.getFailedStatements()) : QString(),
+										total_exec);
 
 		empty = (!res_model || res_model->rowCount() == 0);
 		output_tbw->setTabEnabled(0, !empty);
@@ -447,30 +503,119 @@ void SQLExecutionWidget::finishExecution(int rows_affected)
 			output_tbw->setCurrentIndex(1);
 		}
 
-		msgoutput_lst->clear();
-
-		for(QString notice : sql_exec_hlp.getNotices())
+		if(sql_exec_hlp.isScriptExecution())
 		{
-			PgModelerUiNs::createOutputListItem(msgoutput_lst,
-																					QString("[%1]: %2").arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz"))).arg(notice.trimmed()),
-																					QPixmap(PgModelerUiNs::getIconPath("msgbox_alerta")), false);
+			//The statements were already logged during the execution so only a summary is appended
+			addScriptLogItem(trUtf8("[%1]: Script executed in <em><strong>%2</strong></em>. Statements executed: <strong>%3</strong> of <strong>%4</strong>. Failed: <strong>%5</strong>")
+											 .arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz")))
+											 .arg(formatExecutionTime(total_exec))
+											 .arg(sql_exec_hlp.getExecutedStatements())
+											 .arg(sql_exec_hlp.getStatementCount())
+											 .arg(sql_exec_hlp.getFailedStatements()),
+											 sql_exec_hlp.getFailedStatements() > 0 ? QString("msgbox_alerta") : QString("msgbox_info"), true);
 		}
+		else
+		{
+			msgoutput_lst->clear();
 
-		PgModelerUiNs::createOutputListItem(msgoutput_lst,
-																				PgModelerUiNs::formatMessage(trUtf8("[%1]: SQL command successfully executed in <em><strong>%2</strong></em>. <em>%3 <strong>%4</strong></em>")
-																																		 .arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz")))
-																																		 .arg(total_exec >= 1000 ? QString("%1 s").arg(total_exec/1000.0) : QString("%1 ms").arg(total_exec))
-																																		 .arg(!res_model ? trUtf8("Rows affected") :  trUtf8("Rows retrieved"))
-																																		 .arg(rows_affected)),
-																				QPixmap(PgModelerUiNs::getIconPath("msgbox_info")));
+			for(QString notice : sql_exec_hlp.getNotices())
+			{
+				PgModelerUiNs::createOutputListItem(msgoutput_lst,
+																						QString("[%1]: %2").arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz"))).arg(notice.trimmed()),
+																						QPixmap(PgModelerUiNs::getIconPath("msgbox_alerta")), false);
+			}
+
+			PgModelerUiNs::createOutputListItem(msgoutput_lst,
+																					PgModelerUiNs::formatMessage(trUtf8("[%1]: SQL command successfully executed in <em><strong>%2</strong></em>. <em>%3 <strong>%4</strong></em>")
+																																			 .arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz")))
+																																			 .arg(formatExecutionTime(total_exec))
+																																			 .arg(!res_model ? trUtf8("Rows affected") :  trUtf8("Rows retrieved"))
+																																			 .arg(rows_affected)),
+																					QPixmap(PgModelerUiNs::getIconPath("msgbox_info")));
+		}
 
 		output_tbw->setTabText(1, trUtf8("Messages (%1)").arg(msgoutput_lst->count()));
+		updateResultsMemoryInfo();
 	}
 
 	switchToExecutionMode(false);
 	sql_exec_thread.quit();
 }
 
+void SQLExecutionWidget::logStatementExecuted(int stmt_idx, int line, int rows, bool has_results, qint64 exec_time, QStringList notices)
+{
+	QString time_str = QTime::currentTime().toString(QString("hh:mm:ss.zzz"));
+
+	for(QString notice : notices)
+		addScriptLogItem(QString("[%1]: %2").arg(time_str).arg(notice.trimmed()), QString("msgbox_alerta"), false);
+
+	addScriptLogItem(trUtf8("[%1]: Statement <strong>%2</strong> of <strong>%3</strong> (line %4) executed in <em><strong>%5</strong></em>. <em>%6 <strong>%7</strong></em>")
+									 .arg(time_str).arg(stmt_idx + 1).arg(sql_exec_hlp.getStatementCount()).arg(line)
+									 .arg(formatExecutionTime(exec_time))
+									 .arg(has_results ? trUtf8("Rows retrieved") : trUtf8("Rows affected"))
+									 .arg(rows),
+									 QString("msgbox_info"), true);
+
+	output_tbw->setTabText(1, trUtf8("Messages (%1)").arg(msgoutput_lst->count()));
+}
+
+void SQLExecutionWidget::logStatementFailed(int stmt_idx, int line, qint64 exec_time, QString error)
+{
+	addScriptLogItem(trUtf8("[%1]: Statement <strong>%2</strong> of <strong>%3</strong> (line %4) failed after <em><strong>%5</strong></em>: %6")
+									 .arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz")))
+									 .arg(stmt_idx + 1).arg(sql_exec_hlp.getStatementCount()).arg(line)
+									 .arg(formatExecutionTime(exec_time))
+									 .arg(PgModelerUiNs::formatMessage(error)),
+									 QString("msgbox_erro"), true);
+
+	output_tbw->setTabText(1, trUtf8("Messages (%1)").arg(msgoutput_lst->count()));
+}
+
+void SQLExecutionWidget::addScriptLogItem(const QString &msg, const QString &icon, bool is_formated)
+{
+	while(msgoutput_lst->count() >= ScriptLogMaxItems)
+		delete(msgoutput_lst->takeItem(0));
+
+	PgModelerUiNs::createOutputListItem(msgoutput_lst, msg, QPixmap(PgModelerUiNs::getIconPath(icon)), is_formated);
+	msgoutput_lst->scrollToBottom();
+}
+
+QString SQLExecutionWidget::formatExecutionTime(qint64 exec_time)
+{
+	return(exec_time >= 1000 ? QString("%1 s").arg(exec_time/1000.0) : QString("%1 ms").arg(exec_time));
+}
+
+QString SQLExecutionWidget::formatMemorySize(qint64 size)
+{
+	if(size >= 1048576)
+		return(QString("%1 MB").arg(size/1048576.0, 0, 'f', 1));
+
+	return(QString("%1 KB").arg(size/1024.0, 0, 'f', 1));
+}
+
+QString SQLExecutionWidget::getResultsMemoryInfo(void)
+{
+	ResultSetModel *res_model = dynamic_cast<ResultSetModel *>(results_tbw->model());
+
+	if(!res_model)
+		return(QString());
+
+	if(res_model->isDataSpilled())
+		return(trUtf8("Results: %1 row(s), %2 stored in a temporary file")
+					 .arg(res_model->rowCount()).arg(formatMemorySize(res_model->getMemoryUsage())));
+
+	return(trUtf8("Results: %1 row(s), %2 in memory")
+				 .arg(res_model->rowCount()).arg(formatMemorySize(res_model->getMemoryUsage())));
+}
+
+void SQLExecutionWidget::updateResultsMemoryInfo(void)
+{
+	QString info = getResultsMemoryInfo();
+
+	output_tbw->setTabToolTip(0, info);
+	emit s_resultsMemoryChanged(info);
+}
+
 void SQLExecutionWidget::filterResults(void)
 {
 	QModelIndexList list;
@@ -507,34 +652,128 @@ void SQLExecutionWidget::filterResults(void)
 	results_tbw->update();
 }
 
-void SQLExecutionWidget::addToSQLHistory(const QString &cmd, unsigned rows, const QString &error)
+void SQLExecutionWidget::addToSQLHistory(const QString &cmd, unsigned rows, const QString &error, qint64 exec_time)
 {
 	if(!cmd.isEmpty())
 	{
-		QString fmt_cmd;
+		QString fmt_cmd, conn_id=sql_cmd_conn.getConnectionId(true,true);
+		SQLHistoryEntry entry;
+
+		entry.timestamp=QDateTime::currentDateTime().toMSecsSinceEpoch();
+		entry.exec_time=exec_time;
+		entry.rows=rows;
+		entry.command=cmd;
+		entry.error=error;
+
+		//Loading the current history before storing the new entry so it isn't displayed twice
+		getSQLHistory(conn_id);
+
+		if(!conn_id.isEmpty())
+		{
+			try
+			{
+				getHistoryStore(conn_id)->addEntry(entry);
+			}
+			catch(Exception &e)
+			{
+				PgModelerUiNs::createOutputListItem(msgoutput_lst,
+																						PgModelerUiNs::formatMessage(e.getErrorMessage()),
+																						QPixmap(PgModelerUiNs::getIconPath("msgbox_alerta")));
+			}
+		}
 
 		if(!cmd_history_txt->toPlainText().isEmpty())
 			fmt_cmd += QString("\n");
 
-		fmt_cmd += QString("-- %1 [%2] -- \n")
-							 .arg(trUtf8("Executed at"))
-							 .arg(QDateTime::currentDateTime().toString(QString("yyyy-MM-dd hh:mm:ss.zzz")));
-		fmt_cmd += cmd;
-		fmt_cmd += QChar('\n');
+		fmt_cmd += formatHistoryEntry(entry);
+		SQLExecutionWidget::validateSQLHistoryLength(conn_id, fmt_cmd, cmd_history_txt);
+	}
+}
+
+QString SQLExecutionWidget::formatHistoryEntry(const SQLHistoryEntry &entry)
+{
+	QString fmt_cmd;
+
+	fmt_cmd += QString("-- %1 [%2] -- \n")
+						 .arg(trUtf8("Executed at"))
+						 .arg(QDateTime::fromMSecsSinceEpoch(entry.timestamp).toString(QString("yyyy-MM-dd hh:mm:ss.zzz")));
+	fmt_cmd += entry.command;
+	fmt_cmd += QChar('\n');
+
+	if(!entry.error.isEmpty())
+	{
+		fmt_cmd += QString("-- %1 --\n").arg(trUtf8("Command failed"));
+		fmt_cmd += QString("/*\n%1\n*/\n").arg(entry.error);
+	}
+	else
+		fmt_cmd += QString("-- %1 %2 (%3 ms)\n").arg(trUtf8("Rows:")).arg(entry.rows).arg(entry.exec_time);
+
+	if(!fmt_cmd.trimmed().endsWith(Attributes::DdlEndToken))
+		fmt_cmd += Attributes::DdlEndToken + QChar('\n');
+
+	return(fmt_cmd);
+}
+
+SQLHistoryStore *SQLExecutionWidget::getHistoryStore(const QString &conn_id)
+{
+	if(history_stores.count(conn_id) == 0)
+		history_stores[conn_id]=new SQLHistoryStore(conn_id);
 
-		if(!error.isEmpty())
+	return(history_stores[conn_id]);
+}
+
+QString &SQLExecutionWidget::getSQLHistory(const QString &conn_id)
+{
+	if(cmd_history.count(conn_id) == 0)
+	{
+		vector<SQLHistoryEntry> entries;
+		QStringList cmds;
+		QString fmt_cmd;
+		int ln_count=0;
+
+		if(!conn_id.isEmpty())
+			entries=getHistoryStore(conn_id)->getLastEntries(HistoryLoadLimit);
+
+		//Loading the newest commands until the maximum history length is reached
+		for(auto itr=entries.rbegin(); itr != entries.rend(); itr++)
 		{
-			fmt_cmd += QString("-- %1 --\n").arg(trUtf8("Command failed"));
-			fmt_cmd += QString("/*\n%1\n*/\n").arg(error);
-		}
-		else
-			fmt_cmd += QString("-- %1 %2\n").arg(trUtf8("Rows:")).arg(rows);
+			fmt_cmd=formatHistoryEntry(*itr);
+			ln_count+=fmt_cmd.count(QChar('\n')) + 1;
+
+			if(ln_count > cmd_history_max_len && !cmds.isEmpty())
+				break;
 
-		if(!fmt_cmd.trimmed().endsWith(Attributes::DdlEndToken))
-			fmt_cmd += Attributes::DdlEndToken + QChar('\n');
+			cmds.prepend(fmt_cmd);
+		}
 
-		SQLExecutionWidget::validateSQLHistoryLength(sql_cmd_conn.getConnectionId(true,true), fmt_cmd, cmd_history_txt);
+		cmd_history[conn_id]=cmds.join(QChar('\n'));
 	}
+
+	return(cmd_history[conn_id]);
+}
+
+void SQLExecutionWidget::searchSQLHistory(bool prefix_only)
+{
+	bool ok=false;
+	QString text=QInputDialog::getText(this, prefix_only ? trUtf8("Find commands starting with") : trUtf8("Find commands containing"),
+																		 trUtf8("Text:"), QLineEdit::Normal, QString(), &ok);
+	vector<SQLHistoryEntry> entries;
+	QString conn_id=sql_cmd_conn.getConnectionId(true,true);
+
+	if(!ok || text.isEmpty() || conn_id.isEmpty())
+		return;
+
+	QApplication::setOverrideCursor(Qt::WaitCursor);
+	entries=getHistoryStore(conn_id)->findEntries(text, prefix_only, HistoryLoadLimit);
+
+	cmd_history_txt->clear();
+	cmd_history_txt->appendPlainText(QString("-- %1 --\n").arg(trUtf8("%1 command(s) found for: %2").arg(entries.size()).arg(text)));
+
+	for(auto &entry : entries)
+		cmd_history_txt->appendPlainText(formatHistoryEntry(entry));
+
+	cmd_history_txt->updateLineNumbers();
+	QApplication::restoreOverrideCursor();
 }
 
 void SQLExecutionWidget::validateSQLHistoryLength(const QString &conn_id, const QString &fmt_cmd, NumberedTextEditor *cmd_history_txt)
@@ -604,6 +843,8 @@ void SQLExecutionWidget::destroyResultModel(void)
 		results_tbw->setModel(nullptr);
 		delete(result_model);
 		results_tbw->blockSignals(false);
+		output_tbw->setTabToolTip(0, QString());
+		emit s_resultsMemoryChanged(QString());
 	}
 }
 
@@ -620,6 +861,7 @@ void SQLExecutionWidget::runSQLCommand(void)
 
 	msgoutput_lst->clear();
 	sql_exec_hlp.setCommand(cmd);
+	sql_exec_hlp.setExecutionOptions(action_run_as_script->isChecked(), action_stop_on_error->isChecked());
 	start_exec=QDateTime::currentDateTime().toMSecsSinceEpoch();
 	sql_exec_thread.start();
 	switchToExecutionMode(true);
@@ -928,65 +1170,27 @@ void SQLExecutionWidget::configureSnippets(void)
 	code_compl_wgt->configureCompletion(nullptr, sql_cmd_hl);
 }
 
-void SQLExecutionWidget::saveSQLHistory(void)
+void SQLExecutionWidget::importLegacySQLHistory(void)
 {
-	try
-	{
-		SchemaParser schparser;
-		attribs_map attribs;
-		QString commands;
-		QByteArray buffer;
-		QFile file;
-
-		for(auto hist : cmd_history)
-		{
-			attribs[Attributes::Connection] = hist.first;
-			attribs[Attributes::Commands] = hist.second;
-			schparser.ignoreEmptyAttributes(true);
-			commands += schparser.getCodeDefinition(GlobalAttributes::TmplConfigurationDir +
-																							GlobalAttributes::DirSeparator +
-																							GlobalAttributes::SchemasDir +
-																							GlobalAttributes::DirSeparator +
-																							Attributes::Commands +
-																							GlobalAttributes::SchemaExt, attribs);
-		}
-
-		schparser.loadFile(GlobalAttributes::TmplConfigurationDir +
-											 GlobalAttributes::DirSeparator +
-											 GlobalAttributes::SchemasDir +
-											 GlobalAttributes::DirSeparator +
-											 GlobalAttributes::SQLHistoryConf +
-											 GlobalAttributes::SchemaExt);
-
-		attribs.clear();
-		attribs[Attributes::Commands] = commands;
-		buffer.append(schparser.getCodeDefinition(attribs));
-
+	QString filename=GlobalAttributes::ConfigurationsDir +
+									 GlobalAttributes::DirSeparator +
+									 GlobalAttributes::SQLHistoryConf +
+									 GlobalAttributes::ConfigurationExt;
 
-		file.setFileName(GlobalAttributes::ConfigurationsDir +
-										 GlobalAttributes::DirSeparator +
-										 GlobalAttributes::SQLHistoryConf +
-										 GlobalAttributes::ConfigurationExt);
+	if(!QFileInfo(filename).exists())
+		return;
 
-		if(!file.open(QFile::WriteOnly))
-			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(file.fileName()),
-											ErrorCode::FileDirectoryNotAccessed, __PRETTY_FUNCTION__, __FILE__ ,__LINE__);
-
-		file.write(buffer);
-		file.close();
-	}
-	catch(Exception &e)
-	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-	}
-}
-
-void SQLExecutionWidget::loadSQLHistory(void)
-{
 	try
 	{
 		XmlParser xmlparser;
 		attribs_map attribs;
+		map<QString, QString> legacy_history;
+		QRegExp header_regexp(QString("^-- .+ \\[(\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}\\.\\d{3})\\] -- $")),
+				rows_regexp(QString("^-- .+ (\\d+)$"));
+		QStringList lines;
+		SQLHistoryEntry entry;
+		QString err_marker=QString("-- %1 --").arg(trUtf8("Command failed"));
+		bool in_error=false;
 
 		xmlparser.setDTDFile(GlobalAttributes::TmplConfigurationDir +
 												 GlobalAttributes::DirSeparator +
@@ -996,12 +1200,7 @@ void SQLExecutionWidget::loadSQLHistory(void)
 												 GlobalAttributes::ObjectDTDExt,
 												 GlobalAttributes::SQLHistoryConf);
 
-		xmlparser.loadXMLFile(GlobalAttributes::ConfigurationsDir +
-													GlobalAttributes::DirSeparator +
-													GlobalAttributes::SQLHistoryConf +
-													GlobalAttributes::ConfigurationExt);
-
-		cmd_history.clear();
+		xmlparser.loadXMLFile(filename);
 
 		if(xmlparser.accessElement(XmlParser::ChildElement))
 		{
@@ -1013,13 +1212,73 @@ void SQLExecutionWidget::loadSQLHistory(void)
 					xmlparser.savePosition();
 
 					if(xmlparser.accessElement(XmlParser::ChildElement))
-						cmd_history[attribs[Attributes::Connection]].append(xmlparser.getElementContent());
+						legacy_history[attribs[Attributes::Connection]].append(xmlparser.getElementContent());
 
 					xmlparser.restorePosition();
 				}
 			}
 			while(xmlparser.accessElement(XmlParser::NextElement));
 		}
+
+		/* Splitting the formatted history of each connection in entries. Each command starts with a
+		 * header line containing the execution timestamp and is followed by the command itself, the
+		 * amount of rows (or the error message between comments) and the DDL end token */
+		for(auto &hist : legacy_history)
+		{
+			SQLHistoryStore *store=getHistoryStore(hist.first);
+			lines=hist.second.split(QChar('\n'));
+			entry=SQLHistoryEntry();
+
+			for(auto &line : lines)
+			{
+				if(header_regexp.exactMatch(line))
+				{
+					entry=SQLHistoryEntry();
+					entry.timestamp=QDateTime::fromString(header_regexp.cap(1), QString("yyyy-MM-dd hh:mm:ss.zzz")).toMSecsSinceEpoch();
+					in_error=false;
+				}
+				else if(line.trimmed() == Attributes::DdlEndToken)
+				{
+					entry.command=entry.command.trimmed();
+					entry.error=entry.error.trimmed();
+
+					if(!entry.command.isEmpty())
+						store->addEntry(entry);
+
+					entry=SQLHistoryEntry();
+				}
+				else if(line == err_marker)
+					in_error=true;
+				else if(in_error)
+				{
+					if(line != QString("/*") && line != QString("*/"))
+						entry.error += line + QChar('\n');
+				}
+				else if(rows_regexp.exactMatch(line) && line.startsWith(QString("-- %1").arg(trUtf8("Rows:"))))
+					entry.rows=rows_regexp.cap(1).toLongLong();
+				else
+					entry.command += line + QChar('\n');
+			}
+		}
+
+		QFile::remove(filename);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void SQLExecutionWidget::loadSQLHistory(void)
+{
+	try
+	{
+		for(auto &itr : history_stores)
+			delete(itr.second);
+
+		history_stores.clear();
+		cmd_history.clear();
+		importLegacySQLHistory();
 	}
 	catch(Exception &e)
 	{
@@ -1041,7 +1300,12 @@ void SQLExecutionWidget::destroySQLHistory(void)
 									GlobalAttributes::SQLHistoryConf +
 									GlobalAttributes::ConfigurationExt);
 
+		for(auto &itr : history_stores)
+			delete(itr.second);
+
+		SQLExecutionWidget::history_stores.clear();
 		SQLExecutionWidget::cmd_history.clear();
+		SQLHistoryStore::clearAll();
 	}
 }
 
@@ -1079,20 +1343,26 @@ void SQLExecutionWidget::showHistoryContextMenu(void)
 {
 	QMenu *ctx_menu=cmd_history_txt->createStandardContextMenu();
 	QAction *action_clear = new QAction(QPixmap(PgModelerUiNs::getIconPath("limpartexto")), trUtf8("Clear history"), ctx_menu),
-			*action_save = new QAction(QPixmap(PgModelerUiNs::getIconPath("salvar")), trUtf8("Save history"), ctx_menu),
 			*action_reload = new QAction(QPixmap(PgModelerUiNs::getIconPath("atualizar")), trUtf8("Reload history"), ctx_menu),
+			*action_search = new QAction(QPixmap(PgModelerUiNs::getIconPath("buscar")), trUtf8("Find commands containing..."), ctx_menu),
+			*action_search_prefix = new QAction(trUtf8("Find commands starting with..."), ctx_menu),
 			*action_toggle_find = nullptr,
 			*exec_act = nullptr;
+	QString conn_id=sql_cmd_conn.getConnectionId(true,true);
 
 	if(!find_history_parent->isVisible())
 		action_toggle_find = new QAction(QPixmap(PgModelerUiNs::getIconPath("buscar")), trUtf8("Find in history"), ctx_menu);
 	else
 		action_toggle_find = new QAction(trUtf8("Hide find tool"), ctx_menu);
 
+	action_search->setEnabled(!conn_id.isEmpty());
+	action_search_prefix->setEnabled(!conn_id.isEmpty());
+
 	ctx_menu->addSeparator();
 	ctx_menu->addAction(action_toggle_find);
+	ctx_menu->addAction(action_search);
+	ctx_menu->addAction(action_search_prefix);
 	ctx_menu->addAction(action_reload);
-	ctx_menu->addAction(action_save);
 	ctx_menu->addSeparator();
 	ctx_menu->addAction(action_clear);
 
@@ -1108,18 +1378,21 @@ void SQLExecutionWidget::showHistoryContextMenu(void)
 		if(msg_box.result() == QDialog::Accepted)
 		{
 			cmd_history_txt->clear();
-			cmd_history[sql_cmd_conn.getConnectionId(true,true)].clear();
+			cmd_history[conn_id].clear();
+
+			if(!conn_id.isEmpty())
+				getHistoryStore(conn_id)->clear();
 		}
 	}
-	else if(exec_act == action_save)
-		SQLExecutionWidget::saveSQLHistory();
 	else if(exec_act == action_reload)
 	{
-		SQLExecutionWidget::loadSQLHistory();
+		cmd_history.erase(conn_id);
 		cmd_history_txt->clear();
-		cmd_history_txt->appendPlainText(cmd_history[sql_cmd_conn.getConnectionId(true,true)]);
+		cmd_history_txt->appendPlainText(getSQLHistory(conn_id));
 		cmd_history_hl->rehighlight();
 	}
+	else if(exec_act == action_search || exec_act == action_search_prefix)
+		searchSQLHistory(exec_act == action_search_prefix);
 	else if(exec_act == action_toggle_find)
 		find_history_parent->setVisible(!find_history_parent->isVisible());
 
@@ -35,13 +35,19 @@
 #include "findreplacewidget.h"
 #include "resultsetmodel.h"
 #include "sqlexecutionhelper.h"
+#include "sqlhistorystore.h"
 
 class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 	private:
 		Q_OBJECT
 
+		/*! \brief Stores the formatted commands history (only the latest commands) of each connection being displayed.
+		 * The complete history is kept in the stores and is loaded lazily (see getSQLHistory()) */
 		static map<QString, QString> cmd_history;
 
+		//! \brief Persistent history stores of each connection (created on demand)
+		static map<QString, SQLHistoryStore *> history_stores;
+
 		static int cmd_history_max_len;
 
 		qint64 start_exec, end_exec, total_exec;
@@ -66,9 +72,14 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 
 		QMenu snippets_menu,
 
-		file_menu;
+		file_menu,
+
+		//! \brief Menu holding the script execution options
+		exec_menu;
+
+		QAction *action_save, *action_save_as, *action_load,
 
-		QAction *action_save, *action_save_as, *action_load;
+		*action_run_as_script, *action_stop_on_error;
 
 		FindReplaceWidget *find_replace_wgt;
 
@@ -81,7 +92,24 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 		void enableSQLExecution(bool enable);
 
 		//! \brief Stores the command on the sql command history
-		void addToSQLHistory(const QString &cmd, unsigned rows=0, const QString &error=QString());
+		void addToSQLHistory(const QString &cmd, unsigned rows=0, const QString &error=QString(), qint64 exec_time=0);
+
+		//! \brief Returns the history store of the provided connection creating it if needed
+		static SQLHistoryStore *getHistoryStore(const QString &conn_id);
+
+		/*! \brief Returns the formatted history of the provided connection. In the first call for a connection
+		 * the latest commands (respecting the history max length) are loaded from its store */
+		static QString &getSQLHistory(const QString &conn_id);
+
+		//! \brief Formats the history entry to be displayed in the history field
+		static QString formatHistoryEntry(const SQLHistoryEntry &entry);
+
+		/*! \brief Moves the commands in the legacy history file (sql-history.conf) to the history stores.
+		 * The legacy file is removed after a successful import */
+		static void importLegacySQLHistory(void);
+
+		//! \brief Displays the commands of the current connection's history that contain (or start with) a text typed by the user
+		void searchSQLHistory(bool prefix_only);
 
 		static void validateSQLHistoryLength(const QString &conn_id, const QString &fmt_cmd = QString(), NumberedTextEditor *cmd_history_txt = nullptr);
 
@@ -89,6 +117,15 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 
 		void destroyResultModel(void);
 
+		//! \brief Appends an item to the messages output respecting the ScriptLogMaxItems limit
+		void addScriptLogItem(const QString &msg, const QString &icon, bool is_formated);
+
+		//! \brief Returns the execution time formatted in seconds or milliseconds
+		static QString formatExecutionTime(qint64 exec_time);
+
+		//! \brief Returns the amount of memory formatted in kilobytes or megabytes
+		static QString formatMemorySize(qint64 size);
+
 	protected:
 		//! \brief Widget that serves as SQL commands input
 		NumberedTextEditor *sql_cmd_txt,
@@ -108,6 +145,10 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 		//! \brief Configures the connection to query the server
 		void setConnection(Connection conn);
 
+		/*! \brief Returns a text describing the memory used by the current results and where they are stored
+		 * (in memory or in a temporary file). An empty string is returned when there are no results */
+		QString getResultsMemoryInfo(void);
+
 		//! \brief Insert the provided sql commands in the input field. This method clears the current commands before adding new content
 		void setSQLCommand(const QString &sql);
 
@@ -130,10 +171,15 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 		//! \brief Exports the results to csv file
 		static void exportResults(QTableView *results_tbw);
 
-		//! \brief Save the history of all connections open in the SQL Execution to the sql-history.conf
-		static void saveSQLHistory(void);
+		//! \brief Maximum amount of commands loaded from a history store to be displayed
+		static constexpr unsigned HistoryLoadLimit=500;
+
+		/*! \brief Maximum amount of items in the messages output when running scripts. When this limit is reached
+		 * the oldest items are removed so huge scripts don't exhaust the memory with log entries */
+		static constexpr int ScriptLogMaxItems=2000;
 
-		//! \brief Load the history from the file sql-history.conf
+		/*! \brief Prepares the history stores to be used, importing the legacy history file if it exists.
+		 * No command is read here since the history of each connection is loaded on demand */
 		static void loadSQLHistory(void);
 
 		static void destroySQLHistory(void);
@@ -142,6 +188,10 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 
 		static int getSQLHistoryMaxLength(void);
 
+	signals:
+		//! \brief Signal emitted whenever the results are replaced, destroyed, spilled to or reloaded from a temporary file
+		void s_resultsMemoryChanged(QString info);
+
 	public slots:
 		void configureSnippets(void);
 
@@ -172,8 +222,17 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 
 		void finishExecution(int rows_affected = 0);
 
+		//! \brief Logs the outcome of a statement successfully executed in a script
+		void logStatementExecuted(int stmt_idx, int line, int rows, bool has_results, qint64 exec_time, QStringList notices);
+
+		//! \brief Logs the error raised by a statement in a script
+		void logStatementFailed(int stmt_idx, int line, qint64 exec_time, QString error);
+
 		void filterResults(void);
 
+		//! \brief Updates the tooltip of the results tab with the memory info of the results
+		void updateResultsMemoryInfo(void);
+
 		friend class SQLToolWidget;
 };
 
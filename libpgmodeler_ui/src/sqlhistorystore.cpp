@@ -0,0 +1,307 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "sqlhistorystore.h"
+#include "globalattributes.h"
+#include <QFile>
+#include <QDir>
+#include <QDataStream>
+#include <QCryptographicHash>
+#include <algorithm>
+
+const QString SQLHistoryStore::DataExt=QString(".hst");
+const QString SQLHistoryStore::IndexExt=QString(".idx");
+const QString SQLHistoryStore::TrigramExt=QString(".tri");
+
+SQLHistoryStore::SQLHistoryStore(const QString &key)
+{
+	this->key=key;
+	basename=QString(QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Md5).toHex());
+	trigrams_loaded=false;
+}
+
+QString SQLHistoryStore::getStoresDir(void)
+{
+	return(GlobalAttributes::ConfigurationsDir + GlobalAttributes::DirSeparator + GlobalAttributes::SQLHistoryDir);
+}
+
+QString SQLHistoryStore::getFilename(const QString &ext)
+{
+	return(getStoresDir() + GlobalAttributes::DirSeparator + basename + ext);
+}
+
+QSet<quint32> SQLHistoryStore::getTrigrams(const QString &text)
+{
+	QSet<quint32> trigrams;
+	QString lc_text=text.toLower();
+	const QChar *chr=lc_text.constData();
+	quint32 hash=0;
+
+	for(int i=0; i + 2 < lc_text.size(); i++)
+	{
+		//FNV-1a hash of the three UTF-16 code units (stable between runs since it's persisted)
+		hash=2166136261u;
+
+		for(int j=0; j < 3; j++)
+		{
+			hash=(hash ^ chr[i + j].unicode()) * 16777619u;
+		}
+
+		trigrams.insert(hash);
+	}
+
+	return(trigrams);
+}
+
+unsigned SQLHistoryStore::getEntryCount(void)
+{
+	QFileInfo fi(getFilename(IndexExt));
+
+	//Incomplete entries (due to an interrupted write) are ignored
+	return(fi.exists() ? static_cast<unsigned>(fi.size() / IndexEntrySize) : 0);
+}
+
+void SQLHistoryStore::addEntry(const SQLHistoryEntry &entry)
+{
+	QFile data_file(getFilename(DataExt)), idx_file(getFilename(IndexExt)), tri_file(getFilename(TrigramExt));
+	QDataStream stream;
+	QSet<quint32> trigrams;
+	qint64 offset=0, length=0;
+	quint32 entry_id=getEntryCount();
+
+	QDir(getStoresDir()).mkpath(QString("."));
+
+	if(!data_file.open(QFile::WriteOnly | QFile::Append))
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(data_file.fileName()),
+										ErrorCode::FileDirectoryNotAccessed, __PRETTY_FUNCTION__, __FILE__ ,__LINE__);
+
+	if(!idx_file.open(QFile::ReadWrite))
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(idx_file.fileName()),
+										ErrorCode::FileDirectoryNotAccessed, __PRETTY_FUNCTION__, __FILE__ ,__LINE__);
+
+	if(!tri_file.open(QFile::WriteOnly | QFile::Append))
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(tri_file.fileName()),
+										ErrorCode::FileDirectoryNotAccessed, __PRETTY_FUNCTION__, __FILE__ ,__LINE__);
+
+	//Writing the command and error to the data file
+	offset=data_file.size();
+	stream.setDevice(&data_file);
+	stream << entry.command << entry.error;
+	length=data_file.size() - offset;
+	data_file.close();
+
+	//Writing the index entry (discarding any incomplete entry left by an interrupted write)
+	idx_file.resize(entry_id * IndexEntrySize);
+	idx_file.seek(entry_id * IndexEntrySize);
+	stream.setDevice(&idx_file);
+	stream << offset << entry.timestamp << entry.exec_time << entry.rows
+				 << static_cast<quint32>(length) << static_cast<quint32>(entry.error.isEmpty() ? 0 : 1);
+	idx_file.close();
+
+	//Writing the trigrams of the command
+	trigrams=getTrigrams(entry.command);
+	stream.setDevice(&tri_file);
+	stream << entry_id << static_cast<quint32>(trigrams.size());
+
+	for(auto &trigram : trigrams)
+	{
+		stream << trigram;
+
+		if(trigrams_loaded)
+			trigram_index[trigram].append(entry_id);
+	}
+
+	tri_file.close();
+}
+
+void SQLHistoryStore::loadTrigrams(void)
+{
+	if(trigrams_loaded)
+		return;
+
+	QFile tri_file(getFilename(TrigramExt));
+	QDataStream stream;
+	quint32 entry_id=0, count=0, trigram=0;
+
+	trigram_index.clear();
+	trigrams_loaded=true;
+
+	if(!tri_file.open(QFile::ReadOnly))
+		return;
+
+	stream.setDevice(&tri_file);
+
+	while(!stream.atEnd())
+	{
+		stream >> entry_id >> count;
+
+		for(quint32 i=0; i < count && stream.status() == QDataStream::Ok; i++)
+		{
+			stream >> trigram;
+			trigram_index[trigram].append(entry_id);
+		}
+
+		//Stops on an incomplete block left by an interrupted write
+		if(stream.status() != QDataStream::Ok)
+			break;
+	}
+
+	tri_file.close();
+}
+
+bool SQLHistoryStore::readEntry(QFile &idx_file, QFile &data_file, unsigned entry_id, SQLHistoryEntry &entry, bool read_command)
+{
+	QDataStream stream;
+	qint64 offset=0;
+	quint32 length=0, flags=0;
+
+	if(!idx_file.seek(entry_id * IndexEntrySize))
+		return(false);
+
+	stream.setDevice(&idx_file);
+	stream >> offset >> entry.timestamp >> entry.exec_time >> entry.rows >> length >> flags;
+
+	if(stream.status() != QDataStream::Ok)
+		return(false);
+
+	if(read_command)
+	{
+		if(!data_file.seek(offset))
+			return(false);
+
+		stream.setDevice(&data_file);
+		stream >> entry.command >> entry.error;
+
+		if(stream.status() != QDataStream::Ok)
+			return(false);
+	}
+
+	return(true);
+}
+
+vector<SQLHistoryEntry> SQLHistoryStore::getLastEntries(unsigned max_count)
+{
+	vector<SQLHistoryEntry> entries;
+	QFile data_file(getFilename(DataExt)), idx_file(getFilename(IndexExt));
+	unsigned count=getEntryCount(), first=0;
+	SQLHistoryEntry entry;
+
+	if(count == 0 || !idx_file.open(QFile::ReadOnly) || !data_file.open(QFile::ReadOnly))
+		return(entries);
+
+	first=(count > max_count ? count - max_count : 0);
+	entries.reserve(count - first);
+
+	for(unsigned id=first; id < count; id++)
+	{
+		if(readEntry(idx_file, data_file, id, entry))
+			entries.push_back(entry);
+	}
+
+	return(entries);
+}
+
+vector<SQLHistoryEntry> SQLHistoryStore::findEntries(const QString &text, bool prefix_only, unsigned max_count)
+{
+	vector<SQLHistoryEntry> entries;
+	QFile data_file(getFilename(DataExt)), idx_file(getFilename(IndexExt));
+	QSet<quint32> trigrams=getTrigrams(text);
+	QVector<quint32> candidates, aux_list;
+	vector<const QVector<quint32> *> postings;
+	unsigned count=getEntryCount();
+	SQLHistoryEntry entry;
+	bool matches=false;
+
+	if(text.isEmpty() || count == 0 || !idx_file.open(QFile::ReadOnly) || !data_file.open(QFile::ReadOnly))
+		return(entries);
+
+	/* Using the trigram index to determine the candidate entries: only the entries containing all the
+	 * trigrams of the searched text need to be read from the data file */
+	if(!trigrams.isEmpty())
+	{
+		loadTrigrams();
+
+		for(auto &trigram : trigrams)
+		{
+			auto itr=trigram_index.find(trigram);
+
+			if(itr == trigram_index.end())
+				return(entries);
+
+			postings.push_back(&itr.value());
+		}
+
+		//Intersecting the postings starting from the smallest one
+		std::sort(postings.begin(), postings.end(), [](const QVector<quint32> *list1, const QVector<quint32> *list2){
+			return(list1->size() < list2->size());
+		});
+
+		candidates=*postings[0];
+
+		for(unsigned i=1; i < postings.size() && !candidates.isEmpty(); i++)
+		{
+			aux_list.clear();
+			std::set_intersection(candidates.begin(), candidates.end(),
+														postings[i]->begin(), postings[i]->end(), std::back_inserter(aux_list));
+			candidates.swap(aux_list);
+		}
+	}
+	//Texts smaller than a trigram are searched in all entries
+	else
+	{
+		candidates.reserve(count);
+
+		for(quint32 id=0; id < count; id++)
+			candidates.append(id);
+	}
+
+	//Checking the candidates from the newest to the oldest
+	for(int i=candidates.size() - 1; i >= 0 && entries.size() < max_count; i--)
+	{
+		if(candidates[i] >= count || !readEntry(idx_file, data_file, candidates[i], entry))
+			continue;
+
+		if(prefix_only)
+			matches=entry.command.trimmed().startsWith(text, Qt::CaseInsensitive);
+		else
+			matches=entry.command.contains(text, Qt::CaseInsensitive);
+
+		if(matches)
+			entries.push_back(entry);
+	}
+
+	std::reverse(entries.begin(), entries.end());
+	return(entries);
+}
+
+void SQLHistoryStore::clear(void)
+{
+	QFile::remove(getFilename(DataExt));
+	QFile::remove(getFilename(IndexExt));
+	QFile::remove(getFilename(TrigramExt));
+	trigram_index.clear();
+	trigrams_loaded=false;
+}
+
+void SQLHistoryStore::clearAll(void)
+{
+	QDir dir(getStoresDir());
+
+	for(auto &file : dir.entryList({ QString("*") + DataExt, QString("*") + IndexExt, QString("*") + TrigramExt }, QDir::Files))
+		dir.remove(file);
+}
@@ -0,0 +1,114 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class SQLHistoryStore
+\brief Implements a persistent and append-only store of the SQL commands executed in a connection/database.
+ Each store is composed by three files named after the hash of the store's key (usually db@host:port):
+ a data file (.hst) containing the commands and error messages, an index file (.idx) of fixed size entries
+ (data offset, timestamp, execution time and rows) which allows to read any entry without parsing the
+ data file, and a trigram file (.tri) which lists the trigrams of each command and is used to speed up the
+ prefix and substring searches. Nothing is read until an operation needs it so the time to open a store
+ is independent of the history size.
+*/
+
+#ifndef SQL_HISTORY_STORE_H
+#define SQL_HISTORY_STORE_H
+
+#include <QString>
+#include <QFile>
+#include <QHash>
+#include <QVector>
+#include <QSet>
+#include <vector>
+#include "exception.h"
+
+//! \brief Represents a single command registered in the history
+struct SQLHistoryEntry {
+	//! \brief Moment (msecs since epoch) when the command was executed
+	qint64 timestamp;
+
+	//! \brief Time spent executing the command (in msecs)
+	qint64 exec_time;
+
+	//! \brief Amount of rows retrieved or affected by the command
+	qint64 rows;
+
+	QString command, error;
+
+	SQLHistoryEntry(void) { timestamp=exec_time=rows=0; }
+};
+
+class SQLHistoryStore {
+	private:
+		//! \brief Key which identifies the store and the base name (without extension) of its files
+		QString key, basename;
+
+		//! \brief Indicates if the trigram index was loaded to memory
+		bool trigrams_loaded;
+
+		//! \brief In-memory copy of the trigram file (trigram -> ids of the entries containing it) loaded on the first search
+		QHash<quint32, QVector<quint32>> trigram_index;
+
+		//! \brief Returns the full path to the store file with the provided extension
+		QString getFilename(const QString &ext);
+
+		//! \brief Returns the set of hashed trigrams of the provided text (case insensitive)
+		static QSet<quint32> getTrigrams(const QString &text);
+
+		//! \brief Loads the trigram file to memory
+		void loadTrigrams(void);
+
+		/*! \brief Reads the entry in the provided position of the index. When read_command is false only
+		 * the data in the index is read (timestamp, execution time and rows) */
+		bool readEntry(QFile &idx_file, QFile &data_file, unsigned entry_id, SQLHistoryEntry &entry, bool read_command=true);
+
+	public:
+		//! \brief Size (in bytes) of each entry in the index file
+		static constexpr unsigned IndexEntrySize=40;
+
+		//! \brief Extensions of the files that compose a store
+		static const QString DataExt, IndexExt, TrigramExt;
+
+		SQLHistoryStore(const QString &key);
+
+		//! \brief Appends the entry to the store. An exception is raised if the files can't be written
+		void addEntry(const SQLHistoryEntry &entry);
+
+		//! \brief Returns the amount of entries in the store (reads only the size of the index file)
+		unsigned getEntryCount(void);
+
+		//! \brief Returns the last max_count entries in chronological order
+		vector<SQLHistoryEntry> getLastEntries(unsigned max_count);
+
+		/*! \brief Returns the newest entries (at most max_count, in chronological order) which commands contain the provided text
+		 * (or start with it when prefix_only is true). The comparison is case insensitive */
+		vector<SQLHistoryEntry> findEntries(const QString &text, bool prefix_only, unsigned max_count);
+
+		//! \brief Removes all the entries of the store
+		void clear(void);
+
+		//! \brief Returns the directory where the stores are saved
+		static QString getStoresDir(void);
+
+		//! \brief Removes all the stores
+		static void clearAll(void);
+};
+
+#endif
@@ -79,7 +79,10 @@ SQLToolWidget::SQLToolWidget(QWidget * parent) : QWidget(parent)
 					else
 					{
 						for(auto &wgt : itr.value())
+						{
 							sql_exec_tbw->addTab(wgt, dbexplorer->getConnection().getConnectionParam(Connection::ParamDbName));
+							sql_exec_tbw->setTabToolTip(sql_exec_tbw->indexOf(wgt), dynamic_cast<SQLExecutionWidget *>(wgt)->getResultsMemoryInfo());
+						}
 					}
 
 					itr++;
@@ -304,6 +307,14 @@ SQLExecutionWidget *SQLToolWidget::addSQLExecutionTab(const QString &sql_cmd)
 		sql_exec_wgt->sql_cmd_txt->appendPlainText(sql_cmd);
 		sql_exec_wgts[db_explorer_wgt].push_back(sql_exec_wgt);
 
+		//Displaying the memory used by the tab's results in the tab's tooltip
+		connect(sql_exec_wgt, &SQLExecutionWidget::s_resultsMemoryChanged, this, [&, sql_exec_wgt](QString info){
+			int idx = sql_exec_tbw->indexOf(sql_exec_wgt);
+
+			if(idx >= 0)
+				sql_exec_tbw->setTabToolTip(idx, info);
+		});
+
 		return(sql_exec_wgt);
 	}
 	catch(Exception &e)
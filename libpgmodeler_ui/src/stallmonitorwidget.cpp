@@ -0,0 +1,80 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "stallmonitorwidget.h"
+
+StallMonitorWidget::StallMonitorWidget(QWidget *parent) : QWidget(parent)
+{
+	setupUi(this);
+	watchdog=nullptr;
+
+	threshold_spb->setMinimum(StallWatchdog::MinimumThreshold);
+	threshold_spb->setValue(StallWatchdog::getThreshold());
+	enabled_chk->setChecked(StallWatchdog::isEnabled());
+	reports_txt->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+	log_file_lbl->setText(trUtf8("Log file: <strong>%1</strong>").arg(QDir::toNativeSeparators(StallWatchdog::getLogFilename())));
+
+	connect(clear_tb, SIGNAL(clicked(bool)), this, SLOT(clearReports()));
+
+	listReports();
+}
+
+void StallMonitorWidget::setWatchdog(StallWatchdog *watchdog)
+{
+	if(this->watchdog)
+		disconnect(this->watchdog, nullptr, this, nullptr);
+
+	this->watchdog=watchdog;
+	enabled_chk->setEnabled(watchdog != nullptr);
+	threshold_spb->setEnabled(watchdog != nullptr);
+
+	if(!watchdog)
+		return;
+
+	connect(watchdog, SIGNAL(s_stallDetected(QString)), this, SLOT(appendReport(QString)));
+
+	connect(enabled_chk, &QCheckBox::toggled, [&](bool value){
+		this->watchdog->setEnabled(value);
+	});
+
+	connect(threshold_spb, static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged), [&](int value){
+		this->watchdog->setThreshold(static_cast<unsigned>(value));
+	});
+}
+
+void StallMonitorWidget::listReports(void)
+{
+	reports_txt->clear();
+
+	for(auto &report : StallWatchdog::getReports())
+		reports_txt->appendPlainText(report);
+
+	clear_tb->setEnabled(!reports_txt->document()->isEmpty());
+}
+
+void StallMonitorWidget::appendReport(QString report)
+{
+	reports_txt->appendPlainText(report);
+	clear_tb->setEnabled(true);
+}
+
+void StallMonitorWidget::clearReports(void)
+{
+	StallWatchdog::clearReports();
+	listReports();
+}
@@ -0,0 +1,52 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class StallMonitorWidget
+\brief Implements the viewer that controls the event loop stall watchdog and displays the stalls reported by it.
+*/
+
+#ifndef STALL_MONITOR_WIDGET_H
+#define STALL_MONITOR_WIDGET_H
+
+#include <QWidget>
+#include "ui_stallmonitorwidget.h"
+#include "stallwatchdog.h"
+
+class StallMonitorWidget: public QWidget, public Ui::StallMonitorWidget {
+	private:
+		Q_OBJECT
+
+		//! \brief The watchdog being controlled by the widget
+		StallWatchdog *watchdog;
+
+		//! \brief Fills the text area with the reports kept by the watchdog
+		void listReports(void);
+
+	public:
+		StallMonitorWidget(QWidget *parent = nullptr);
+
+		void setWatchdog(StallWatchdog *watchdog);
+
+	private slots:
+		void appendReport(QString report);
+		void clearReports(void);
+};
+
+#endif
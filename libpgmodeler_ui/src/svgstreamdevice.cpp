@@ -0,0 +1,789 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "svgstreamdevice.h"
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QTextItem>
+
+SvgStreamEngine::SvgStreamEngine(const QString &filename, const QSize &size, const QString &title, const QString &description) :
+	QPaintEngine(QPaintEngine::AllFeatures & ~(QPaintEngine::PatternBrush | QPaintEngine::PerspectiveTransform |
+																						 QPaintEngine::ConicalGradientFill | QPaintEngine::PorterDuff))
+{
+	output.setFileName(filename);
+	this->size=size;
+	this->title=title;
+	this->description=description;
+	opacity=1;
+}
+
+bool SvgStreamEngine::begin(QPaintDevice *)
+{
+	if(!output.open(QFile::WriteOnly | QFile::Truncate))
+		return(false);
+
+	css_classes.clear();
+	classes_defs.clear();
+	gradient_ids.clear();
+	gradients_defs.clear();
+	image_keys.clear();
+	image_hashes.clear();
+	images_defs.clear();
+	pattern_ids.clear();
+	patterns_defs.clear();
+	clip_ids.clear();
+	clips_defs.clear();
+	clip_id.clear();
+
+	xml.setDevice(&output);
+	xml.setAutoFormatting(false);
+	xml.writeStartDocument();
+	xml.writeStartElement(QString("svg"));
+	xml.writeAttribute(QString("xmlns"), QString("http://www.w3.org/2000/svg"));
+	xml.writeAttribute(QString("xmlns:xlink"), QString("http://www.w3.org/1999/xlink"));
+	xml.writeAttribute(QString("version"), QString("1.1"));
+	xml.writeAttribute(QString("width"), QString::number(size.width()));
+	xml.writeAttribute(QString("height"), QString::number(size.height()));
+	xml.writeAttribute(QString("viewBox"), QString("0 0 %1 %2").arg(size.width()).arg(size.height()));
+	xml.writeTextElement(QString("title"), title);
+	xml.writeTextElement(QString("desc"), description);
+	xml.writeCharacters(QString("\n"));
+
+	return(true);
+}
+
+bool SvgStreamEngine::end(void)
+{
+	writeDefinitions();
+	xml.writeEndElement();
+	xml.writeEndDocument();
+	output.close();
+
+	return(!hasError());
+}
+
+bool SvgStreamEngine::hasError(void)
+{
+	return(xml.hasError() || output.error() != QFile::NoError);
+}
+
+QPaintEngine::Type SvgStreamEngine::type(void) const
+{
+	return(QPaintEngine::User);
+}
+
+void SvgStreamEngine::updateState(const QPaintEngineState &state)
+{
+	QPaintEngine::DirtyFlags flags=state.state();
+
+	if(flags & QPaintEngine::DirtyPen)
+		pen=state.pen();
+
+	if(flags & QPaintEngine::DirtyBrush)
+		brush=state.brush();
+
+	if(flags & QPaintEngine::DirtyBrushOrigin)
+		brush_origin=state.brushOrigin();
+
+	if(flags & QPaintEngine::DirtyTransform)
+		transform=state.transform();
+
+	if(flags & QPaintEngine::DirtyOpacity)
+		opacity=state.opacity();
+}
+
+QString SvgStreamEngine::formatNumber(qreal value)
+{
+	QString str=QString::number(value, 'f', 2);
+
+	while(str.endsWith(QChar('0')))
+		str.chop(1);
+
+	if(str.endsWith(QChar('.')))
+		str.chop(1);
+
+	if(str == QString("-0"))
+		return(QString("0"));
+
+	return(str);
+}
+
+QString SvgStreamEngine::formatColor(const QColor &color)
+{
+	return(color.name(QColor::HexRgb));
+}
+
+bool SvgStreamEngine::isSimpleTransform(void)
+{
+	return(transform.type() <= QTransform::TxScale);
+}
+
+QString SvgStreamEngine::getClass(const QString &css)
+{
+	QString cls=css_classes.value(css);
+
+	if(cls.isEmpty())
+	{
+		cls=QString("c%1").arg(css_classes.size());
+		css_classes[css]=cls;
+		classes_defs.push_back({ cls, css });
+	}
+
+	return(cls);
+}
+
+QString SvgStreamEngine::getShapeClass(bool fill, bool odd_even_fill)
+{
+	QStringList css;
+
+	if(fill && brush.style() != Qt::NoBrush)
+	{
+		css.append(QString("fill:%1").arg(getFillServer()));
+
+		if(brush.style() == Qt::SolidPattern && brush.color().alpha() != 255)
+			css.append(QString("fill-opacity:%1").arg(formatNumber(brush.color().alphaF())));
+
+		if(odd_even_fill)
+			css.append(QString("fill-rule:evenodd"));
+	}
+	else
+		css.append(QString("fill:none"));
+
+	if(pen.style() != Qt::NoPen && pen.brush().style() != Qt::NoBrush)
+	{
+		qreal width=pen.widthF();
+		static const QHash<int, QString> caps={{ Qt::FlatCap, QString("butt") }, { Qt::SquareCap, QString("square") }, { Qt::RoundCap, QString("round") }},
+				joins={{ Qt::MiterJoin, QString("miter") }, { Qt::SvgMiterJoin, QString("miter") }, { Qt::BevelJoin, QString("bevel") }, { Qt::RoundJoin, QString("round") }};
+
+		//Cosmetic pens keep their width while the others are affected by the scaling
+		if(width == 0)
+			width=1;
+		else if(!pen.isCosmetic() && isSimpleTransform())
+			width*=qAbs(transform.m11());
+
+		css.append(QString("stroke:%1").arg(formatColor(pen.color())));
+		css.append(QString("stroke-width:%1").arg(formatNumber(width)));
+		css.append(QString("stroke-linecap:%1").arg(caps.value(pen.capStyle(), QString("square"))));
+		css.append(QString("stroke-linejoin:%1").arg(joins.value(pen.joinStyle(), QString("bevel"))));
+
+		if(pen.color().alpha() != 255)
+			css.append(QString("stroke-opacity:%1").arg(formatNumber(pen.color().alphaF())));
+
+		if(pen.style() != Qt::SolidLine)
+		{
+			QStringList dashes;
+
+			for(auto &dash : pen.dashPattern())
+				dashes.append(formatNumber(dash * width));
+
+			css.append(QString("stroke-dasharray:%1").arg(dashes.join(QChar(','))));
+		}
+	}
+
+	if(opacity < 1)
+		css.append(QString("opacity:%1").arg(formatNumber(opacity)));
+
+	return(getClass(css.join(QChar(';'))));
+}
+
+QString SvgStreamEngine::getTextClass(const QFont &font)
+{
+	QStringList css;
+	qreal scale=(isSimpleTransform() ? qAbs(transform.m22()) : 1);
+
+	css.append(QString("font-family:'%1'").arg(font_families.value(font.family(), font.family())));
+
+	if(font.pointSizeF() > 0)
+		css.append(QString("font-size:%1pt").arg(formatNumber(font.pointSizeF() * scale)));
+	else
+		css.append(QString("font-size:%1px").arg(formatNumber(font.pixelSize() * scale)));
+
+	if(font.bold())
+		css.append(QString("font-weight:bold"));
+
+	if(font.italic())
+		css.append(QString("font-style:italic"));
+
+	if(font.underline())
+		css.append(QString("text-decoration:underline"));
+
+	css.append(QString("fill:%1").arg(formatColor(pen.color())));
+
+	if(pen.color().alpha() != 255)
+		css.append(QString("fill-opacity:%1").arg(formatNumber(pen.color().alphaF())));
+
+	if(opacity < 1)
+		css.append(QString("opacity:%1").arg(formatNumber(opacity)));
+
+	return(getClass(css.join(QChar(';'))));
+}
+
+QString SvgStreamEngine::getFillServer(void)
+{
+	Qt::BrushStyle style=brush.style();
+
+	if(style == Qt::LinearGradientPattern || style == Qt::RadialGradientPattern)
+	{
+		const QGradient *grad=brush.gradient();
+		GradientDef grad_def;
+		QStringList key;
+		QString id;
+
+		grad_def.type=grad->type();
+		grad_def.obj_bounding=(grad->coordinateMode() == QGradient::ObjectBoundingMode);
+		grad_def.stops=grad->stops();
+
+		if(grad_def.type == QGradient::LinearGradient)
+		{
+			const QLinearGradient *lin_grad=static_cast<const QLinearGradient *>(grad);
+			grad_def.start=lin_grad->start();
+			grad_def.final_stop=lin_grad->finalStop();
+			grad_def.radius=0;
+		}
+		else
+		{
+			const QRadialGradient *rad_grad=static_cast<const QRadialGradient *>(grad);
+			grad_def.start=rad_grad->center();
+			grad_def.final_stop=rad_grad->focalPoint();
+			grad_def.radius=rad_grad->radius();
+		}
+
+		/* Gradients in object bounding mode are independent from the element's position so they are shared
+		 * by all elements with the same colors. The logical ones are mapped to the document coordinates */
+		if(!grad_def.obj_bounding)
+		{
+			grad_def.start=transform.map(grad_def.start);
+			grad_def.final_stop=transform.map(grad_def.final_stop);
+			grad_def.radius*=qAbs(transform.m11());
+		}
+
+		key.append(QString::number(grad_def.type));
+		key.append(QString::number(grad_def.obj_bounding));
+		key.append(QString("%1,%2,%3,%4,%5").arg(grad_def.start.x()).arg(grad_def.start.y())
+							 .arg(grad_def.final_stop.x()).arg(grad_def.final_stop.y()).arg(grad_def.radius));
+
+		for(auto &stop : grad_def.stops)
+			key.append(QString("%1:%2").arg(stop.first).arg(stop.second.name(QColor::HexArgb)));
+
+		id=gradient_ids.value(key.join(QChar('|')));
+
+		if(id.isEmpty())
+		{
+			id=QString("g%1").arg(gradient_ids.size());
+			gradient_ids[key.join(QChar('|'))]=id;
+			grad_def.id=id;
+			gradients_defs.push_back(grad_def);
+		}
+
+		return(QString("url(#%1)").arg(id));
+	}
+	else if(style == Qt::TexturePattern)
+	{
+		QImage texture=brush.textureImage();
+		QString symbol_id=getImageSymbol(texture, texture.cacheKey()), key, id;
+		QPointF origin=transform.map(brush_origin);
+
+		key=QString("%1|%2,%3").arg(symbol_id).arg(origin.x()).arg(origin.y());
+		id=pattern_ids.value(key);
+
+		if(id.isEmpty())
+		{
+			id=QString("p%1").arg(pattern_ids.size());
+			pattern_ids[key]=id;
+			patterns_defs.push_back({ id, { symbol_id, QRectF(origin, texture.size()) } });
+		}
+
+		return(QString("url(#%1)").arg(id));
+	}
+	else if(style == Qt::ConicalGradientPattern && !brush.gradient()->stops().isEmpty())
+		return(formatColor(brush.gradient()->stops().at(0).second));
+
+	return(formatColor(brush.color()));
+}
+
+QString SvgStreamEngine::getImageSymbol(const QImage &image, qint64 cache_key)
+{
+	QString id=image_keys.value(cache_key);
+
+	if(id.isEmpty())
+	{
+		QByteArray png;
+		QBuffer buffer(&png);
+		QByteArray hash;
+
+		buffer.open(QBuffer::WriteOnly);
+		image.save(&buffer, "PNG");
+		buffer.close();
+
+		hash=QCryptographicHash::hash(png, QCryptographicHash::Md5);
+		id=image_hashes.value(hash);
+
+		if(id.isEmpty())
+		{
+			id=QString("i%1").arg(image_hashes.size());
+			image_hashes[hash]=id;
+			images_defs.push_back({ id, { image.size(), png.toBase64() } });
+		}
+
+		image_keys[cache_key]=id;
+	}
+
+	return(id);
+}
+
+QString SvgStreamEngine::getPathData(const QPainterPath &path)
+{
+	return(formatPathData(transform.map(path)));
+}
+
+QString SvgStreamEngine::formatPathData(const QPainterPath &path)
+{
+	QString data;
+	int count=path.elementCount();
+
+	data.reserve(count * 12);
+
+	for(int i=0; i < count; i++)
+	{
+		const QPainterPath::Element &elem=path.elementAt(i);
+
+		if(elem.type == QPainterPath::MoveToElement)
+			data+=QString("M%1 %2").arg(formatNumber(elem.x)).arg(formatNumber(elem.y));
+		else if(elem.type == QPainterPath::LineToElement)
+			data+=QString("L%1 %2").arg(formatNumber(elem.x)).arg(formatNumber(elem.y));
+		else if(elem.type == QPainterPath::CurveToElement)
+			data+=QString("C%1 %2").arg(formatNumber(elem.x)).arg(formatNumber(elem.y));
+		else
+			data+=QString(" %1 %2").arg(formatNumber(elem.x)).arg(formatNumber(elem.y));
+	}
+
+	return(data);
+}
+
+void SvgStreamEngine::writeClipPath(void)
+{
+	if(!clip_id.isEmpty())
+		xml.writeAttribute(QString("clip-path"), QString("url(#%1)").arg(clip_id));
+}
+
+void SvgStreamEngine::setClipPath(const QPainterPath &path)
+{
+	QString data;
+
+	if(path.isEmpty())
+	{
+		clip_id.clear();
+		return;
+	}
+
+	data=formatPathData(path);
+	clip_id=clip_ids.value(data);
+
+	if(clip_id.isEmpty())
+	{
+		clip_id=QString("cp%1").arg(clip_ids.size());
+		clip_ids[data]=clip_id;
+		clips_defs.push_back({ clip_id, data });
+	}
+}
+
+void SvgStreamEngine::setFontFamilyReplacement(const QString &family, const QString &new_family)
+{
+	if(family != new_family)
+		font_families[family]=new_family;
+}
+
+void SvgStreamEngine::drawPath(const QPainterPath &path)
+{
+	xml.writeEmptyElement(QString("path"));
+	xml.writeAttribute(QString("class"), getShapeClass(true, path.fillRule() == Qt::OddEvenFill));
+	xml.writeAttribute(QString("d"), getPathData(path));
+	writeClipPath();
+}
+
+void SvgStreamEngine::drawRects(const QRectF *rects, int rect_count)
+{
+	QString cls=getShapeClass(true, false);
+	QRectF rect;
+
+	for(int i=0; i < rect_count; i++)
+	{
+		if(!isSimpleTransform())
+		{
+			QPainterPath path;
+			path.addRect(rects[i]);
+			drawPath(path);
+			continue;
+		}
+
+		rect=transform.mapRect(rects[i]);
+		xml.writeEmptyElement(QString("rect"));
+		xml.writeAttribute(QString("class"), cls);
+		xml.writeAttribute(QString("x"), formatNumber(rect.x()));
+		xml.writeAttribute(QString("y"), formatNumber(rect.y()));
+		xml.writeAttribute(QString("width"), formatNumber(rect.width()));
+		xml.writeAttribute(QString("height"), formatNumber(rect.height()));
+		writeClipPath();
+	}
+}
+
+void SvgStreamEngine::drawRects(const QRect *rects, int rect_count)
+{
+	for(int i=0; i < rect_count; i++)
+	{
+		QRectF rect(rects[i]);
+		drawRects(&rect, 1);
+	}
+}
+
+void SvgStreamEngine::drawLines(const QLineF *lines, int line_count)
+{
+	QString cls=getShapeClass(false, false);
+	QLineF line;
+
+	for(int i=0; i < line_count; i++)
+	{
+		line=transform.map(lines[i]);
+		xml.writeEmptyElement(QString("line"));
+		xml.writeAttribute(QString("class"), cls);
+		xml.writeAttribute(QString("x1"), formatNumber(line.x1()));
+		xml.writeAttribute(QString("y1"), formatNumber(line.y1()));
+		xml.writeAttribute(QString("x2"), formatNumber(line.x2()));
+		xml.writeAttribute(QString("y2"), formatNumber(line.y2()));
+		writeClipPath();
+	}
+}
+
+void SvgStreamEngine::drawLines(const QLine *lines, int line_count)
+{
+	for(int i=0; i < line_count; i++)
+	{
+		QLineF line(lines[i]);
+		drawLines(&line, 1);
+	}
+}
+
+void SvgStreamEngine::drawEllipse(const QRectF &rect)
+{
+	QRectF mapped_rect;
+
+	if(!isSimpleTransform())
+	{
+		QPainterPath path;
+		path.addEllipse(rect);
+		drawPath(path);
+		return;
+	}
+
+	mapped_rect=transform.mapRect(rect);
+	xml.writeEmptyElement(QString("ellipse"));
+	xml.writeAttribute(QString("class"), getShapeClass(true, false));
+	xml.writeAttribute(QString("cx"), formatNumber(mapped_rect.center().x()));
+	xml.writeAttribute(QString("cy"), formatNumber(mapped_rect.center().y()));
+	xml.writeAttribute(QString("rx"), formatNumber(mapped_rect.width() / 2));
+	xml.writeAttribute(QString("ry"), formatNumber(mapped_rect.height() / 2));
+	writeClipPath();
+}
+
+void SvgStreamEngine::drawPolygon(const QPointF *points, int point_count, PolygonDrawMode mode)
+{
+	QStringList coords;
+	QPointF pnt;
+	bool polyline=(mode == QPaintEngine::PolylineMode);
+
+	for(int i=0; i < point_count; i++)
+	{
+		pnt=transform.map(points[i]);
+		coords.append(QString("%1,%2").arg(formatNumber(pnt.x())).arg(formatNumber(pnt.y())));
+	}
+
+	xml.writeEmptyElement(polyline ? QString("polyline") : QString("polygon"));
+	xml.writeAttribute(QString("class"), getShapeClass(!polyline, mode == QPaintEngine::OddEvenMode));
+	xml.writeAttribute(QString("points"), coords.join(QChar(' ')));
+	writeClipPath();
+}
+
+void SvgStreamEngine::drawPolygon(const QPoint *points, int point_count, PolygonDrawMode mode)
+{
+	QVector<QPointF> pointsf;
+
+	pointsf.reserve(point_count);
+
+	for(int i=0; i < point_count; i++)
+		pointsf.append(QPointF(points[i]));
+
+	drawPolygon(pointsf.constData(), point_count, mode);
+}
+
+void SvgStreamEngine::writeImage(const QRectF &rect, const QString &symbol_id)
+{
+	xml.writeEmptyElement(QString("use"));
+	xml.writeAttribute(QString("xlink:href"), QString("#%1").arg(symbol_id));
+	writeClipPath();
+
+	if(opacity < 1)
+		xml.writeAttribute(QString("opacity"), formatNumber(opacity));
+
+	if(isSimpleTransform())
+	{
+		QRectF mapped_rect=transform.mapRect(rect);
+		xml.writeAttribute(QString("x"), formatNumber(mapped_rect.x()));
+		xml.writeAttribute(QString("y"), formatNumber(mapped_rect.y()));
+		xml.writeAttribute(QString("width"), formatNumber(mapped_rect.width()));
+		xml.writeAttribute(QString("height"), formatNumber(mapped_rect.height()));
+	}
+	else
+	{
+		xml.writeAttribute(QString("transform"), QString("matrix(%1 %2 %3 %4 %5 %6)")
+											 .arg(transform.m11()).arg(transform.m12()).arg(transform.m21())
+											 .arg(transform.m22()).arg(transform.dx()).arg(transform.dy()));
+		xml.writeAttribute(QString("x"), formatNumber(rect.x()));
+		xml.writeAttribute(QString("y"), formatNumber(rect.y()));
+		xml.writeAttribute(QString("width"), formatNumber(rect.width()));
+		xml.writeAttribute(QString("height"), formatNumber(rect.height()));
+	}
+}
+
+void SvgStreamEngine::drawPixmap(const QRectF &rect, const QPixmap &pixmap, const QRectF &src_rect)
+{
+	if(src_rect == QRectF(pixmap.rect()))
+		writeImage(rect, getImageSymbol(pixmap.toImage(), pixmap.cacheKey()));
+	else
+	{
+		QImage image=pixmap.copy(src_rect.toRect()).toImage();
+		writeImage(rect, getImageSymbol(image, image.cacheKey()));
+	}
+}
+
+void SvgStreamEngine::drawImage(const QRectF &rect, const QImage &image, const QRectF &src_rect, Qt::ImageConversionFlags)
+{
+	if(src_rect == QRectF(image.rect()))
+		writeImage(rect, getImageSymbol(image, image.cacheKey()));
+	else
+	{
+		QImage sub_image=image.copy(src_rect.toRect());
+		writeImage(rect, getImageSymbol(sub_image, sub_image.cacheKey()));
+	}
+}
+
+void SvgStreamEngine::drawTextItem(const QPointF &pos, const QTextItem &text_item)
+{
+	QString text=text_item.text();
+
+	if(text.trimmed().isEmpty())
+		return;
+
+	xml.writeStartElement(QString("text"));
+	xml.writeAttribute(QString("class"), getTextClass(text_item.font()));
+	xml.writeAttribute(QString("xml:space"), QString("preserve"));
+	writeClipPath();
+
+	if(isSimpleTransform())
+	{
+		QPointF mapped_pos=transform.map(pos);
+		xml.writeAttribute(QString("x"), formatNumber(mapped_pos.x()));
+		xml.writeAttribute(QString("y"), formatNumber(mapped_pos.y()));
+	}
+	else
+	{
+		xml.writeAttribute(QString("transform"), QString("matrix(%1 %2 %3 %4 %5 %6)")
+											 .arg(transform.m11()).arg(transform.m12()).arg(transform.m21())
+											 .arg(transform.m22()).arg(transform.dx()).arg(transform.dy()));
+		xml.writeAttribute(QString("x"), formatNumber(pos.x()));
+		xml.writeAttribute(QString("y"), formatNumber(pos.y()));
+	}
+
+	xml.writeCharacters(text);
+	xml.writeEndElement();
+}
+
+void SvgStreamEngine::beginGroup(const QString &id, const QString &cls, const QString &title)
+{
+	xml.writeStartElement(QString("g"));
+
+	if(!id.isEmpty())
+		xml.writeAttribute(QString("id"), id);
+
+	if(!cls.isEmpty())
+		xml.writeAttribute(QString("class"), cls);
+
+	if(!title.isEmpty())
+		xml.writeTextElement(QString("title"), title);
+}
+
+void SvgStreamEngine::endGroup(void)
+{
+	xml.writeEndElement();
+	xml.writeCharacters(QString("\n"));
+}
+
+void SvgStreamEngine::writeDefinitions(void)
+{
+	QString css;
+
+	xml.writeStartElement(QString("defs"));
+
+	for(auto &cls : classes_defs)
+		css+=QString(".%1{%2}\n").arg(cls.first).arg(cls.second);
+
+	xml.writeStartElement(QString("style"));
+	xml.writeAttribute(QString("type"), QString("text/css"));
+	xml.writeCDATA(css);
+	xml.writeEndElement();
+
+	for(auto &grad_def : gradients_defs)
+	{
+		if(grad_def.type == QGradient::LinearGradient)
+		{
+			xml.writeStartElement(QString("linearGradient"));
+			xml.writeAttribute(QString("x1"), formatNumber(grad_def.start.x()));
+			xml.writeAttribute(QString("y1"), formatNumber(grad_def.start.y()));
+			xml.writeAttribute(QString("x2"), formatNumber(grad_def.final_stop.x()));
+			xml.writeAttribute(QString("y2"), formatNumber(grad_def.final_stop.y()));
+		}
+		else
+		{
+			xml.writeStartElement(QString("radialGradient"));
+			xml.writeAttribute(QString("cx"), formatNumber(grad_def.start.x()));
+			xml.writeAttribute(QString("cy"), formatNumber(grad_def.start.y()));
+			xml.writeAttribute(QString("fx"), formatNumber(grad_def.final_stop.x()));
+			xml.writeAttribute(QString("fy"), formatNumber(grad_def.final_stop.y()));
+			xml.writeAttribute(QString("r"), formatNumber(grad_def.radius));
+		}
+
+		xml.writeAttribute(QString("id"), grad_def.id);
+		xml.writeAttribute(QString("gradientUnits"), grad_def.obj_bounding ? QString("objectBoundingBox") : QString("userSpaceOnUse"));
+
+		for(auto &stop : grad_def.stops)
+		{
+			xml.writeEmptyElement(QString("stop"));
+			xml.writeAttribute(QString("offset"), formatNumber(stop.first));
+			xml.writeAttribute(QString("stop-color"), formatColor(stop.second));
+
+			if(stop.second.alpha() != 255)
+				xml.writeAttribute(QString("stop-opacity"), formatNumber(stop.second.alphaF()));
+		}
+
+		xml.writeEndElement();
+	}
+
+	for(auto &img_def : images_defs)
+	{
+		QSize img_size=img_def.second.first;
+
+		xml.writeStartElement(QString("symbol"));
+		xml.writeAttribute(QString("id"), img_def.first);
+		xml.writeAttribute(QString("viewBox"), QString("0 0 %1 %2").arg(img_size.width()).arg(img_size.height()));
+		xml.writeAttribute(QString("preserveAspectRatio"), QString("none"));
+		xml.writeEmptyElement(QString("image"));
+		xml.writeAttribute(QString("width"), QString::number(img_size.width()));
+		xml.writeAttribute(QString("height"), QString::number(img_size.height()));
+		xml.writeAttribute(QString("xlink:href"), QString("data:image/png;base64,%1").arg(QString::fromLatin1(img_def.second.second)));
+		xml.writeEndElement();
+	}
+
+	for(auto &clip_def : clips_defs)
+	{
+		xml.writeStartElement(QString("clipPath"));
+		xml.writeAttribute(QString("id"), clip_def.first);
+		xml.writeEmptyElement(QString("path"));
+		xml.writeAttribute(QString("d"), clip_def.second);
+		xml.writeEndElement();
+	}
+
+	for(auto &pat_def : patterns_defs)
+	{
+		QRectF rect=pat_def.second.second;
+
+		xml.writeStartElement(QString("pattern"));
+		xml.writeAttribute(QString("id"), pat_def.first);
+		xml.writeAttribute(QString("patternUnits"), QString("userSpaceOnUse"));
+		xml.writeAttribute(QString("x"), formatNumber(rect.x()));
+		xml.writeAttribute(QString("y"), formatNumber(rect.y()));
+		xml.writeAttribute(QString("width"), formatNumber(rect.width()));
+		xml.writeAttribute(QString("height"), formatNumber(rect.height()));
+		xml.writeEmptyElement(QString("use"));
+		xml.writeAttribute(QString("xlink:href"), QString("#%1").arg(pat_def.second.first));
+		xml.writeAttribute(QString("width"), formatNumber(rect.width()));
+		xml.writeAttribute(QString("height"), formatNumber(rect.height()));
+		xml.writeEndElement();
+	}
+
+	xml.writeEndElement();
+}
+
+SvgStreamDevice::SvgStreamDevice(const QString &filename, const QSize &size, const QString &title, const QString &description)
+{
+	this->size=size;
+	engine=new SvgStreamEngine(filename, size, title, description);
+}
+
+SvgStreamDevice::~SvgStreamDevice(void)
+{
+	delete(engine);
+}
+
+QPaintEngine *SvgStreamDevice::paintEngine(void) const
+{
+	return(engine);
+}
+
+void SvgStreamDevice::beginGroup(const QString &id, const QString &cls, const QString &title)
+{
+	engine->beginGroup(id, cls, title);
+}
+
+void SvgStreamDevice::endGroup(void)
+{
+	engine->endGroup();
+}
+
+void SvgStreamDevice::setClipPath(const QPainterPath &path)
+{
+	engine->setClipPath(path);
+}
+
+void SvgStreamDevice::setFontFamilyReplacement(const QString &family, const QString &new_family)
+{
+	engine->setFontFamilyReplacement(family, new_family);
+}
+
+bool SvgStreamDevice::hasError(void)
+{
+	return(engine->hasError());
+}
+
+int SvgStreamDevice::metric(PaintDeviceMetric metric) const
+{
+	switch(metric)
+	{
+		case QPaintDevice::PdmWidth: return(size.width());
+		case QPaintDevice::PdmHeight: return(size.height());
+		case QPaintDevice::PdmWidthMM: return(qRound(size.width() * 25.4 / Resolution));
+		case QPaintDevice::PdmHeightMM: return(qRound(size.height() * 25.4 / Resolution));
+		case QPaintDevice::PdmDpiX:
+		case QPaintDevice::PdmDpiY:
+		case QPaintDevice::PdmPhysicalDpiX:
+		case QPaintDevice::PdmPhysicalDpiY: return(Resolution);
+		case QPaintDevice::PdmNumColors: return(INT_MAX);
+		case QPaintDevice::PdmDepth: return(32);
+		case QPaintDevice::PdmDevicePixelRatio: return(1);
+		case QPaintDevice::PdmDevicePixelRatioScaled: return(static_cast<int>(QPaintDevice::devicePixelRatioFScale()));
+		default: return(0);
+	}
+}
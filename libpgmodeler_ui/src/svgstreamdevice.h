@@ -0,0 +1,207 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class SvgStreamDevice
+\brief Implements a paint device that writes the painted primitives directly to an SVG file as they are received.
+ Differently from QSvgGenerator, the repeated styles are emitted as CSS classes, the gradients and images (icons) are
+ emitted only once as shared definitions (<defs>, <symbol>) and the elements can be grouped in addressable elements (<g id="...">).
+ The shared definitions are written at the end of the document since they are referenced by id. Clipping is not taken from the
+ painter state, instead, the clip path of the elements is configured in the document coordinates through setClipPath().
+*/
+
+#ifndef SVG_STREAM_DEVICE_H
+#define SVG_STREAM_DEVICE_H
+
+#include <QPaintDevice>
+#include <QPaintEngine>
+#include <QXmlStreamWriter>
+#include <QFile>
+#include <QHash>
+#include <vector>
+
+using namespace std;
+
+class SvgStreamEngine: public QPaintEngine {
+	private:
+		//! \brief The file being written
+		QFile output;
+
+		//! \brief Writer used to stream the elements to the output file
+		QXmlStreamWriter xml;
+
+		//! \brief Size, title and description of the document
+		QSize size;
+		QString title, description;
+
+		//! \brief Current painter state
+		QPen pen;
+		QBrush brush;
+		QPointF brush_origin;
+		QTransform transform;
+		qreal opacity;
+
+		//! \brief Stores the CSS classes created (css -> class name) and their order of creation
+		QHash<QString, QString> css_classes;
+		vector<pair<QString, QString>> classes_defs;
+
+		//! \brief Definition of a gradient already mapped to the document coordinates (when not in object bounding mode)
+		struct GradientDef {
+			QString id;
+			QGradient::Type type;
+			bool obj_bounding;
+			QPointF start, final_stop;
+			qreal radius;
+			QGradientStops stops;
+		};
+
+		//! \brief Stores the gradients created (gradient key -> id) and their definitions
+		QHash<QString, QString> gradient_ids;
+		vector<GradientDef> gradients_defs;
+
+		/*! \brief Stores the images (icons) symbols created. The first map is a fast lookup by the image's cache key while
+		 * the second one avoids duplicated symbols for different images (e.g. different pixmaps of the same icon) with the same contents */
+		QHash<qint64, QString> image_keys;
+		QHash<QByteArray, QString> image_hashes;
+		vector<pair<QString, pair<QSize, QByteArray>>> images_defs;
+
+		//! \brief Stores the texture patterns created (pattern key -> id) and their definitions (symbol id, origin and size)
+		QHash<QString, QString> pattern_ids;
+		vector<pair<QString, pair<QString, QRectF>>> patterns_defs;
+
+		//! \brief Stores the clip paths created (path data -> id) and their definitions (id and path data)
+		QHash<QString, QString> clip_ids;
+		vector<pair<QString, QString>> clips_defs;
+
+		//! \brief Id of the clip path applied to the elements being written. Empty means no clipping
+		QString clip_id;
+
+		//! \brief Font families that are replaced by other ones in the text elements (family -> new family)
+		QHash<QString, QString> font_families;
+
+		//! \brief Formats a coordinate/size value using at most two decimal places
+		static QString formatNumber(qreal value);
+
+		//! \brief Formats the provided color as #rrggbb
+		static QString formatColor(const QColor &color);
+
+		//! \brief Returns the CSS class name for the provided style, creating the class if it doesn't exist
+		QString getClass(const QString &css);
+
+		//! \brief Returns the CSS class that represents the current pen and brush
+		QString getShapeClass(bool fill, bool odd_even_fill);
+
+		//! \brief Returns the CSS class that represents the provided font using the current pen color
+		QString getTextClass(const QFont &font);
+
+		//! \brief Returns the paint server (fill value) for the current brush creating the needed definitions
+		QString getFillServer(void);
+
+		//! \brief Returns the id of the symbol that holds the provided image, creating the symbol if needed
+		QString getImageSymbol(const QImage &image, qint64 cache_key);
+
+		//! \brief Returns the path data (d attribute) of the provided path already mapped by the current transformation
+		QString getPathData(const QPainterPath &path);
+
+		//! \brief Returns the path data (d attribute) of the provided path without any transformation
+		static QString formatPathData(const QPainterPath &path);
+
+		//! \brief Writes the clip-path attribute of the element being written if a clip path is configured
+		void writeClipPath(void);
+
+		//! \brief Indicates if the current transformation has no rotation/shear so rectangles keep being rectangles
+		bool isSimpleTransform(void);
+
+		//! \brief Writes an image (as a reference to a symbol) in the provided rectangle
+		void writeImage(const QRectF &rect, const QString &symbol_id);
+
+		//! \brief Writes all the shared definitions collected while painting
+		void writeDefinitions(void);
+
+	public:
+		SvgStreamEngine(const QString &filename, const QSize &size, const QString &title, const QString &description);
+
+		bool begin(QPaintDevice *);
+		bool end(void);
+		void updateState(const QPaintEngineState &state);
+
+		void drawPath(const QPainterPath &path);
+		void drawRects(const QRectF *rects, int rect_count);
+		void drawRects(const QRect *rects, int rect_count);
+		void drawLines(const QLineF *lines, int line_count);
+		void drawLines(const QLine *lines, int line_count);
+		void drawEllipse(const QRectF &rect);
+		void drawPolygon(const QPointF *points, int point_count, PolygonDrawMode mode);
+		void drawPolygon(const QPoint *points, int point_count, PolygonDrawMode mode);
+		void drawPixmap(const QRectF &rect, const QPixmap &pixmap, const QRectF &src_rect);
+		void drawImage(const QRectF &rect, const QImage &image, const QRectF &src_rect, Qt::ImageConversionFlags flags = Qt::AutoColor);
+		void drawTextItem(const QPointF &pos, const QTextItem &text_item);
+
+		//! \brief Starts a group element with the provided id, class and title (the empty ones are not written)
+		void beginGroup(const QString &id, const QString &cls, const QString &title);
+		void endGroup(void);
+
+		//! \brief Configures the clip path (in document coordinates) of the next elements. An empty path disables the clipping
+		void setClipPath(const QPainterPath &path);
+
+		//! \brief Makes the text elements painted with the provided font family to be written using the new family
+		void setFontFamilyReplacement(const QString &family, const QString &new_family);
+
+		//! \brief Returns true if some error occurred while writing the output file
+		bool hasError(void);
+
+		Type type(void) const;
+};
+
+class SvgStreamDevice: public QPaintDevice {
+	private:
+		SvgStreamEngine *engine;
+
+		//! \brief Size of the document
+		QSize size;
+
+	protected:
+		int metric(PaintDeviceMetric metric) const;
+
+	public:
+		//! \brief Resolution of the device (the same used by SVG user units)
+		static constexpr int Resolution=96;
+
+		SvgStreamDevice(const QString &filename, const QSize &size, const QString &title, const QString &description);
+		~SvgStreamDevice(void);
+
+		QPaintEngine *paintEngine(void) const;
+
+		/*! \brief Starts a group element in the document. All elements painted until the call to endGroup()
+		 * are placed into the group. This method must be called while a painter is active on the device */
+		void beginGroup(const QString &id, const QString &cls, const QString &title);
+		void endGroup(void);
+
+		/*! \brief Configures the clip path (in document coordinates) applied to the elements painted from now on.
+		 * An empty path disables the clipping. The clip paths are written as shared definitions */
+		void setClipPath(const QPainterPath &path);
+
+		//! \brief Makes the text painted with the provided font family to be written using the new family
+		void setFontFamilyReplacement(const QString &family, const QString &new_family);
+
+		//! \brief Returns true if some error occurred while writing the output file
+		bool hasError(void);
+};
+
+#endif
@@ -20,6 +20,7 @@
 #include "numberedtexteditor.h"
 
 QFont SyntaxHighlighter::default_font=QFont(QString("Source Code Pro"), 10);
+map<QString, SyntaxHighlighter::HighlightConfig> SyntaxHighlighter::confs_cache;
 
 SyntaxHighlighter::SyntaxHighlighter(QPlainTextEdit *parent, bool single_line_mode, bool use_custom_tab_width) : QSyntaxHighlighter(parent)
 {
@@ -367,10 +368,40 @@ void SyntaxHighlighter::loadConfiguration(const QString &filename)
 		QRegExp regexp;
 		QColor bg_color, fg_color;
 		vector<QString>::iterator itr, itr_end;
+		QFileInfo fi(filename);
+		QChar conf_trigger;
 
 		try
 		{
 			clearConfiguration();
+
+			//Reusing the configuration compiled previously if the file wasn't changed since then
+			if(confs_cache.count(filename))
+			{
+				HighlightConfig &conf=confs_cache[filename];
+
+				if(conf.last_modified==fi.lastModified() && conf.size==fi.size())
+				{
+					initial_exprs=conf.initial_exprs;
+					final_exprs=conf.final_exprs;
+					formats=conf.formats;
+					this->partial_match=conf.partial_match;
+					lookahead_char=conf.lookahead_char;
+					groups_order=conf.groups_order;
+					word_separators=conf.word_separators;
+					word_delimiters=conf.word_delimiters;
+					ignored_chars=conf.ignored_chars;
+
+					if(!conf.completion_trigger.isNull())
+						completion_trigger=conf.completion_trigger;
+
+					conf_loaded=true;
+					return;
+				}
+
+				confs_cache.erase(filename);
+			}
+
 			xmlparser.restartParser();
 			xmlparser.setDTDFile(GlobalAttributes::TmplConfigurationDir +
 								 GlobalAttributes::DirSeparator +
@@ -410,7 +441,10 @@ void SyntaxHighlighter::loadConfiguration(const QString &filename)
 							xmlparser.getElementAttributes(attribs);
 
 							if(attribs[Attributes::Value].size() >= 1)
+							{
 								completion_trigger=attribs[Attributes::Value].at(0);
+								conf_trigger=completion_trigger;
+							}
 						}
 
 						/*	If the element is what defines the order of application of the groups
@@ -574,6 +608,20 @@ void SyntaxHighlighter::loadConfiguration(const QString &filename)
 			}
 
 			conf_loaded=true;
+
+			HighlightConfig &conf=confs_cache[filename];
+			conf.last_modified=fi.lastModified();
+			conf.size=fi.size();
+			conf.initial_exprs=initial_exprs;
+			conf.final_exprs=final_exprs;
+			conf.formats=formats;
+			conf.partial_match=this->partial_match;
+			conf.lookahead_char=lookahead_char;
+			conf.groups_order=groups_order;
+			conf.word_separators=word_separators;
+			conf.word_delimiters=word_delimiters;
+			conf.ignored_chars=ignored_chars;
+			conf.completion_trigger=conf_trigger;
 		}
 		catch(Exception &e)
 		{
@@ -608,4 +656,7 @@ void SyntaxHighlighter::setFormat(int start, int count, const QString &group)
 void SyntaxHighlighter::setDefaultFont(const QFont &fnt)
 {
 	SyntaxHighlighter::default_font=fnt;
+
+	//The cached formats use the previous font so the configurations must be compiled again
+	confs_cache.clear();
 }
@@ -57,6 +57,23 @@ class SyntaxHighlighter: public QSyntaxHighlighter {
 				}
 		};
 
+		//! \brief Stores a compiled highlighting configuration shared by the highlighters that load the same file
+		struct HighlightConfig {
+			QDateTime last_modified;
+			qint64 size;
+			map<QString, vector<QRegExp> > initial_exprs, final_exprs;
+			map<QString, QTextCharFormat> formats;
+			map<QString, bool> partial_match;
+			map<QString, QChar> lookahead_char;
+			vector<QString> groups_order;
+			QString word_separators, word_delimiters, ignored_chars;
+			QChar completion_trigger;
+		};
+
+		/*! \brief Configurations already loaded indexed by filename. Since the same files are loaded by dozens of
+		 * widgets this avoids parsing and validating them each time. This cache is used only from the GUI thread */
+		static map<QString, HighlightConfig> confs_cache;
+
 		//! \brief XML parser used to parse configuration files
 		XmlParser xmlparser;
 
@@ -323,37 +323,36 @@ void TableDataWidget::setAttributes(DatabaseModel *model, PhysicalTable *table)
 	add_row_tb->setEnabled(enable);
 
 	if(object)
+	{
+		data_format_cmb->setCurrentIndex(static_cast<int>(table->getInitialDataFormat()));
 		populateDataGrid();
+	}
 }
 
 void TableDataWidget::populateDataGrid(const QString &data)
 {
 	PhysicalTable *table=dynamic_cast<PhysicalTable *>(this->object);
 	QTableWidgetItem *item=nullptr;
-	QString ini_data;
-	int col=0, row=0;
-	QStringList columns, aux_cols, buffer, values;
+	int col=0, row=0, row_count=0;
+	QStringList columns, aux_cols;
+	vector<QStringList> values;
 	QVector<int> invalid_cols;
 	Column *column=nullptr;
 
 	clearRows(false);
 
-	if(!data.isEmpty())
-		ini_data=data;
-	else
-		ini_data=table->getInitialData();
-
 	/* If the initial data buffer is preset the columns
 	there have priority over the current table's columns */
-	if(!ini_data.isEmpty())
-	{		
-		buffer=ini_data.split(Table::DataLineBreak);
-
-		//The first line of the buffer always has the column names
-		if(!buffer.isEmpty() && !buffer[0].isEmpty())
-			columns.append(buffer[0].split(Table::DataSeparator));
-	}
+	if(!data.isEmpty())
+		row_count=PhysicalTable::splitInitialData(data, columns, values);
 	else
+	{
+		columns=table->getInitialDataColumns();
+		values=table->getInitialDataValues();
+		row_count=table->getInitialDataRowCount();
+	}
+
+	if(columns.isEmpty())
 	{
 		for(auto object : *table->getObjectList(ObjectType::Column))
 			columns.push_back(object->getName());
@@ -385,25 +384,23 @@ void TableDataWidget::populateDataGrid(const QString &data)
 		data_tbw->setHorizontalHeaderItem(col++, item);
 	}
 
-	buffer.removeAt(0);
-	row=0;
-
 	//Populating the grid with the data
-	for(QString buf_row : buffer)
-	{
-		addRow();
-		values = buf_row.split(Table::DataSeparator);
-		col = 0;
+	data_tbw->blockSignals(true);
+	data_tbw->setRowCount(row_count);
 
-		for(QString val : values)
+	for(row=0; row < row_count; row++)
+	{
+		for(col=0; col < columns.size(); col++)
 		{
-			if(col < columns.size())
-				data_tbw->item(row, col++)->setText(val);
+			item=new QTableWidgetItem(values[col][row]);
+			item->setFlags(Qt::ItemIsEditable | Qt::ItemIsSelectable | Qt::ItemIsEnabled);
+			data_tbw->setItem(row, col, item);
 		}
-
-		row++;
 	}
 
+	data_tbw->blockSignals(false);
+	clear_rows_tb->setEnabled(row_count > 0);
+
 	//Disabling invalid columns avoiding the user interaction
 	if(!invalid_cols.isEmpty())
 	{
@@ -472,21 +469,27 @@ void TableDataWidget::setItemInvalid(QTableWidgetItem *item)
 	}
 }
 
-QString TableDataWidget::generateDataBuffer(void)
+void TableDataWidget::generateData(QStringList &col_names, vector<QStringList> &values)
 {
-	QStringList val_list, col_names, buffer;
 	QString value;
-	int col = 0, col_count = data_tbw->horizontalHeader()->count();
+	int col = 0, col_count = data_tbw->horizontalHeader()->count(), row_count = data_tbw->rowCount();
+
+	col_names.clear();
+	values.clear();
+
+	if(row_count == 0)
+		return;
 
 	for(int col=0; col < col_count; col++)
 		col_names.push_back(data_tbw->horizontalHeaderItem(col)->text());
 
-	//The first line of the buffer consists in the column names
-	buffer.push_back(col_names.join(Table::DataSeparator));
+	values.resize(col_count);
 
-	for(int row = 0; row < data_tbw->rowCount(); row++)
+	for(col = 0; col < col_count; col++)
 	{
-		for(col = 0; col < col_count; col++)
+		values[col].reserve(row_count);
+
+		for(int row = 0; row < row_count; row++)
 		{
 			value = data_tbw->item(row, col)->text();
 
@@ -498,17 +501,9 @@ QString TableDataWidget::generateDataBuffer(void)
 												.arg(row + 1).arg(col_names[col]),
 												ErrorCode::MalformedUnescapedValue,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-			val_list.push_back(value);
+			values[col].append(value);
 		}
-
-		buffer.push_back(val_list.join(Table::DataSeparator));
-		val_list.clear();
 	}
-
-	if(buffer.size() <= 1)
-		return(QString());
-
-	return(buffer.join(Table::DataLineBreak));
 }
 
 void TableDataWidget::enterEvent(QEvent *)
@@ -584,7 +579,12 @@ void TableDataWidget::applyConfiguration(void)
 	try
 	{
 		PhysicalTable *table = dynamic_cast<PhysicalTable *>(this->object);
-		table->setInitialData(generateDataBuffer());
+		QStringList col_names;
+		vector<QStringList> values;
+
+		generateData(col_names, values);
+		table->setInitialData(col_names, values);
+		table->setInitialDataFormat(data_format_cmb->currentIndex());
 		emit s_closeRequested();
 	}
 	catch(Exception &e)
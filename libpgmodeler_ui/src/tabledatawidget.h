@@ -51,8 +51,9 @@ class TableDataWidget: public BaseObjectWidget, public Ui::TableDataWidget {
 		//! brief Marks a certain item as invalid cause it to be deactivated in the grid
 		void setItemInvalid(QTableWidgetItem *item);
 
-		//! brief Generated the CSV-like buffer to be used as initial data in the table object
-		QString generateDataBuffer(void);
+		/*! brief Generates the initial data of the table object from the grid. The values are stored
+		 * per column, values[col][row]. Empty grids produce an empty list of columns */
+		void generateData(QStringList &col_names, vector<QStringList> &values);
 
 		void showEvent(QShowEvent *);
 
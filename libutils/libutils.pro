@@ -16,11 +16,14 @@ windows: DESTDIR = $$PWD
 HEADERS += src/exception.h \
            src/globalattributes.h \
            src/pgsqlversions.h \
-    src/doublenan.h
+    src/doublenan.h \
+    src/memoryusage.h \
+    src/stallwatchdog.h
 
 SOURCES += src/exception.cpp \
            src/globalattributes.cpp \
-           src/pgsqlversions.cpp
+           src/pgsqlversions.cpp \
+           src/stallwatchdog.cpp
 
 # Deployment settings
 target.path = $$PRIVATELIBDIR
@@ -271,6 +271,8 @@ QString Exception::messages[Exception::ErrorCount][2]={
 	{"InvDataDictDirectory", QT_TR_NOOP("Failed to save the data dictionary into `%1'! Make sure that the provided path points to a directory or if the user has write permissions over it!")}
 };
 
+atomic<unsigned> Exception::raised_count(0);
+
 Exception::Exception(void)
 {
 	configureException(QString(),ErrorCode::Custom,QString(),QString(),-1,QString());
@@ -354,6 +356,17 @@ void Exception::configureException(const QString &msg, ErrorCode error_code, con
 	this->file=file;
 	this->line=line;
 	this->extra_info=QString(extra_info);
+
+	#ifndef QT_NO_DEBUG
+		//Empty exceptions (default constructor) are not considered as raised ones
+		if(!method.isEmpty())
+			raised_count++;
+	#endif
+}
+
+unsigned Exception::getRaisedCount(void)
+{
+	return(raised_count);
 }
 
 QString Exception::getErrorMessage(void)
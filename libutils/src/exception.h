@@ -33,6 +33,7 @@
 #include <vector>
 #include <deque>
 #include <type_traits>
+#include <atomic>
 
 using namespace std;
 
@@ -332,6 +333,10 @@ class Exception {
 		//! \brief Line of file where the exception were generated (Macro __LINE__)
 		int line;
 
+		/*! \brief Counts the exceptions raised so far (including the ones wrapping others when rethrown).
+		 * This is only updated on debug builds and is used to make sure that hot paths don't use exceptions as flow control */
+		static atomic<unsigned> raised_count;
+
 		//! \brief Configures the basic attributes of exception
 		void configureException(const QString &msg, ErrorCode error_code, const QString &method, const QString &file, int line, const QString &extra_info);
 
@@ -359,6 +364,9 @@ class Exception {
 		ErrorCode getErrorCode(void);
 		QString getExtraInfo(void);
 
+		//! \brief Returns the amount of exceptions raised so far. On release builds this is always zero
+		static unsigned getRaisedCount(void);
+
 		//! \brief Gets the full exception stack
 		void getExceptionsList(vector<Exception> &list);
 
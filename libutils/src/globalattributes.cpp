@@ -46,10 +46,13 @@ namespace GlobalAttributes {
 	BugReportEmail=QString("bug@pgmodeler.io"),
 	BugReportFile=QString("pgmodeler%1.bug"),
 	StacktraceFile=QString(".stacktrace"),
+	StallsLogFile=QString("stalls.log"),
+	StartupLogFile=QString("startup.log"),
 
 	DirSeparator=QString("/"),
 	DefaultConfsDir=QString("defaults"),
 	ConfsBackupsDir=QString("backups"),
+	ConfsCacheDir=QString("cache"),
 	SchemasDir=QString("schemas"),
 	SQLSchemaDir=QString("sql"),
 	XMLSchemaDir=QString("xml"),
@@ -70,6 +73,7 @@ namespace GlobalAttributes {
 	RelationshipsConf=QString("relationships"),
 	SnippetsConf=QString("snippets"),
 	SQLHistoryConf=QString("sql-history"),
+	SQLHistoryDir=QString("sql-history-store"),
 	DiffPresetsConf=QString("diff-presets"),
 
 	SQLHighlightConf=QString("sql-highlight"),
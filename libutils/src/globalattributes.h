@@ -53,10 +53,13 @@ namespace GlobalAttributes {
 	BugReportEmail,
 	BugReportFile,
 	StacktraceFile,
+	StallsLogFile, //! \brief Default name for the file that stores the reports of the event loop stalls (see StallWatchdog)
+	StartupLogFile, //! \brief Default name for the file that stores the timing of the last application startup
 
 	DirSeparator,
 	DefaultConfsDir,  //! \brief Directory name which holds the default pgModeler configuration
 	ConfsBackupsDir,  //! \brief Directory name which holds the pgModeler configuration backups
+	ConfsCacheDir,    //! \brief Directory name which holds the precompiled (cached) configuration files
 	SchemasDir,        //! \brief Default name for the schemas directory
 	SQLSchemaDir,     //! \brief Default name for the sql schemas directory
 	XMLSchemaDir,     //! \brief Default name for the xml schemas directory
@@ -82,6 +85,7 @@ namespace GlobalAttributes {
 	XMLHighlightConf, //! \brief Configuration file for XML language highlight
 	PatternHighlightConf, //! \brief Configuration file for name patterns highlight (relationship editing form)
 	SQLHistoryConf,		//! \brief Default name for the SQL commands history configuration file
+	SQLHistoryDir,		//! \brief Default name for the directory that holds the SQL commands history stores
 
 	ExampleModel, //! \brief Default name for the sample model loaded on appearence configuration form
 	UiStyleConf, //! \brief Configuration file ui style
@@ -0,0 +1,92 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libutils
+\namespace MemoryUsage
+\brief Definition of MemoryUsage namespace which reunites a set of functions used to estimate the amount of
+ heap memory held by the most common containers used in pgModeler. The returned values are estimations since they
+ do not consider the allocator overhead and the containers' internal capacity.
+*/
+
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include <map>
+#include <QString>
+#include <QStringList>
+
+namespace MemoryUsage {
+	/*! \brief Estimated size (in bytes) of each node allocated by a std::map (three pointers plus the color flag)
+	 * excluding the key and value stored in the node */
+	static constexpr size_t MapNodeSize=4 * sizeof(void *);
+
+	//! \brief Returns the amount of heap memory held by the provided string
+	inline size_t getStringSize(const QString &str)
+	{
+		if(str.isNull())
+			return(0);
+
+		return(sizeof(QArrayData) + (static_cast<size_t>(str.capacity()) + 1) * sizeof(QChar));
+	}
+
+	//! \brief Returns the amount of heap memory held by the provided string list including the strings
+	inline size_t getStringListSize(const QStringList &list)
+	{
+		size_t size=0;
+
+		if(list.isEmpty())
+			return(0);
+
+		size=sizeof(QListData::Data) + (static_cast<size_t>(list.size()) * sizeof(void *));
+
+		for(auto &str : list)
+			size+=getStringSize(str);
+
+		return(size);
+	}
+
+	//! \brief Returns the amount of heap memory held by the provided map of strings (e.g. attribs_map) including keys and values
+	inline size_t getStringMapSize(const std::map<QString, QString> &map)
+	{
+		size_t size=map.size() * (MapNodeSize + 2 * sizeof(QString));
+
+		for(auto &itr : map)
+			size+=getStringSize(itr.first) + getStringSize(itr.second);
+
+		return(size);
+	}
+
+	//! \brief Returns the provided amount of bytes formatted as a human readable string (bytes, KB, MB, GB)
+	inline QString formatSize(size_t bytes)
+	{
+		static const QStringList units={ QString("bytes"), QString("KB"), QString("MB"), QString("GB") };
+		double size=bytes;
+		int unit=0;
+
+		while(size >= 1024 && unit < units.size() - 1)
+		{
+			size/=1024;
+			unit++;
+		}
+
+		return(QString("%1 %2").arg(unit == 0 ? QString::number(bytes) : QString::number(size, 'f', 2)).arg(units[unit]));
+	}
+}
+
+#endif
@@ -0,0 +1,180 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "stallwatchdog.h"
+#include "globalattributes.h"
+#include <QCoreApplication>
+#include <QThread>
+#include <QFile>
+#include <QDateTime>
+#include <QTextStream>
+#include <algorithm>
+
+bool StallWatchdog::enabled=false;
+unsigned StallWatchdog::threshold=StallWatchdog::DefaultThreshold;
+QStringList StallWatchdog::active_markers;
+map<QString, pair<qint64, unsigned>> StallWatchdog::sections_time;
+QStringList StallWatchdog::reports;
+
+StallWatchdog::StallWatchdog(QObject *parent) : QObject(parent)
+{
+	heartbeat_timer.setInterval(HeartbeatInterval);
+	heartbeat_timer.setTimerType(Qt::PreciseTimer);
+	connect(&heartbeat_timer, SIGNAL(timeout()), this, SLOT(checkLatency()));
+}
+
+void StallWatchdog::setEnabled(bool value)
+{
+	if(value == enabled)
+		return;
+
+	enabled=value;
+	active_markers.clear();
+	sections_time.clear();
+
+	if(enabled)
+	{
+		heartbeat_clock.start();
+		heartbeat_timer.start();
+	}
+	else
+		heartbeat_timer.stop();
+}
+
+void StallWatchdog::setThreshold(unsigned value)
+{
+	threshold=(value < MinimumThreshold ? MinimumThreshold : value);
+}
+
+bool StallWatchdog::isEnabled(void)
+{
+	return(enabled);
+}
+
+unsigned StallWatchdog::getThreshold(void)
+{
+	return(threshold);
+}
+
+QStringList StallWatchdog::getReports(void)
+{
+	return(reports);
+}
+
+void StallWatchdog::clearReports(void)
+{
+	reports.clear();
+}
+
+QString StallWatchdog::getLogFilename(void)
+{
+	return(GlobalAttributes::TemporaryDir + GlobalAttributes::DirSeparator + GlobalAttributes::StallsLogFile);
+}
+
+bool StallWatchdog::isMainThread(void)
+{
+	return(QCoreApplication::instance() && QThread::currentThread() == QCoreApplication::instance()->thread());
+}
+
+void StallWatchdog::checkLatency(void)
+{
+	qint64 latency=heartbeat_clock.restart() - HeartbeatInterval;
+
+	if(latency >= static_cast<qint64>(threshold))
+	{
+		QString report;
+		QTextStream out(&report);
+		vector<pair<qint64, QString>> sections;
+		qint64 min_time=threshold / 4;
+
+		out << QString("[%1] Event loop stalled for %2 ms")
+					 .arg(QDateTime::currentDateTime().toString(QString("yyyy-MM-dd hh:mm:ss.zzz")))
+					 .arg(latency) << endl;
+
+		//Listing the sections that took a considerable part of the stall, the slowest first
+		for(auto &itr : sections_time)
+		{
+			if(itr.second.first >= min_time)
+				sections.push_back({ itr.second.first, QString("%1 (%2 call(s))").arg(itr.first).arg(itr.second.second) });
+		}
+
+		std::sort(sections.begin(), sections.end(), [](const pair<qint64, QString> &sec1, const pair<qint64, QString> &sec2){
+			return(sec1.first > sec2.first);
+		});
+
+		if(sections.empty() && active_markers.isEmpty())
+			out << QString("  (no marked section was responsible, the stall happened in an unmarked code path)") << endl;
+
+		for(auto &section : sections)
+			out << QString("  %1 ms : %2").arg(section.first, 6).arg(section.second) << endl;
+
+		/* Markers still running here means that a nested event loop (e.g. a modal dialog)
+		 * was started inside them, so they are listed as the stall context */
+		if(!active_markers.isEmpty())
+			out << QString("  running : %1").arg(active_markers.join(QString(" > "))) << endl;
+
+		out.flush();
+
+		if(reports.size() >= static_cast<int>(MaxReports))
+			reports.removeFirst();
+
+		reports.append(report);
+		writeReport(report);
+		emit s_stallDetected(report);
+	}
+
+	sections_time.clear();
+}
+
+void StallWatchdog::writeReport(const QString &report)
+{
+	QFile log(getLogFilename());
+
+	if(!log.open(QFile::Append | QFile::Text))
+		return;
+
+	log.write(report.toUtf8());
+	log.close();
+}
+
+StallMarker::StallMarker(const char *section)
+{
+	active=StallWatchdog::enabled && StallWatchdog::isMainThread();
+
+	if(active)
+	{
+		StallWatchdog::active_markers.append(QString(section));
+		clock.start();
+	}
+}
+
+StallMarker::~StallMarker(void)
+{
+	if(!active)
+		return;
+
+	if(StallWatchdog::enabled)
+	{
+		pair<qint64, unsigned> &sec_time=StallWatchdog::sections_time[StallWatchdog::active_markers.join(QString(" > "))];
+		sec_time.first+=clock.elapsed();
+		sec_time.second++;
+	}
+
+	if(!StallWatchdog::active_markers.isEmpty())
+		StallWatchdog::active_markers.removeLast();
+}
@@ -0,0 +1,136 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libutils
+\class StallWatchdog
+\brief Implements an opt-in monitor that measures the latency of the main thread's event loop and records
+ every stall that exceeds a configurable threshold. The stalls are attributed to the code sections
+ that took too long to run by means of StallMarker objects placed in the known heavy functions.
+ The reports are kept in memory (see getReports()) and appended to a log file in the temporary directory.
+*/
+
+#ifndef STALL_WATCHDOG_H
+#define STALL_WATCHDOG_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <map>
+
+using namespace std;
+
+class StallWatchdog: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Timer that posts a heartbeat event in the event loop at each HeartbeatInterval
+		QTimer heartbeat_timer;
+
+		//! \brief Measures the time elapsed between two consecutive heartbeats
+		QElapsedTimer heartbeat_clock;
+
+		//! \brief Indicates if the watchdog is running. Markers do nothing while this flag is false
+		static bool enabled;
+
+		//! \brief Minimum event loop latency (in milliseconds) considered as a stall
+		static unsigned threshold;
+
+		//! \brief Stack of the markers currently running in the main thread
+		static QStringList active_markers;
+
+		/*! \brief Time spent (in milliseconds) and amount of calls of each marked section (identified by the path of
+		 * enclosing markers) finished since the last heartbeat. The time is accumulated so a stall caused by many
+		 * short calls of the same section (e.g. one per relationship) is attributed as well */
+		static map<QString, pair<qint64, unsigned>> sections_time;
+
+		//! \brief Reports of the stalls detected in the current session (at most MaxReports)
+		static QStringList reports;
+
+		//! \brief Appends the report to the stalls log file
+		void writeReport(const QString &report);
+
+		//! \brief Returns true when the current thread is the application's main thread
+		static bool isMainThread(void);
+
+	public:
+		//! \brief Default event loop latency (in milliseconds) considered as a stall
+		static constexpr unsigned DefaultThreshold=250,
+
+		//! \brief Minimum threshold accepted (in milliseconds)
+		MinimumThreshold=50,
+
+		//! \brief Interval (in milliseconds) between two heartbeats
+		HeartbeatInterval=50,
+
+		//! \brief Maximum amount of reports kept in memory
+		MaxReports=200;
+
+		StallWatchdog(QObject *parent = nullptr);
+
+		//! \brief Starts or stops measuring the event loop latency
+		void setEnabled(bool value);
+
+		//! \brief Defines the minimum event loop latency (in milliseconds) considered as a stall
+		void setThreshold(unsigned value);
+
+		static bool isEnabled(void);
+		static unsigned getThreshold(void);
+
+		//! \brief Returns the reports of the stalls detected in the current session
+		static QStringList getReports(void);
+
+		//! \brief Clears the reports kept in memory (the log file is preserved)
+		static void clearReports(void);
+
+		//! \brief Returns the full path to the log file where the stall reports are written
+		static QString getLogFilename(void);
+
+		friend class StallMarker;
+
+	private slots:
+		//! \brief Measures the latency of the event loop and creates a report when it exceeds the threshold
+		void checkLatency(void);
+
+	signals:
+		//! \brief Signal emitted every time a stall is detected. The report of the stall is sent together
+		void s_stallDetected(QString report);
+};
+
+/**
+\ingroup libutils
+\class StallMarker
+\brief Scoped timing marker used to attribute the stalls detected by StallWatchdog. The marker measures the time
+ spent since its creation until its destruction and accumulates
+ the time spent in the section (including the enclosing markers) to be attributed to the next detected stall.
+ When the watchdog is disabled or the marker is created outside the main thread, it does nothing.
+*/
+class StallMarker {
+	private:
+		QElapsedTimer clock;
+
+		//! \brief Indicates if the marker is being measured (watchdog enabled and main thread)
+		bool active;
+
+	public:
+		StallMarker(const char *section);
+		~StallMarker(void);
+};
+
+#endif
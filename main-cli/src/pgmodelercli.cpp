@@ -55,6 +55,7 @@ const QString PgModelerCli::ListConns=QString("--list-conns");
 const QString PgModelerCli::Simulate=QString("--simulate");
 const QString PgModelerCli::FixModel=QString("--fix-model");
 const QString PgModelerCli::FixTries=QString("--fix-tries");
+const QString PgModelerCli::MemoryReport=QString("--memory-report");
 const QString PgModelerCli::ZoomFactor=QString("--zoom");
 const QString PgModelerCli::UseTmpNames=QString("--use-tmp-names");
 const QString PgModelerCli::DbmMimeType=QString("--dbm-mime-type");
@@ -148,7 +149,8 @@ PgModelerCli::PgModelerCli(int argc, char **argv) :  QApplication(argc, argv)
 			silent_mode=(parsed_opts.count(Silent));
 
 			//If the export is to png or svg loads additional configurations
-			if(parsed_opts.count(ExportToPng) || parsed_opts.count(ExportToSvg) || parsed_opts.count(ImportDb))
+			if(parsed_opts.count(ExportToPng) || parsed_opts.count(ExportToSvg) ||
+				 parsed_opts.count(ImportDb) || parsed_opts.count(MemoryReport))
 			{
 				connect(model, SIGNAL(s_objectAdded(BaseObject*)), this, SLOT(handleObjectAddition(BaseObject *)));
 				connect(model, SIGNAL(s_objectRemoved(BaseObject*)), this, SLOT(handleObjectRemoval(BaseObject *)));
@@ -266,6 +268,7 @@ void PgModelerCli::initializeOptions(void)
 	long_opts[Simulate]=false;
 	long_opts[FixModel]=false;
 	long_opts[FixTries]=true;
+	long_opts[MemoryReport]=false;
 	long_opts[ZoomFactor]=true;
 	long_opts[UseTmpNames]=false;
 	long_opts[DbmMimeType]=true;
@@ -321,6 +324,7 @@ void PgModelerCli::initializeOptions(void)
 	short_opts[Simulate]=QString("-sm");
 	short_opts[FixModel]=QString("-fm");
 	short_opts[FixTries]=QString("-ft");
+	short_opts[MemoryReport]=QString("-mr");
 	short_opts[ZoomFactor]=QString("-zf");
 	short_opts[UseTmpNames]=QString("-tn");
 	short_opts[DbmMimeType]=QString("-mt");
@@ -388,6 +392,7 @@ void PgModelerCli::showMenu(void)
 	out << trUtf8("  %1, %2 [FILE]\t\t    Output file. This is mandatory for fixing model or exporting to file, png or svg.").arg(short_opts[Output]).arg(Output) << endl;
 	out << trUtf8("  %1, %2\t\t    Try to fix the structure of the input model file in order to make it loadable again.").arg(short_opts[FixModel]).arg(FixModel) << endl;
 	out << trUtf8("  %1, %2 [NUMBER]\t    Model fix tries. When reaching the maximum count the invalid objects will be discarded.").arg(short_opts[FixTries]).arg(FixTries) << endl;
+	out << trUtf8("  %1, %2\t\t    Loads the input model and reports its estimated memory usage per subsystem and object type.").arg(short_opts[MemoryReport]).arg(MemoryReport) << endl;
 	out << trUtf8("  %1, %2\t\t    Export the input model to a sql script file.").arg(short_opts[ExportToFile]).arg(ExportToFile)<< endl;
 	out << trUtf8("  %1, %2\t\t    Export the input model to a png image.").arg(short_opts[ExportToPng]).arg(ExportToPng) << endl;
 	out << trUtf8("  %1, %2\t\t    Export the input model to a svg file.").arg(short_opts[ExportToSvg]).arg(ExportToSvg) << endl;
@@ -473,7 +478,7 @@ void PgModelerCli::parseOptions(attribs_map &opts)
 		conn_conf.getConnections(connections, false);
 	}
 	//Loading general and relationship settings when exporting to image formats
-	else if(opts.count(ExportToPng) || opts.count(ExportToSvg))
+	else if(opts.count(ExportToPng) || opts.count(ExportToSvg) || opts.count(MemoryReport))
 	{
 		general_conf.loadConfiguration();
 		rel_conf.loadConfiguration();
@@ -507,7 +512,8 @@ void PgModelerCli::parseOptions(attribs_map &opts)
 	{
 		int mode_cnt=0, other_modes_cnt=0;
 		bool fix_model=(opts.count(FixModel) > 0), upd_mime=(opts.count(DbmMimeType) > 0),
-				import_db=(opts.count(ImportDb) > 0), diff=(opts.count(Diff) > 0);
+				import_db=(opts.count(ImportDb) > 0), diff=(opts.count(Diff) > 0),
+				mem_report=(opts.count(MemoryReport) > 0);
 
 		//Checking if multiples export modes were specified
 		mode_cnt+=opts.count(ExportToFile);
@@ -520,6 +526,7 @@ void PgModelerCli::parseOptions(attribs_map &opts)
 		other_modes_cnt+=opts.count(ImportDb);
 		other_modes_cnt+=opts.count(Diff);
 		other_modes_cnt+=opts.count(DbmMimeType);
+		other_modes_cnt+=opts.count(MemoryReport);
 
 		if(opts.count(ZoomFactor))
 			zoom=opts[ZoomFactor].toDouble()/static_cast<double>(100);
@@ -527,8 +534,8 @@ void PgModelerCli::parseOptions(attribs_map &opts)
 		if(other_modes_cnt==0 && mode_cnt==0)
 			throw Exception(trUtf8("No operation mode was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		
-		if((mode_cnt > 0 && (fix_model || upd_mime || import_db || diff)) || (mode_cnt==0 && other_modes_cnt > 1))
-			throw Exception(trUtf8("Export, fix model, import database, diff and update mime operations can't be used at the same time!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		if((mode_cnt > 0 && (fix_model || upd_mime || import_db || diff || mem_report)) || (mode_cnt==0 && other_modes_cnt > 1))
+			throw Exception(trUtf8("Export, fix model, import database, diff, memory report and update mime operations can't be used at the same time!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		
 		if(!fix_model && !upd_mime && mode_cnt > 1)
 			throw Exception(trUtf8("Multiple export mode was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -539,7 +546,7 @@ void PgModelerCli::parseOptions(attribs_map &opts)
 		if(import_db && opts[InputDb].isEmpty())
 			throw Exception(trUtf8("No input database was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		if(!opts.count(ExportToDbms) && !upd_mime && !diff && opts[Output].isEmpty())
+		if(!opts.count(ExportToDbms) && !upd_mime && !diff && !mem_report && opts[Output].isEmpty())
 			throw Exception(trUtf8("No output file was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		
 		if(!opts.count(ExportToDbms) && !upd_mime && !import_db &&
@@ -596,6 +603,8 @@ int PgModelerCli::exec(void)
 
 			if(parsed_opts.count(FixModel))
 				fixModel();
+			else if(parsed_opts.count(MemoryReport))
+				showMemoryReport();
 			else if(parsed_opts.count(DbmMimeType))
 				updateMimeType();
 			else if(parsed_opts.count(ImportDb))
@@ -635,7 +644,8 @@ void PgModelerCli::handleObjectAddition(BaseObject *object)
 {
 	BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(object);
 
-	if(graph_obj)
+	//Objects of collapsed schemas are represented only by the schema box and the relationship bundles
+	if(graph_obj && !SchemaView::isObjectCollapsed(graph_obj))
 	{
 		ObjectType obj_type=graph_obj->getObjectType();
 		QGraphicsItem *item=nullptr;
@@ -1265,6 +1275,18 @@ void PgModelerCli::fixModel(void)
 	printMessage(trUtf8("Model successfully fixed!"));
 }
 
+void PgModelerCli::showMemoryReport(void)
+{
+	printMessage(trUtf8("Loading input file: %1").arg(parsed_opts[Input]));
+
+	model->createSystemObjects(false);
+	model->loadModel(parsed_opts[Input]);
+
+	//The report is printed even in silent mode since it is the operation's output
+	out << endl << trUtf8("Estimated memory usage of the model: %1").arg(parsed_opts[Input]) << endl;
+	out << MemoryUsageWidget::getMemoryUsageReport(model, scene, nullptr) << endl;
+}
+
 void PgModelerCli::exportModel(void)
 {
 	printMessage(trUtf8("Starting model export..."));
@@ -1276,6 +1298,13 @@ void PgModelerCli::exportModel(void)
 	//Load the model file
 	model->loadModel(parsed_opts[Input]);
 
+	//Creating the bundled edges of the relationships attached to collapsed schemas
+	if(scene)
+	{
+		for(auto &bundle : RelationshipBundleItem::createBundles(model))
+			scene->addItem(bundle);
+	}
+
 	//Export to PNG
 	if(parsed_opts.count(ExportToPng))
 	{
@@ -38,6 +38,7 @@
 #include "generalconfigwidget.h"
 #include "databaseimporthelper.h"
 #include "modelsdiffhelper.h"
+#include "memoryusagewidget.h"
 
 class PgModelerCli: public QApplication {
 	private:
@@ -133,6 +134,7 @@ class PgModelerCli: public QApplication {
 		Simulate,
 		FixModel,
 		FixTries,
+		MemoryReport,
 		ZoomFactor,
 		UseTmpNames,
 		DbmMimeType,
@@ -204,6 +206,10 @@ class PgModelerCli: public QApplication {
 		void fixOpClassesFamiliesReferences(QString &obj_xml);
 
 		void fixModel(void);
+
+		//! \brief Loads the input model and prints the estimated memory usage per subsystem and object type
+		void showMemoryReport(void);
+
 		void exportModel(void);
 		void importDatabase(void);
 		void diffModelDatabase(void);
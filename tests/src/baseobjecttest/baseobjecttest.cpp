@@ -19,6 +19,7 @@
 #include <QtTest/QtTest>
 #include "pgmodelerns.h"
 #include "table.h"
+#include "schema.h"
 
 class BaseObjectTest: public QObject {
   private:
@@ -27,6 +28,7 @@ class BaseObjectTest: public QObject {
   private slots:
     void quoteNameIfKeyword(void);
     void nameIsInvalidIfStartsWithNumber(void);
+    void contentHashChangesOnlyWhenObjectIsModified(void);
 };
 
 void BaseObjectTest::quoteNameIfKeyword(void)
@@ -44,6 +46,29 @@ void BaseObjectTest::nameIsInvalidIfStartsWithNumber(void)
   QCOMPARE(BaseObject::isValidName("nameA"), true);
 }
 
+void BaseObjectTest::contentHashChangesOnlyWhenObjectIsModified(void)
+{
+  Schema sch1, sch2;
+
+  sch1.setName("schema");
+  sch2.setName("schema");
+  QCOMPARE(sch1.getContentHash(), sch2.getContentHash());
+  QCOMPARE(sch1.isCodeDiffersFrom(&sch2), false);
+
+  sch2.setComment("a comment");
+  QVERIFY(sch1.getContentHash() != sch2.getContentHash());
+  QCOMPARE(sch1.isCodeDiffersFrom(&sch2), true);
+  QCOMPARE(sch1.isCodeDiffersFrom(&sch2, {}, { Attributes::Comment }), false);
+
+  sch2.setComment("");
+  QCOMPARE(sch1.getContentHash(), sch2.getContentHash());
+
+  //Attributes that are ignored in the comparison must not affect the hash
+  sch2.setRectVisible(true);
+  QVERIFY(sch1.getContentHash() != sch2.getContentHash());
+  QCOMPARE(sch1.getContentHash({ Attributes::RectVisible }), sch2.getContentHash({ Attributes::RectVisible }));
+  QCOMPARE(sch1.isCodeDiffersFrom(&sch2, { Attributes::RectVisible }), false);
+}
 
 QTEST_MAIN(BaseObjectTest)
 #include "baseobjecttest.moc"
@@ -0,0 +1,222 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <random>
+#include "catalog.h"
+
+class CatalogTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Encodes the values as a PostgreSQL array literal quoting and escaping the elements when needed
+		static QString encodeArray(const QStringList &values);
+
+	private slots:
+		void parseArrayMustKeepElementsRaw(void);
+		void decodeArrayMustHandleQuotesEscapesAndNulls(void);
+		void parseArrayMustHandleDimensionsAndInvalidInput(void);
+		void parseDefaultValuesMustRespectStringsAndNesting(void);
+		void decodeArrayMustRoundTripRandomValues(void);
+		void parseArrayMustNotFailOnRandomInput(void);
+		void benchmarkLongAclArray(void);
+		void benchmarkPathologicalQuotedArray(void);
+		void benchmarkLongDefaultValues(void);
+};
+
+QString CatalogTest::encodeArray(const QStringList &values)
+{
+	QStringList elems;
+	QString elem;
+
+	for(auto &value : values)
+	{
+		if(value.isNull())
+			elems.push_back(QString("NULL"));
+		else if(value.isEmpty() || value.contains(QRegExp("[{},\"\\\\ ]")) ||
+						value.compare(QString("NULL"), Qt::CaseInsensitive)==0)
+		{
+			elem=value;
+			elem.replace(QString("\\"), QString("\\\\"));
+			elem.replace(QString("\""), QString("\\\""));
+			elems.push_back(QString("\"%1\"").arg(elem));
+		}
+		else
+			elems.push_back(value);
+	}
+
+	return(QString("{%1}").arg(elems.join(',')));
+}
+
+void CatalogTest::parseArrayMustKeepElementsRaw(void)
+{
+	QCOMPARE(Catalog::parseArrayValues(QString("{a,b,c}")), QStringList({ "a", "b", "c" }));
+	QCOMPARE(Catalog::parseArrayValues(QString("{\"a,b\",c}")), QStringList({ "\"a,b\"", "c" }));
+	QCOMPARE(Catalog::parseArrayValues(QString("{\"a\\\",b\",c}")), QStringList({ "\"a\\\",b\"", "c" }));
+	QCOMPARE(Catalog::parseArrayValues(QString("{{1,2},{3,4}}")), QStringList({ "{1,2}", "{3,4}" }));
+	QCOMPARE(Catalog::parseArrayValues(QString("{postgres=arwdDxt/postgres,=r/postgres}")),
+					 QStringList({ "postgres=arwdDxt/postgres", "=r/postgres" }));
+}
+
+void CatalogTest::decodeArrayMustHandleQuotesEscapesAndNulls(void)
+{
+	QStringList values;
+
+	values=Catalog::decodeArrayValues(QString("{\"a,b\",\"say \\\"hi\\\"\",NULL,\"NULL\",\"\",c\\,d, e }"));
+	QCOMPARE(values.size(), 7);
+	QCOMPARE(values[0], QString("a,b"));
+	QCOMPARE(values[1], QString("say \"hi\""));
+	QVERIFY(values[2].isNull());
+	QCOMPARE(values[3], QString("NULL"));
+	QVERIFY(!values[4].isNull() && values[4].isEmpty());
+	QCOMPARE(values[5], QString("c,d"));
+	QCOMPARE(values[6], QString("e"));
+
+	QCOMPARE(Catalog::decodeArrayValues(QString("{\"{x}\",{1,2}}")), QStringList({ "{x}", "{1,2}" }));
+}
+
+void CatalogTest::parseArrayMustHandleDimensionsAndInvalidInput(void)
+{
+	QCOMPARE(Catalog::parseArrayValues(QString("[0:2]={a,b,c}")), QStringList({ "a", "b", "c" }));
+	QCOMPARE(Catalog::parseArrayValues(QString("[1:2][-1:0]={{a,b},{c,d}}")), QStringList({ "{a,b}", "{c,d}" }));
+	QVERIFY(Catalog::parseArrayValues(QString()).isEmpty());
+	QVERIFY(Catalog::parseArrayValues(QString("{}")).isEmpty());
+	QVERIFY(Catalog::parseArrayValues(QString("a,b")).isEmpty());
+	QVERIFY(Catalog::parseArrayValues(QString("{a,b")).isEmpty());
+	QVERIFY(Catalog::parseArrayValues(QString("[1:]={a}")).isEmpty());
+	QVERIFY(Catalog::parseArrayValues(QString("[1:2]{a}")).isEmpty());
+}
+
+void CatalogTest::parseDefaultValuesMustRespectStringsAndNesting(void)
+{
+	QCOMPARE(Catalog::parseDefaultValues(QString("'a, b'::text, 1, NULL::integer")),
+					 QStringList({ "'a, b'::text", "1", "NULL::integer" }));
+	QCOMPARE(Catalog::parseDefaultValues(QString("'it''s, ok'::text, ARRAY[1, 2], now()")),
+					 QStringList({ "'it''s, ok'::text", "ARRAY[1, 2]", "now()" }));
+	QCOMPARE(Catalog::parseDefaultValues(QString("\"a,b\",c"), QString("\""), QString(",")),
+					 QStringList({ "\"a,b\"", "c" }));
+	QCOMPARE(Catalog::parseDefaultValues(QString("10")), QStringList({ "10" }));
+	QVERIFY(Catalog::parseDefaultValues(QString()).isEmpty());
+}
+
+void CatalogTest::decodeArrayMustRoundTripRandomValues(void)
+{
+	std::mt19937 rand_gen(2019);
+	std::uniform_int_distribution<int> count_dist(1, 30), len_dist(0, 12), chr_dist(0, 11), null_dist(0, 9);
+	const QString chars=QString("ab ,{}\"\\=/x\u00e7");
+	QStringList values;
+	QString value;
+
+	for(int test=0; test < 5000; test++)
+	{
+		int count=count_dist(rand_gen);
+
+		values.clear();
+
+		for(int i=0; i < count; i++)
+		{
+			if(null_dist(rand_gen)==0)
+			{
+				values.push_back(QString());
+				continue;
+			}
+
+			value=QString("");
+
+			for(int len=len_dist(rand_gen); len > 0; len--)
+				value+=chars.at(chr_dist(rand_gen));
+
+			values.push_back(value);
+		}
+
+		QCOMPARE(Catalog::decodeArrayValues(encodeArray(values)), values);
+	}
+}
+
+void CatalogTest::parseArrayMustNotFailOnRandomInput(void)
+{
+	std::mt19937 rand_gen(1986);
+	std::uniform_int_distribution<int> len_dist(0, 64), chr_dist(0, 12);
+	const QString chars=QString("{},\"\\[]:=-1a ");
+	QString input;
+
+	//Random (mostly invalid) inputs must be handled without crashes or infinite loops
+	for(int test=0; test < 20000; test++)
+	{
+		input.clear();
+
+		for(int len=len_dist(rand_gen); len > 0; len--)
+			input+=chars.at(chr_dist(rand_gen));
+
+		Catalog::parseArrayValues(input);
+		Catalog::decodeArrayValues(input);
+		Catalog::parseDefaultValues(input);
+	}
+}
+
+void CatalogTest::benchmarkLongAclArray(void)
+{
+	QStringList acl;
+	QString array_val;
+
+	for(int i=0; i < 20000; i++)
+		acl.push_back(QString("role_%1=arwdDxt/postgres").arg(i));
+
+	array_val=QString("{%1}").arg(acl.join(','));
+
+	QBENCHMARK
+	{
+		QCOMPARE(Catalog::parseArrayValues(array_val).size(), acl.size());
+	}
+}
+
+void CatalogTest::benchmarkPathologicalQuotedArray(void)
+{
+	QStringList labels;
+	QString array_val;
+
+	//Enum labels full of commas, quotes and backslashes
+	for(int i=0; i < 10000; i++)
+		labels.push_back(QString("label, \"%1\" \\ {x}").arg(i));
+
+	array_val=encodeArray(labels);
+
+	QBENCHMARK
+	{
+		QCOMPARE(Catalog::decodeArrayValues(array_val).size(), labels.size());
+	}
+}
+
+void CatalogTest::benchmarkLongDefaultValues(void)
+{
+	QStringList defaults;
+	QString def_vals;
+
+	for(int i=0; i < 5000; i++)
+		defaults.push_back(QString("'value, ''%1'''::text").arg(i));
+
+	def_vals=defaults.join(QString(", "));
+
+	QBENCHMARK
+	{
+		QCOMPARE(Catalog::parseDefaultValues(def_vals).size(), defaults.size());
+	}
+}
+
+QTEST_MAIN(CatalogTest)
+#include "catalogtest.moc"
@@ -0,0 +1,233 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "objectsscene.h"
+#include "relationshipbundleitem.h"
+
+class CollapsedSchemaTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Creates a table in the provided schema adding it to the model
+		Table *createTable(DatabaseModel &model, Schema *schema, const QString &name);
+
+		//! \brief Creates a foreign key relationship between the provided tables adding it to the model
+		BaseRelationship *createRelationship(DatabaseModel &model, Table *src_tab, Table *dst_tab, const QString &name);
+
+	private slots:
+		void collapsedStateMustSurviveXMLRoundTrip(void);
+		void objectsMustBeCollapsedWithTheirSchemas(void);
+		void bundlesMustGroupRelationshipsByEndpointBoxes(void);
+};
+
+Table *CollapsedSchemaTest::createTable(DatabaseModel &model, Schema *schema, const QString &name)
+{
+	Table *table=new Table;
+
+	table->setName(name);
+	table->setSchema(schema);
+	model.addTable(table);
+
+	return(table);
+}
+
+BaseRelationship *CollapsedSchemaTest::createRelationship(DatabaseModel &model, Table *src_tab, Table *dst_tab, const QString &name)
+{
+	BaseRelationship *rel=new BaseRelationship(BaseRelationship::RelationshipFk, src_tab, dst_tab, false, false);
+
+	rel->setName(name);
+	model.addRelationship(rel);
+
+	return(rel);
+}
+
+void CollapsedSchemaTest::collapsedStateMustSurviveXMLRoundTrip(void)
+{
+	DatabaseModel model;
+	Schema schema, *aux_schema=nullptr;
+
+	try
+	{
+		schema.setName(QString("schema_a"));
+		QVERIFY(!schema.getCodeDefinition(SchemaParser::XmlDefinition).contains(QString("collapsed=")));
+
+		schema.setCollapsed(true);
+		QVERIFY(schema.getCodeDefinition(SchemaParser::XmlDefinition).contains(QString("collapsed=\"true\"")));
+
+		for(auto collapsed : { true, false })
+		{
+			schema.setCollapsed(collapsed);
+			model.getXMLParser()->restartParser();
+			model.getXMLParser()->loadXMLBuffer(schema.getCodeDefinition(SchemaParser::XmlDefinition));
+			aux_schema=model.createSchema();
+
+			QCOMPARE(aux_schema->isCollapsed(), collapsed);
+			QCOMPARE(aux_schema->getCodeDefinition(SchemaParser::XmlDefinition).contains(QString("collapsed=\"true\"")), collapsed);
+			delete(aux_schema);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CollapsedSchemaTest::objectsMustBeCollapsedWithTheirSchemas(void)
+{
+	DatabaseModel model;
+	Schema *sch_a=nullptr, *sch_b=nullptr;
+	Table *tab_a1=nullptr, *tab_a2=nullptr, *tab_b=nullptr, *tab_c=nullptr;
+
+	try
+	{
+		model.createSystemObjects(true);
+
+		sch_a=new Schema;
+		sch_a->setName(QString("schema_a"));
+		model.addSchema(sch_a);
+
+		sch_b=new Schema;
+		sch_b->setName(QString("schema_b"));
+		model.addSchema(sch_b);
+
+		tab_a1=createTable(model, sch_a, QString("table_a1"));
+		tab_a2=createTable(model, sch_a, QString("table_a2"));
+		tab_b=createTable(model, sch_b, QString("table_b"));
+		tab_c=createTable(model, sch_b, QString("table_c"));
+
+		BaseRelationship *rel_a1_a2=createRelationship(model, tab_a1, tab_a2, QString("rel_a1_a2")),
+				*rel_a1_b=createRelationship(model, tab_a1, tab_b, QString("rel_a1_b")),
+				*rel_b_a2=createRelationship(model, tab_b, tab_a2, QString("rel_b_a2")),
+				*rel_b_c=createRelationship(model, tab_b, tab_c, QString("rel_b_c"));
+
+		QVERIFY(!SchemaView::isObjectCollapsed(tab_a1));
+		QVERIFY(!SchemaView::isObjectCollapsed(rel_a1_b));
+
+		sch_a->setCollapsed(true);
+
+		QVERIFY(SchemaView::isObjectCollapsed(tab_a1));
+		QVERIFY(SchemaView::isObjectCollapsed(tab_a2));
+		QVERIFY(!SchemaView::isObjectCollapsed(tab_b));
+		QVERIFY(!SchemaView::isObjectCollapsed(sch_a));
+
+		//Relationships are collapsed when one or both of their ends are collapsed
+		QVERIFY(SchemaView::isObjectCollapsed(rel_a1_a2));
+		QVERIFY(SchemaView::isObjectCollapsed(rel_a1_b));
+		QVERIFY(SchemaView::isObjectCollapsed(rel_b_a2));
+		QVERIFY(!SchemaView::isObjectCollapsed(rel_b_c));
+
+		sch_a->setCollapsed(false);
+		QVERIFY(!SchemaView::isObjectCollapsed(rel_a1_a2));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CollapsedSchemaTest::bundlesMustGroupRelationshipsByEndpointBoxes(void)
+{
+	DatabaseModel model;
+	ObjectsScene scene;
+	Schema *sch_a=nullptr, *sch_b=nullptr, *sch_c=nullptr;
+	Table *tab_a1=nullptr, *tab_a2=nullptr, *tab_b=nullptr, *tab_c1=nullptr, *tab_c2=nullptr;
+	vector<RelationshipBundleItem *> bundles;
+	SchemaView *sch_a_view=nullptr, *sch_c_view=nullptr;
+	TableView *tab_b_view=nullptr;
+	map<pair<BaseObjectView *, BaseObjectView *>, unsigned> counts;
+
+	try
+	{
+		BaseObjectView::loadObjectsStyle();
+		model.createSystemObjects(true);
+
+		sch_a=new Schema;
+		sch_a->setName(QString("schema_a"));
+		model.addSchema(sch_a);
+
+		sch_b=new Schema;
+		sch_b->setName(QString("schema_b"));
+		model.addSchema(sch_b);
+
+		sch_c=new Schema;
+		sch_c->setName(QString("schema_c"));
+		model.addSchema(sch_c);
+
+		tab_a1=createTable(model, sch_a, QString("table_a1"));
+		tab_a2=createTable(model, sch_a, QString("table_a2"));
+		tab_b=createTable(model, sch_b, QString("table_b"));
+		tab_c1=createTable(model, sch_c, QString("table_c1"));
+		tab_c2=createTable(model, sch_c, QString("table_c2"));
+
+		//Two relationships between the collapsed schema_a and the visible table_b share the same bundle
+		createRelationship(model, tab_a1, tab_b, QString("rel_a1_b"));
+		createRelationship(model, tab_b, tab_a2, QString("rel_b_a2"));
+
+		//Relationships between two collapsed schemas are bundled between the schemas boxes
+		createRelationship(model, tab_a1, tab_c1, QString("rel_a1_c1"));
+		createRelationship(model, tab_a2, tab_c1, QString("rel_a2_c1"));
+		createRelationship(model, tab_c2, tab_a2, QString("rel_c2_a2"));
+
+		//Relationships inside the same collapsed schema aren't represented
+		createRelationship(model, tab_a1, tab_a2, QString("rel_a1_a2"));
+		createRelationship(model, tab_c1, tab_c2, QString("rel_c1_c2"));
+
+		sch_a->setCollapsed(true);
+		sch_c->setCollapsed(true);
+
+		//Only the visible table has its own graphical representation
+		tab_b_view=new TableView(tab_b);
+		scene.addItem(tab_b_view);
+
+		sch_a_view=new SchemaView(sch_a);
+		scene.addItem(sch_a_view);
+
+		sch_c_view=new SchemaView(sch_c);
+		scene.addItem(sch_c_view);
+
+		scene.addItem(new SchemaView(sch_b));
+
+		bundles=RelationshipBundleItem::createBundles(&model);
+	}
+	catch(Exception &e)
+	{
+		qDeleteAll(bundles);
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	for(auto &bundle : bundles)
+	{
+		for(auto pair_objs : { pair<BaseObjectView *, BaseObjectView *>(sch_a_view, tab_b_view),
+													 pair<BaseObjectView *, BaseObjectView *>(sch_a_view, sch_c_view) })
+		{
+			if(bundle->isObjectConnected(pair_objs.first) && bundle->isObjectConnected(pair_objs.second))
+				counts[pair_objs]+=bundle->getRelationshipsCount();
+		}
+	}
+
+	QCOMPARE(bundles.size(), static_cast<size_t>(2));
+	QCOMPARE(counts.size(), static_cast<size_t>(2));
+	QCOMPARE(counts[pair<BaseObjectView *, BaseObjectView *>(sch_a_view, tab_b_view)], 2u);
+	QCOMPARE(counts[pair<BaseObjectView *, BaseObjectView *>(sch_a_view, sch_c_view)], 3u);
+
+	qDeleteAll(bundles);
+}
+
+QTEST_MAIN(CollapsedSchemaTest)
+#include "collapsedschematest.moc"
@@ -26,6 +26,8 @@ class DatabaseModelTest: public QObject {
 	private slots:
 		void saveObjectsMetadata(void);
 		void loadObjectsMetadata(void);
+		void parseQualifiedTypesWithoutExceptions(void);
+		void indexViewReferences(void);
 };
 
 void DatabaseModelTest::saveObjectsMetadata(void)
@@ -74,5 +76,86 @@ void DatabaseModelTest::loadObjectsMetadata(void)
 	}
 }
 
+void DatabaseModelTest::parseQualifiedTypesWithoutExceptions(void)
+{
+#ifdef QT_NO_DEBUG
+	QSKIP("The raised exceptions are only counted on debug builds");
+#else
+	unsigned raised_count=Exception::getRaisedCount();
+	PgSqlType type;
+
+	try
+	{
+		//Schema qualified names must be resolved to the registered types without raising errors internally
+		type=PgSqlType::parseString(QString("pg_catalog.varchar(20)"));
+		QCOMPARE(~type, QString("varchar"));
+		QCOMPARE(type.getLength(), 20u);
+
+		type=PgSqlType::parseString(QString("pg_catalog.int4[]"));
+		QCOMPARE(~type, QString("int4"));
+		QCOMPARE(type.getDimension(), 1u);
+
+		QCOMPARE(Exception::getRaisedCount(), raised_count);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+#endif
+}
+
+void DatabaseModelTest::indexViewReferences(void)
+{
+	DatabaseModel dbmodel;
+	vector<BaseObject *> refs;
+	View *view=nullptr;
+
+	auto count_views=[&dbmodel](BaseObject *table, vector<BaseObject *> &refs, unsigned &ref_views, unsigned &exp_views){
+		ref_views=exp_views=0;
+		refs.clear();
+		dbmodel.getObjectReferences(table, refs);
+
+		for(auto &ref : refs)
+			if(ref->getObjectType()==ObjectType::View) ref_views++;
+
+		for(auto &obj : *dbmodel.getObjectList(ObjectType::View))
+			if(dynamic_cast<View *>(obj)->isReferencingTable(dynamic_cast<PhysicalTable *>(table))) exp_views++;
+	};
+
+	try
+	{
+		unsigned ref_views=0, exp_views=0;
+
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(SAMPLESDIR + GlobalAttributes::DirSeparator + QString("pagila.dbm"));
+		QVERIFY(dbmodel.getObjectCount(ObjectType::View) > 0);
+
+		//The views found through the index must be the same ones found inspecting all views
+		for(auto &table : *dbmodel.getObjectList(ObjectType::Table))
+		{
+			count_views(table, refs, ref_views, exp_views);
+			QCOMPARE(ref_views, exp_views);
+		}
+
+		//Removing a view must remove it from the index as well as its relationships
+		view=dbmodel.getView(0);
+		dbmodel.removeView(view);
+		QVERIFY(dbmodel.getRelationship(view, nullptr) == nullptr);
+
+		for(auto &table : *dbmodel.getObjectList(ObjectType::Table))
+		{
+			count_views(table, refs, ref_views, exp_views);
+			QCOMPARE(ref_views, exp_views);
+			QVERIFY(std::find(refs.begin(), refs.end(), view) == refs.end());
+		}
+
+		delete(view);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(DatabaseModelTest)
 #include "databasemodeltest.moc"
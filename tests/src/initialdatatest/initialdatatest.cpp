@@ -0,0 +1,134 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "table.h"
+#include "schema.h"
+
+class InitialDataTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Configures the table public.tab(id integer, label text) used by the tests
+		void createTable(Schema &schema, Table &table);
+
+	private slots:
+		void bufferMustSurviveSplitAndRegeneration(void);
+		void insertFormatMustGenerateBatchedInserts(void);
+		void copyFormatMustSendNonCopyableRowsToInsert(void);
+};
+
+void InitialDataTest::createTable(Schema &schema, Table &table)
+{
+	Column *col=nullptr;
+
+	schema.setName(QString("public"));
+	table.setName(QString("tab"));
+	table.setSchema(&schema);
+
+	col=new Column;
+	col->setName(QString("id"));
+	col->setType(PgSqlType(QString("integer")));
+	table.addColumn(col);
+
+	col=new Column;
+	col->setName(QString("label"));
+	col->setType(PgSqlType(QString("text")));
+	table.addColumn(col);
+}
+
+void InitialDataTest::bufferMustSurviveSplitAndRegeneration(void)
+{
+	QString buffer=QStringList({ QString("id%1label").arg(PhysicalTable::DataSeparator),
+															 QString("1%1a").arg(PhysicalTable::DataSeparator),
+															 QString("2%1").arg(PhysicalTable::DataSeparator) }).join(PhysicalTable::DataLineBreak);
+	QStringList col_names;
+	vector<QStringList> values;
+	Table table;
+
+	QCOMPARE(PhysicalTable::splitInitialData(buffer, col_names, values), 2);
+	QCOMPARE(col_names, QStringList({ QString("id"), QString("label") }));
+	QCOMPARE(values.size(), static_cast<size_t>(2));
+	QCOMPARE(values[0], QStringList({ QString("1"), QString("2") }));
+	QCOMPARE(values[1], QStringList({ QString("a"), QString() }));
+
+	//The columns are converted back to the very same buffer
+	table.setInitialData(col_names, values);
+	QCOMPARE(table.getInitialData(), buffer);
+
+	//The raw buffer is converted to the same columns
+	table.setInitialData(buffer);
+	QCOMPARE(table.getInitialDataRowCount(), 2);
+	QCOMPARE(table.getInitialDataColumns(), col_names);
+	QVERIFY(table.getInitialDataValues() == values);
+
+	//Rows with less values than columns are completed with empty values
+	table.setInitialData(QString("id%1label%2%3").arg(PhysicalTable::DataSeparator).arg(PhysicalTable::DataLineBreak).arg(3));
+	QCOMPARE(table.getInitialDataValues()[1], QStringList({ QString() }));
+	table.setInitialData(table.getInitialDataColumns(), table.getInitialDataValues());
+	QCOMPARE(table.getInitialData(), QString("id%1label%2%3%1").arg(PhysicalTable::DataSeparator).arg(PhysicalTable::DataLineBreak).arg(3));
+}
+
+void InitialDataTest::insertFormatMustGenerateBatchedInserts(void)
+{
+	Schema schema;
+	Table table;
+
+	createTable(schema, table);
+
+	//Unknown columns are discarded, empty values are DEFAULT and values between slashes are expressions
+	table.setInitialData({ QString("id"), QString("unknown"), QString("label") },
+											 { { QString("1"), QString() }, { QString("x"), QString("y") }, { QString("it's"), QString("/now()/") } });
+	table.setInitialDataFormat(PhysicalTable::InsertDataFormat);
+
+	QCOMPARE(table.getInitialDataCommands(),
+					 QString("INSERT INTO public.tab (id, label) VALUES\n"
+									 "(E'1', E'it''s'),\n"
+									 "(DEFAULT, now());\n"
+									 "-- ddl-end --\n"));
+}
+
+void InitialDataTest::copyFormatMustSendNonCopyableRowsToInsert(void)
+{
+	Schema schema;
+	Table table;
+
+	createTable(schema, table);
+
+	/* The literal \N must not be written in the COPY data since it'd be read as NULL while
+	 * the INSERT commands (E'') produce the letter N. Escaped backslashes can be copied as is */
+	table.setInitialData({ QString("id"), QString("label") },
+											 { { QString("1"), QString("2"), QString("3"), QString("4") },
+												 { QString("a\tb"), QString("\\N"), QString(), QString("C:\\\\dir") } });
+	table.setInitialDataFormat(PhysicalTable::CopyDataFormat);
+
+	QCOMPARE(table.getInitialDataCommands(),
+					 QString("COPY public.tab (id, label) FROM stdin;\n"
+									 "1\ta\\tb\n"
+									 "4\tC:\\\\dir\n"
+									 "\\.\n"
+									 "-- ddl-end --\n"
+									 "\n"
+									 "INSERT INTO public.tab (id, label) VALUES\n"
+									 "(E'2', E'\\N'),\n"
+									 "(E'3', DEFAULT);\n"
+									 "-- ddl-end --\n"));
+}
+
+QTEST_MAIN(InitialDataTest)
+#include "initialdatatest.moc"
@@ -0,0 +1,131 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "databasemodel.h"
+
+class MemoryUsageTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Amount of tables and columns per table created in the generated model
+		static constexpr unsigned TableCount=200,
+		ColumnCount=20,
+
+		//! \brief Maximum amount of bytes (all categories) expected per table and per column
+		TableBudget=96*1024,
+		ColumnBudget=24*1024;
+
+		//! \brief Populates the provided model with TableCount tables having ColumnCount columns each
+		void generateModel(DatabaseModel &dbmodel);
+
+	private slots:
+		void objectsMustStayWithinBudget(void);
+		void cachedCodeMustBeEmptyWhenCacheIsDisabled(void);
+};
+
+void MemoryUsageTest::generateModel(DatabaseModel &dbmodel)
+{
+	Schema *schema=nullptr;
+	Table *table=nullptr;
+	Column *col=nullptr;
+
+	dbmodel.createSystemObjects(true);
+	schema=dbmodel.getSchema("public");
+
+	for(unsigned tab_id=0; tab_id < TableCount; tab_id++)
+	{
+		table=new Table;
+		table->setName(QString("table_%1").arg(tab_id));
+		table->setSchema(schema);
+
+		for(unsigned col_id=0; col_id < ColumnCount; col_id++)
+		{
+			col=new Column;
+			col->setName(QString("column_%1").arg(col_id));
+			col->setType(PgSqlType(col_id % 2 == 0 ? "integer" : "text"));
+			col->setComment(QString("Comment of column %1").arg(col_id));
+			table->addColumn(col);
+		}
+
+		dbmodel.addTable(table);
+	}
+
+	//Generating the code in order to populate the code cache and the parsers buffers
+	dbmodel.getCodeDefinition(SchemaParser::SqlDefinition);
+	dbmodel.getCodeDefinition(SchemaParser::XmlDefinition);
+}
+
+void MemoryUsageTest::objectsMustStayWithinBudget(void)
+{
+	DatabaseModel dbmodel;
+	map<ObjectType, unsigned> obj_count;
+	map<ObjectType, vector<size_t>> obj_usage;
+	size_t total=0, tab_usage=0, col_usage=0;
+
+	try
+	{
+		BaseObject::enableCachedCode(true);
+		generateModel(dbmodel);
+		total=dbmodel.getMemoryUsage(obj_count, obj_usage);
+
+		QCOMPARE(obj_count[ObjectType::Table], static_cast<unsigned>(TableCount));
+		QCOMPARE(obj_count[ObjectType::Column], static_cast<unsigned>(TableCount * ColumnCount));
+
+		for(auto &size : obj_usage[ObjectType::Table])
+			tab_usage+=size;
+
+		for(auto &size : obj_usage[ObjectType::Column])
+			col_usage+=size;
+
+		QVERIFY(obj_usage[ObjectType::Table][BaseObject::MemCachedCode] > 0);
+		QVERIFY(tab_usage / TableCount <= TableBudget);
+		QVERIFY(col_usage / (TableCount * ColumnCount) <= ColumnBudget);
+		QVERIFY(total >= tab_usage + col_usage);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void MemoryUsageTest::cachedCodeMustBeEmptyWhenCacheIsDisabled(void)
+{
+	DatabaseModel dbmodel;
+	map<ObjectType, unsigned> obj_count;
+	map<ObjectType, vector<size_t>> obj_usage;
+
+	try
+	{
+		BaseObject::enableCachedCode(false);
+		generateModel(dbmodel);
+		dbmodel.getMemoryUsage(obj_count, obj_usage);
+		BaseObject::enableCachedCode(true);
+
+		for(auto &itr : obj_usage)
+			QCOMPARE(itr.second[BaseObject::MemCachedCode], static_cast<size_t>(0));
+	}
+	catch(Exception &e)
+	{
+		BaseObject::enableCachedCode(true);
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(MemoryUsageTest)
+#include "memoryusagetest.moc"
@@ -0,0 +1,93 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "modelexporthelper.h"
+#include "tableview.h"
+
+class ModelExportTest: public QObject {
+	private:
+		Q_OBJECT
+
+	private slots:
+		void exportToSVGMustGroupObjectsAndClipTableChildren(void);
+};
+
+void ModelExportTest::exportToSVGMustGroupObjectsAndClipTableChildren(void)
+{
+	DatabaseModel model;
+	ObjectsScene scene;
+	ModelExportHelper export_hlp;
+	QString output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + QString("modelexport.svg"),
+			svg_def, font_family;
+	QFile svg_file;
+	Table *table=nullptr;
+	Column *col=nullptr;
+
+	try
+	{
+		BaseObjectView::loadObjectsStyle();
+		model.createSystemObjects(true);
+
+		table=new Table;
+		table->setName(QString("table_a"));
+		table->setSchema(model.getSchema(QString("public")));
+
+		//The column name and type are longer than the table box so their texts must be clipped
+		col=new Column;
+		col->setName(QString("a_very_long_column_name_").repeated(5));
+		col->setType(PgSqlType(QString("varchar"), 0, 255));
+		table->addColumn(col);
+
+		model.addTable(table);
+		scene.addItem(new TableView(table));
+
+		QDir().remove(output);
+		export_hlp.exportToSVG(&scene, output, false, false);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	svg_file.setFileName(output);
+	QVERIFY(svg_file.open(QFile::ReadOnly));
+	svg_def=QString::fromUtf8(svg_file.readAll());
+	svg_file.close();
+
+	//The items of the table are grouped in an element identified by the object's type and id
+	QVERIFY(svg_def.contains(QString("<g id=\"table_%1\" class=\"table\"><title>%2</title>")
+													 .arg(table->getObjectId()).arg(table->getSignature(false).toHtmlEscaped())));
+	QCOMPARE(svg_def.count(QString("<g id=\"table_%1\"").arg(table->getObjectId())), 1);
+
+	//The shared definitions are written once at the end of the document
+	QCOMPARE(svg_def.count(QString("<defs>")), 1);
+	QVERIFY(svg_def.indexOf(QString("<defs>")) > svg_def.indexOf(QString("<g id=\"table_%1\"").arg(table->getObjectId())));
+	QVERIFY(svg_def.contains(QString("<style type=\"text/css\">")));
+
+	//The table children are clipped by the table body
+	QVERIFY(svg_def.contains(QString("<clipPath id=\"cp0\">")));
+	QVERIFY(svg_def.contains(QString("clip-path=\"url(#cp0)\"")));
+
+	//The text is written using the global object font
+	font_family=BaseObjectView::getFontStyle(Attributes::Global).font().family();
+	QVERIFY(svg_def.contains(QString("font-family:'%1'").arg(font_family)));
+}
+
+QTEST_MAIN(ModelExportTest)
+#include "modelexporttest.moc"
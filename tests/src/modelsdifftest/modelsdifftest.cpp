@@ -0,0 +1,109 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "modelsdiffhelper.h"
+
+class ModelsDiffTest: public QObject {
+	private:
+		Q_OBJECT
+
+		/*! \brief Loads the sample models and returns the diff between them generated using the provided amount of threads.
+		 * An empty imp_sample makes the source model to be compared against an empty model with the same database name.
+		 * When deferred is false the CREATE commands are generated inline, in the reference order of the diff infos */
+		static QString getDiff(const QString &src_sample, const QString &imp_sample, int thread_count, bool deferred);
+
+		/*! \brief Checks that the deferred generation, using one, many or the ideal amount of threads, produces
+		 * exactly the same script as the inline generation */
+		static void compareWithInlineDiff(const QString &src_sample, const QString &imp_sample);
+
+	private slots:
+		void deferredDiffMustMatchInlineDiffAgainstEmptyModel(void);
+		void deferredDiffMustMatchInlineDiffAgainstOtherModel(void);
+};
+
+QString ModelsDiffTest::getDiff(const QString &src_sample, const QString &imp_sample, int thread_count, bool deferred)
+{
+	DatabaseModel src_model, imp_model;
+	ModelsDiffHelper diff_hlp;
+	QString diff_error;
+
+	src_model.createSystemObjects(false);
+	src_model.loadModel(SAMPLESDIR + GlobalAttributes::DirSeparator + src_sample);
+
+	imp_model.createSystemObjects(false);
+
+	if(!imp_sample.isEmpty())
+		imp_model.loadModel(SAMPLESDIR + GlobalAttributes::DirSeparator + imp_sample);
+	else
+		imp_model.setName(src_model.getName());
+
+	//The helper reports the errors through a signal instead of raising them
+	QObject::connect(&diff_hlp, &ModelsDiffHelper::s_diffAborted, [&diff_error](Exception e){
+		diff_error=e.getExceptionsText();
+	});
+
+	diff_hlp.setModels(&src_model, &imp_model);
+	diff_hlp.setDiffOption(ModelsDiffHelper::OptPreserveDbName, true);
+	diff_hlp.setMaxThreadCount(thread_count);
+	diff_hlp.setDeferredCodeGeneration(deferred);
+	diff_hlp.diffModels();
+
+	if(!diff_error.isEmpty())
+		throw Exception(diff_error, ErrorCode::Custom, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	return(diff_hlp.getDiffDefinition());
+}
+
+void ModelsDiffTest::compareWithInlineDiff(const QString &src_sample, const QString &imp_sample)
+{
+	QString inline_diff=getDiff(src_sample, imp_sample, 1, false);
+
+	QVERIFY(!inline_diff.isEmpty());
+	QCOMPARE(getDiff(src_sample, imp_sample, 1, true), inline_diff);
+	QCOMPARE(getDiff(src_sample, imp_sample, 4, true), inline_diff);
+	QCOMPARE(getDiff(src_sample, imp_sample, 0, true), inline_diff);
+}
+
+void ModelsDiffTest::deferredDiffMustMatchInlineDiffAgainstEmptyModel(void)
+{
+	try
+	{
+		compareWithInlineDiff(QString("pagila.dbm"), QString());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelsDiffTest::deferredDiffMustMatchInlineDiffAgainstOtherModel(void)
+{
+	try
+	{
+		//Diffing distinct models generates DROP and ALTER commands too, which the inline generation interleaves with the CREATE ones
+		compareWithInlineDiff(QString("pagila.dbm"), QString("demo.dbm"));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(ModelsDiffTest)
+#include "modelsdifftest.moc"
@@ -0,0 +1,215 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "databasemodel.h"
+#include "uniquenameallocator.h"
+#include "pgmodelerns.h"
+
+class ObjectCloneTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Amount of tables and columns per table created in the benchmark model
+		static constexpr unsigned TableCount=300,
+		ColumnCount=10;
+
+		/*! \brief Populates the provided model with TableCount tables having ColumnCount columns and a primary key.
+		 * Each table (except the first one) has a foreign key referencing the previous table */
+		void generateModel(DatabaseModel &dbmodel, vector<BaseObject *> &tables);
+
+	private slots:
+		void clonesMustReferenceClonedObjects(void);
+		void allocatorMustGenerateSameNamesAsGenerateUniqueName(void);
+		void benchmarkClone(void);
+		void benchmarkXMLRoundTrip(void);
+};
+
+void ObjectCloneTest::generateModel(DatabaseModel &dbmodel, vector<BaseObject *> &tables)
+{
+	Schema *schema=nullptr;
+	Table *table=nullptr, *prev_table=nullptr;
+	Column *col=nullptr;
+	Constraint *constr=nullptr;
+
+	dbmodel.createSystemObjects(true);
+	schema=dbmodel.getSchema("public");
+	tables.clear();
+
+	for(unsigned tab_id=0; tab_id < TableCount; tab_id++)
+	{
+		table=new Table;
+		table->setName(QString("table_%1").arg(tab_id));
+		table->setSchema(schema);
+
+		for(unsigned col_id=0; col_id < ColumnCount; col_id++)
+		{
+			col=new Column;
+			col->setName(QString("column_%1").arg(col_id));
+			col->setType(PgSqlType(col_id % 2 == 0 ? "integer" : "text"));
+			table->addColumn(col);
+		}
+
+		constr=new Constraint;
+		constr->setName(QString("table_%1_pk").arg(tab_id));
+		constr->setConstraintType(ConstraintType::PrimaryKey);
+		constr->addColumn(table->getColumn(0), Constraint::SourceCols);
+		table->addConstraint(constr);
+
+		if(prev_table)
+		{
+			constr=new Constraint;
+			constr->setName(QString("table_%1_fk").arg(tab_id));
+			constr->setConstraintType(ConstraintType::ForeignKey);
+			constr->setReferencedTable(prev_table);
+			constr->addColumn(table->getColumn(2), Constraint::SourceCols);
+			constr->addColumn(prev_table->getColumn(0), Constraint::ReferencedCols);
+			table->addConstraint(constr);
+		}
+
+		dbmodel.addTable(table);
+		tables.push_back(table);
+		prev_table=table;
+	}
+}
+
+void ObjectCloneTest::clonesMustReferenceClonedObjects(void)
+{
+	DatabaseModel dbmodel;
+	vector<BaseObject *> tables, clones;
+	Table *tab_clone=nullptr, *ref_clone=nullptr;
+	Constraint *pk=nullptr, *fk=nullptr;
+
+	try
+	{
+		generateModel(dbmodel, tables);
+		tables.resize(2);
+
+		QVERIFY(dbmodel.canCloneObjects(tables, false));
+		dbmodel.cloneObjects(tables, clones, false);
+
+		//Two tables followed by the foreign key of the second one
+		QCOMPARE(clones.size(), static_cast<size_t>(3));
+
+		ref_clone=dynamic_cast<Table *>(clones[0]);
+		tab_clone=dynamic_cast<Table *>(clones[1]);
+		fk=dynamic_cast<Constraint *>(clones[2]);
+
+		QVERIFY(ref_clone && tab_clone && fk);
+		QCOMPARE(tab_clone->getColumnCount(), static_cast<unsigned>(ColumnCount));
+
+		pk=tab_clone->getPrimaryKey();
+		QVERIFY(pk && pk != dynamic_cast<Table *>(tables[1])->getPrimaryKey());
+		QCOMPARE(pk->getColumn(0, Constraint::SourceCols), tab_clone->getColumn(0));
+
+		QCOMPARE(fk->getParentTable(), dynamic_cast<BaseTable *>(tab_clone));
+		QCOMPARE(fk->getReferencedTable(), dynamic_cast<BaseTable *>(ref_clone));
+		QCOMPARE(fk->getColumn(0, Constraint::SourceCols), tab_clone->getColumn(2));
+		QCOMPARE(fk->getColumn(0, Constraint::ReferencedCols), ref_clone->getColumn(0));
+
+		delete(fk);
+		delete(tab_clone);
+		delete(ref_clone);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ObjectCloneTest::allocatorMustGenerateSameNamesAsGenerateUniqueName(void)
+{
+	DatabaseModel dbmodel;
+	vector<BaseObject *> tables;
+	UniqueNameAllocator name_alloc;
+	QString alloc_name, uniq_name;
+
+	try
+	{
+		generateModel(dbmodel, tables);
+
+		for(auto &table : tables)
+		{
+			uniq_name=PgModelerNs::generateUniqueName(table, *dbmodel.getObjectList(ObjectType::Table), false, QString("_cp"), true);
+			alloc_name=name_alloc.allocateName(table, &dbmodel, *dbmodel.getObjectList(ObjectType::Table), QString("_cp"), true);
+			QCOMPARE(alloc_name, uniq_name);
+		}
+
+		//Names allocated in the same batch must not conflict with each other
+		alloc_name=name_alloc.allocateName(tables[0], &dbmodel, *dbmodel.getObjectList(ObjectType::Table), QString("_cp"), true);
+		QCOMPARE(alloc_name, QString("table_0_cp1"));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ObjectCloneTest::benchmarkClone(void)
+{
+	DatabaseModel dbmodel;
+	vector<BaseObject *> tables, clones;
+
+	generateModel(dbmodel, tables);
+
+	QBENCHMARK
+	{
+		UniqueNameAllocator name_alloc;
+
+		dbmodel.cloneObjects(tables, clones, false);
+
+		for(auto &clone : clones)
+		{
+			if(clone->getObjectType()==ObjectType::Table)
+				clone->setName(name_alloc.allocateName(clone, &dbmodel, *dbmodel.getObjectList(ObjectType::Table), QString("_cp"), true));
+		}
+
+		//Foreign keys (at the end of the list) must be destroyed before their tables
+		for(auto itr=clones.rbegin(); itr!=clones.rend(); itr++)
+			delete(*itr);
+	}
+}
+
+void ObjectCloneTest::benchmarkXMLRoundTrip(void)
+{
+	DatabaseModel dbmodel;
+	vector<BaseObject *> tables;
+	Table *table=nullptr;
+
+	generateModel(dbmodel, tables);
+
+	QBENCHMARK
+	{
+		for(auto &object : tables)
+		{
+			object->setCodeInvalidated(true);
+			object->setName(PgModelerNs::generateUniqueName(object, *dbmodel.getObjectList(ObjectType::Table), false, QString("_cp"), true));
+
+			dbmodel.getXMLParser()->restartParser();
+			dbmodel.getXMLParser()->loadXMLBuffer(object->getCodeDefinition(SchemaParser::XmlDefinition));
+			table=dynamic_cast<Table *>(dbmodel.createObject(ObjectType::Table));
+			delete(table);
+		}
+
+		for(unsigned tab_id=0; tab_id < TableCount; tab_id++)
+			tables[tab_id]->setName(QString("table_%1").arg(tab_id));
+	}
+}
+
+QTEST_MAIN(ObjectCloneTest)
+#include "objectclonetest.moc"
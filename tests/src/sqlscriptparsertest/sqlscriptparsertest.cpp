@@ -0,0 +1,109 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2019 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "sqlscriptparser.h"
+
+class SQLScriptParserTest: public QObject {
+	private:
+		Q_OBJECT
+
+	private slots:
+		void splitMustIgnoreSemicolonsInTaggedDollarQuotes(void);
+		void splitMustHandleEscapeStrings(void);
+		void splitMustHandleNestedBlockComments(void);
+		void splitMustKeepBeginAtomicBodiesTogether(void);
+		void splitMustReturnStatementsStartLines(void);
+};
+
+void SQLScriptParserTest::splitMustIgnoreSemicolonsInTaggedDollarQuotes(void)
+{
+	QString func_def=QString("CREATE FUNCTION public.f() RETURNS text AS $body$\n"
+													 "BEGIN\n"
+													 "  PERFORM $tag$;$tag$;\n"
+													 "  RETURN 'a;b';\n"
+													 "END;\n"
+													 "$body$ LANGUAGE plpgsql;");
+
+	QCOMPARE(SQLScriptParser::splitStatements(func_def + QString("\nSELECT $q$;$$;$q$;\nSELECT $1 + 1; SELECT foo$bar FROM t;")),
+					 QStringList({ func_def, "SELECT $q$;$$;$q$;", "SELECT $1 + 1;", "SELECT foo$bar FROM t;" }));
+
+	//An unterminated dollar quote makes the rest of the script to be returned as the last statement
+	QCOMPARE(SQLScriptParser::splitStatements(QString("SELECT 1; SELECT $x$; SELECT 2;")),
+					 QStringList({ "SELECT 1;", "SELECT $x$; SELECT 2;" }));
+}
+
+void SQLScriptParserTest::splitMustHandleEscapeStrings(void)
+{
+	QCOMPARE(SQLScriptParser::splitStatements(QString("SELECT E'it\\'s; ok'; SELECT e'\\\\'; SELECT 1;")),
+					 QStringList({ "SELECT E'it\\'s; ok';", "SELECT e'\\\\';", "SELECT 1;" }));
+
+	//In standard strings the backslash is a regular character so the quote after it closes the string
+	QCOMPARE(SQLScriptParser::splitStatements(QString("SELECT 'a\\'; SELECT 'it''s; ok';")),
+					 QStringList({ "SELECT 'a\\';", "SELECT 'it''s; ok';" }));
+
+	//A quote after an identifier ending in "e" doesn't start an escape string
+	QCOMPARE(SQLScriptParser::splitStatements(QString("SELECT some'\\'; SELECT \"a;b\";")),
+					 QStringList({ "SELECT some'\\';", "SELECT \"a;b\";" }));
+}
+
+void SQLScriptParserTest::splitMustHandleNestedBlockComments(void)
+{
+	QCOMPARE(SQLScriptParser::splitStatements(QString("/* outer /* inner; */ still comment; */\n"
+																										"SELECT 1;\n"
+																										"SELECT /* a; /* b; */ c; */ 2; -- trailing;\n")),
+					 QStringList({ "SELECT 1;", "SELECT /* a; /* b; */ c; */ 2;" }));
+}
+
+void SQLScriptParserTest::splitMustKeepBeginAtomicBodiesTogether(void)
+{
+	QString func_def=QString("CREATE FUNCTION public.f(a integer) RETURNS integer LANGUAGE sql\n"
+													 "begin atomic\n"
+													 "  SELECT CASE WHEN a > 0 THEN 1 ELSE 0 END;\n"
+													 "  SELECT CASE a WHEN 1 THEN (CASE WHEN a > 2 THEN 3 END) END;\n"
+													 "  SELECT a + 1;\n"
+													 "END;");
+
+	QCOMPARE(SQLScriptParser::splitStatements(func_def + QString("\nSELECT 1;")),
+					 QStringList({ func_def, "SELECT 1;" }));
+
+	//Transaction blocks must still be split into individual statements
+	QCOMPARE(SQLScriptParser::splitStatements(QString("BEGIN; SELECT 1; END; START TRANSACTION; COMMIT;")),
+					 QStringList({ "BEGIN;", "SELECT 1;", "END;", "START TRANSACTION;", "COMMIT;" }));
+}
+
+void SQLScriptParserTest::splitMustReturnStatementsStartLines(void)
+{
+	QList<int> lines;
+	QStringList stmts;
+
+	stmts=SQLScriptParser::splitStatements(QString("-- header;\n"
+																								 "SELECT 'a\n"
+																								 "b';\n"
+																								 "/* c\n"
+																								 "d */ SELECT $$\n"
+																								 "$$;\n"
+																								 "\n"
+																								 "SELECT 2"), &lines);
+
+	QCOMPARE(stmts, QStringList({ "SELECT 'a\nb';", "SELECT $$\n$$;", "SELECT 2" }));
+	QCOMPARE(lines, QList<int>({ 2, 5, 8 }));
+}
+
+QTEST_MAIN(SQLScriptParserTest)
+#include "sqlscriptparsertest.moc"
@@ -18,6 +18,14 @@ src/partrelationshiptest \
 src/foreigndatawrappertest \
 src/servertest \
 src/usermappingtest \
-src/datadicttest
+src/datadicttest \
+src/memoryusagetest \
+src/objectclonetest \
+src/catalogtest \
+src/sqlscriptparsertest \
+src/modelsdifftest \
+src/modelexporttest \
+src/initialdatatest \
+src/collapsedschematest
 
 